@@ -1,787 +1,472 @@
-#include "scanner.h"
+#include "assembler.h"
+#include "diagnostics.h"
+#include "linecache.h"
+#include "sourcefile.h"
+#include "threadpool.h"
+#include "wordio.h"
 #include <algorithm>
-#include <fstream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
 #include <iostream>
-#include <map>
+#include <numeric>
 #include <string>
+#include <system_error>
 #include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 using namespace std;
-class Assembler{
-std::vector<uint32_t> assembly_binary_code;
-std::map<std::string, uint32_t> symbolTable;
-std::map<std::string, vector<uint32_t>> lable_pc_map;
-std::map<std::string, vector<uint32_t>> branch_reference_map;
-std::vector<std::string> asm_files;
 
-void writebin(uint32_t instr) { assembly_binary_code.push_back(instr); }
-void coutmult(uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (0 << 11) | 24; // add $3, $2, $4
-  writebin(instr);
-}
-void coutmultu(uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (0 << 11) | 25; // add $3, $2, $4
-  writebin(instr);
-}
-void coutdiv(uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (0 << 11) | 26; // add $3, $2, $4
-  writebin(instr);
-}
-void coutdivu(uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (0 << 11) | 27; // add $3, $2, $4
-  writebin(instr);
-}
-void coutAdd(uint32_t d, uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (d << 11) | 32; // add $3, $2, $4
-  writebin(instr);
-}
-void coutSub(uint32_t d, uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (d << 11) | 34; // add $3, $2, $4
-  writebin(instr);
-}
-void coutSlt(uint32_t d, uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (d << 11) | 42; // add $3, $2, $4
-  writebin(instr);
-}
-void coutSltu(uint32_t d, uint32_t s, uint32_t t) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (t << 16) | (d << 11) | 43; // add $3, $2, $4
-  writebin(instr);
-}
-void coutBeq(uint32_t s, uint32_t t, uint32_t i) {
-  i = i & (0xffff);
-  uint32_t instr = (4 << 26) | (s << 21) | (t << 16) | i; // add $3, $2, $4
-  writebin(instr);
-}
-void coutBne(uint32_t s, uint32_t t, uint32_t i) {
-  i = i & (0xffff);
-  uint32_t instr = (5 << 26) | (s << 21) | (t << 16) | i; // add $3, $2, $4
-  writebin(instr);
-}
-
-void jr(uint32_t s) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (0 << 16) | (0 << 11) | 8; // add $3, $2, $4
-  writebin(instr);
-}
-void jalr(uint32_t s) {
-  uint32_t instr =
-      (0 << 26) | (s << 21) | (0 << 16) | (0 << 11) | 9; // add $3, $2, $4
-  writebin(instr);
-}
-void mfhi(uint32_t d) {
-  uint32_t instr =
-      (0 << 26) | (0 << 21) | (0 << 16) | (d << 11) | 16; // add $3, $2, $4
-  writebin(instr);
-}
-void mflo(uint32_t d) {
-  uint32_t instr =
-      (0 << 26) | (0 << 21) | (0 << 16) | (d << 11) | 18; // add $3, $2, $4
-  writebin(instr);
-}
-void lis(uint32_t d) {
-  uint32_t instr =
-      (0 << 26) | (0 << 21) | (0 << 16) | (d << 11) | 20; // add $3, $2, $4
-  writebin(instr);
-}
-void coutSw(uint32_t t, uint32_t i, uint32_t s) {
-  i = i & (0xffff);
-  uint32_t instr = (43 << 26) | (s << 21) | (t << 16) | i; // add $3, $2, $4
-  writebin(instr);
-}
-void coutLw(uint32_t t, uint32_t i, uint32_t s) {
-  i = i & (0xffff);
-  uint32_t instr = (35 << 26) | (s << 21) | (t << 16) | i; // add $3, $2, $4
-  writebin(instr);
-}
 /*
-add $1, $2, $3
-Token(ID, add) Token(REG, $1) Token(COMMA, ,) Token(REG, $2) Token(COMMA, ,)
-Token(REG, $3)
-*/
-bool add_sub_slt_sltu(uint32_t ind, std::vector<Token> &vecref) {
-
-  bool sizeMeet = (ind + 6 == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = vecref[ind].getKind() == Token::ID &&
-                       vecref[ind + 1].getKind() == Token::REG &&
-                       vecref[ind + 2].getKind() == Token::COMMA &&
-                       vecref[ind + 3].getKind() == Token::REG &&
-                       vecref[ind + 4].getKind() == Token::COMMA &&
-                       vecref[ind + 5].getKind() == Token::REG;
-  if (!structureMeet)
-    return false;
-  bool instructionValid =
-      vecref[ind].getLexeme() == "add" || vecref[ind].getLexeme() == "sub" ||
-      vecref[ind].getLexeme() == "slt" || vecref[ind].getLexeme() == "sltu";
-  if (!instructionValid)
-    return false;
-  return true;
-}
-bool mult_multu_div_divu(uint32_t ind, std::vector<Token> &vecref) {
-  vector<Token> buf = scan("mult $4, $3");
-  bool sizeMeet = (ind + buf.size() == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = true;
+ * C++ Starter code for CS241 A3
+ * All code requires C++17, so if you're getting compile errors make sure to
+ * use -std=c++17.
+ *
+ * This file contains the main function of your program. The assembler
+ * itself lives in assembler.cc (libmipsasm); main reads the source, runs
+ * it and writes the output file.
+ */
 
-  for (uint32_t i = 0; i < buf.size(); i++) {
-    structureMeet =
-        structureMeet && (vecref[ind + i].getKind() == buf[i].getKind());
+void print_merl_file(std::initializer_list<WordSpan> merl_file) {
+  std::ostream &out = diagnostics().out();
+  out << "Merl file: " << '\n';
+  for (const WordSpan &words : merl_file) {
+    for (size_t i = 0; i < words.size; i++) {
+      out << "0x" << hex << words.data[i] << '\n';
+    }
   }
-
-  if (!structureMeet)
-    return false;
-  bool instructionValid =
-      vecref[ind].getLexeme() == "mult" || vecref[ind].getLexeme() == "multu" ||
-      vecref[ind].getLexeme() == "div" || vecref[ind].getLexeme() == "divu";
-  if (!instructionValid)
-    return false;
-  return true;
+  out << '\n';
 }
-// Token(ID, lis) Token(REG, $4)
-bool mfhi_mflo_lis(uint32_t ind, std::vector<Token> &vecref) {
 
-  bool sizeMeet = (ind + 2 == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = vecref[ind].getKind() == Token::ID &&
-                       vecref[ind + 1].getKind() == Token::REG;
-  if (!structureMeet)
-    return false;
-  bool instructionValid = vecref[ind].getLexeme() == "mfhi" ||
-                          vecref[ind].getLexeme() == "mflo" ||
-                          vecref[ind].getLexeme() == "lis";
-  if (!instructionValid)
-    return false;
-  return true;
-}
-// Token(ID, lw) Token(REG, $4) Token(COMMA, ,) Token(INT, 1) Token(LPAREN, ()
-// Token(REG, $3) Token(RPAREN, ))
-bool lw_sw(uint32_t ind, std::vector<Token> &vecref) {
-  vector<Token> buf = scan("lw $4, 1($3)");
-  bool sizeMeet = (ind + buf.size() == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = false;
-  bool bufTemp = true;
-  for (uint32_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
-  }
-  structureMeet = structureMeet || bufTemp;
-  buf = scan("lw $4, 0x1($3)");
-  bufTemp = true;
-  for (uint32_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
+// Writes the output file of an assembled source, in big-endian format.
+// Returns false (with errno set) on failure.
+bool write_output_file(const std::string &path,
+                       const Assembler::AsmReturn &result) {
+  if (result.merl_module) {
+    return writeBigEndianFile(
+        path.c_str(),
+        {WordSpan(result.merl_header.data(), result.merl_header.size()),
+         result.assembly_binary_code, result.entries_binary});
   }
-  structureMeet = structureMeet || bufTemp;
-  if (!structureMeet)
-    return false;
-  bool instructionValid =
-      vecref[ind].getLexeme() == "lw" || vecref[ind].getLexeme() == "sw";
-  if (!instructionValid)
-    return false;
-  return true;
+  return writeBigEndianFile(path.c_str(), {result.assembly_binary_code});
 }
-bool beq_bne(uint32_t ind, std::vector<Token> &vecref) {
-  vector<Token> buf = scan("beq $4, $0, i");
-  bool sizeMeet = (ind + buf.size() == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = false;
-  bool bufTemp = true;
-  for (uint32_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
-  }
-  structureMeet = structureMeet || bufTemp;
 
-  buf = scan("beq $4, $0, 0x0");
-  bufTemp = true;
-  for (uint32_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
-  }
-  structureMeet = structureMeet || bufTemp;
+// One source of a batch and what became of it.
+struct BatchModule {
+  std::string input;
+  std::string output;
+  off_t size = 0;
+  std::string error; // empty if the module was assembled and written
+};
 
-  buf = scan("beq $4, $0, 1");
-  bufTemp = true;
-  for (uint32_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
+// Assembles one module of a batch with the calling thread's assembler.
+void assemble_module(BatchModule &module, Assembler &assembler,
+                     Assembler::AsmReturn &result, MerlFormat format) {
+  SourceFile source;
+  try {
+    source.map(module.input);
+  } catch (SourceFailure &f) {
+    module.error = f.what();
+    return;
   }
-  structureMeet = structureMeet || bufTemp;
-
-  if (!structureMeet)
-    return false;
-
-  bool instructionValid =
-      vecref[ind].getLexeme() == "beq" || vecref[ind].getLexeme() == "bne";
-  if (!instructionValid)
-    return false;
-  return true;
-}
-bool jr_jalr(uint32_t ind, std::vector<Token> &vecref) {
-
-  bool sizeMeet = (ind + 2 == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = vecref[ind].getKind() == Token::ID &&
-                       vecref[ind + 1].getKind() == Token::REG;
-  if (!structureMeet)
-    return false;
-  bool instructionValid =
-      vecref[ind].getLexeme() == "jr" || vecref[ind].getLexeme() == "jalr";
-  if (!instructionValid)
-    return false;
-  return true;
-}
-
-bool word(uint32_t ind, std::vector<Token> &vecref) {
-  vector<Token> buf = scan(".word i");
-  bool sizeMeet = (ind + buf.size() == vecref.size());
-  if (!sizeMeet)
-    return false;
-  bool structureMeet = false;
-  bool bufTemp = true;
-  for (size_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
+  // The batch is already spread over every thread.
+  Assembler::AsmOptions options;
+  options.threads = 1;
+  options.merl_format = format;
+  if (!assembler.assemble(source.text(), options, result)) {
+    module.error = result.error_message;
+    return;
   }
-  structureMeet = structureMeet || bufTemp;
-
-  buf = scan(".word 0x0");
-  bufTemp = true;
-  for (size_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
+  if (!write_output_file(module.output, result)) {
+    module.error = "ERROR: Cannot write output file: " + module.output + ": " +
+                   std::generic_category().message(errno);
   }
-  structureMeet = structureMeet || bufTemp;
-
-  buf = scan(".word 1");
-  bufTemp = true;
-  for (size_t i = 0; i < buf.size(); i++) {
-    bufTemp = bufTemp && (vecref[ind + i].getKind() == buf[i].getKind());
-  }
-  structureMeet = structureMeet || bufTemp;
-
-  bool instructionValid = vecref[ind].getKind() == Token::WORD;
-  if (!instructionValid)
-    return false;
-  return true;
 }
+
 /*
- * C++ Starter code for CS241 A3
- * All code requires C++14, so if you're getting compile errors make sure to
- * use -std=c++14.
- *
- * This file contains the main function of your program. By default, it just
- * prints the scanned list of tokens back to standard output.
+ * binasm --batch manifest: assembles every module listed in the manifest,
+ * one "input output" pair of paths per line (blank lines and lines starting
+ * with # are skipped), in a single process. Modules are shared out to a
+ * pool of threads, largest source first so that a big module does not
+ * start last; each thread keeps one Assembler and one result and reuses
+ * them for every module it takes. A module that fails is reported after
+ * the batch and does not stop the others. Returns the exit status.
  */
-public:
-struct AsmReturn{
-  std::vector<uint32_t> assembly_binary_code;
-  std::map<std::string, uint32_t> symbolTable;
-  std::map<std::string, vector<uint32_t>> lable_pc_map;
-  std::map<std::string, vector<uint32_t>> branch_reference_map;
-  std::vector<std::string> asm_files;
-  bool error = false;
-};
-void addSourceLine(const std::string &line) { asm_files.push_back(line); }
-void addImportedLabel(const std::string &label) { symbolTable[label] = 0; }
-AsmReturn assemble(uint32_t pc_start) {
-  AsmReturn ret;
-  std::vector<std::vector<Token>> assemblyProgram;
-  vector<string> instructions{"add",  "sub",  "mult", "multu", "div", "divu",
-                              "mfhi", "mflo", "lis",  "lw",    "sw",  "slt",
-                              "sltu", "beq",  "bne",  "jr",    "jalr"};
-
-  for (std::string file : asm_files) {
-    assemblyProgram.push_back(scan(file));
-  }
-  // You can add your own catch clause(s) for other kinds of errors.
-  // Throwing exceptions and catching them is the recommended way to
-  // handle errors and terminate the program cleanly in C++. Do not
-  // use the std::exit function, which may leak memory.
-
-  //__________________________________
-
-  uint32_t pc = pc_start;
-  for (std::vector<Token> line : assemblyProgram) {
-    if (line.empty())
-      continue;
-
-    uint32_t ind = 0;
-    // I CANNOT USE LOOPS OR ELSE I WOULD GET ERROR
-    /*
-    Not using the while loop I cannot have infinite lables infront of the
-    instruction
-
-    */
-    while (ind < line.size() && line[ind].getKind() == Token::LABEL) {
-      string buf = line[ind].getLexeme();
-      buf.resize(buf.size() - 1);
-      if (symbolTable.count(buf)) {
-        std::cerr << "ERROR: Duplicate Labels" << std::endl;
-        ret.error = true;
-        return ret;
-      }
-      symbolTable[buf] = pc;
-      ind++;
-    }
-    if (ind == line.size())
-      continue;
-    // at this point the following MUST be valid instructions if not then the
-    // code is invalid
-    bool found = lw_sw(ind, line) || mult_multu_div_divu(ind, line) ||
-                 mfhi_mflo_lis(ind, line) || beq_bne(ind, line) ||
-                 word(ind, line) || jr_jalr(ind, line) ||
-                 add_sub_slt_sltu(ind, line);
-
-    if (!found) {
-      std::cerr << "ERROR: Invalid instruction or parameters" << std::endl;
-      ret.error = true;
-      return ret;
-    } else {
-      pc += 4;
-    }
+int assemble_batch(const char *manifest_path, unsigned threads,
+                   MerlFormat format) {
+  SourceFile manifest;
+  try {
+    manifest.map(manifest_path);
+  } catch (SourceFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
   }
-
-  // ------------------------------------------------------------------------------------------------------------------
-  pc = pc_start;
-  for (std::vector<Token> line : assemblyProgram) {
-    if (line.empty())
-      continue;
-    uint32_t ind = 0;
-    while (ind < line.size() && line[ind].getKind() == Token::LABEL) {
-      ind++;
+  std::vector<BatchModule> modules;
+  size_t line_number = 0;
+  bool valid = true;
+  forEachLine(manifest.text(), [&](std::string_view line) {
+    line_number++;
+    if (!valid) {
+      return;
     }
-    // token is not a label
-    if (ind == line.size())
-      continue;
-    
-    // Increment PC BEFORE processing instruction
-    pc += 4;
-    uint32_t instr = 0;
-    
-    if (ind < line.size() && line[ind].getKind() == Token::WORD) {
-      ind++;
-      string str = line[ind].getLexeme();
-      if (line[ind].getKind() == Token::ID) {
-        if (symbolTable.count(str) == 0) {
-          std::cerr << "ERROR: Invalid Lablel:" << str << std::endl;
-          ret.error = true;
-          return ret;
-        }
-        instr = symbolTable[str];
-        // the string need the pc
-        lable_pc_map[str].push_back(pc);
-      } else {
-        instr = line[ind].toNumber();
-      }
-      /*
-      if (line[ind].getKind() == Token::INT && instr < 0)
-      {
-
-          std::cerr << "ERROR: No negative numbers for .word " << str <<
-      std::endl; return 1;
-      }
-      */
-      writebin(instr);
-    } else if (line[ind].getKind() == Token::ID) {
-
-      if (line[ind].getLexeme() == "jr") {
-        instr = line[ind + 1].toNumber();
-        jr(instr);
-      }
-      if (line[ind].getLexeme() == "jalr") {
-        instr = line[ind + 1].toNumber();
-        jalr(instr);
-      }
-      if (line[ind].getLexeme() == "add") {
-        uint32_t d = line[ind + 1].toNumber();
-        uint32_t s = line[ind + 3].toNumber();
-        uint32_t t = line[ind + 5].toNumber();
-        coutAdd(d, s, t);
-      }
-      if (line[ind].getLexeme() == "sub") {
-        uint32_t d = line[ind + 1].toNumber();
-        uint32_t s = line[ind + 3].toNumber();
-        uint32_t t = line[ind + 5].toNumber();
-        coutSub(d, s, t);
-      }
-      if (line[ind].getLexeme() == "slt") {
-        uint32_t d = line[ind + 1].toNumber();
-        uint32_t s = line[ind + 3].toNumber();
-        uint32_t t = line[ind + 5].toNumber();
-        coutSlt(d, s, t);
-      }
-      if (line[ind].getLexeme() == "sltu") {
-        uint32_t d = line[ind + 1].toNumber();
-        uint32_t s = line[ind + 3].toNumber();
-        uint32_t t = line[ind + 5].toNumber();
-        coutSltu(d, s, t);
-      }
-
-      // Question 6
-      if (line[ind].getLexeme() == "beq") {
-        uint32_t s = line[ind + 1].toNumber();
-        uint32_t t = line[ind + 3].toNumber();
-        uint32_t i = 0;
-        if (line[ind + 5].getKind() == Token::ID) {
-          if (symbolTable.count(line[ind + 5].getLexeme()) == 0) {
-            std::cerr << "ERROR: " << line[ind + 5].getLexeme()
-                      << " is an invalid token" << std::endl;
-            ret.error = true;
-            return ret;
-          }
-          i = symbolTable[line[ind + 5].getLexeme()] - pc;
-          i = i / 4;
-          // Track branch reference
-          branch_reference_map[line[ind + 5].getLexeme()].push_back(pc - 4);
-        } else {
-          i = line[ind + 5].toNumber();
-          if ((line[ind + 5].getKind() == Token::INT) &&
-              !(-32768 <= (int32_t)i && (int32_t)i <= 32767)) {
-            std::cerr << "ERROR: Step count out of range. must be -32768 <= i "
-                         "<= 32767"
-                      << std::endl;
-            ret.error = true;
-            return ret;
-          }
-          if ((line[ind + 5].getKind() == Token::HEXINT) && i > 0xffff) {
-            std::cerr << "ERROR: Step count out of range. must be i <= 0xffff"
-                      << std::endl;
-            ret.error = true;
-            return ret;
-          }
-        }
-        coutBeq(s, t, i);
-      }
-      if (line[ind].getLexeme() == "bne") {
-        uint32_t s = line[ind + 1].toNumber();
-        uint32_t t = line[ind + 3].toNumber();
-        uint32_t i = 0;
-        if (line[ind + 5].getKind() == Token::ID) {
-          if (symbolTable.count(line[ind + 5].getLexeme()) == 0) {
-            std::cerr << "ERROR: " << line[ind + 5].getLexeme()
-                      << " is an invalid token" << std::endl;
-            ret.error = true;
-            return ret;
-          }
-          i = symbolTable[line[ind + 5].getLexeme()] - pc;
-          i = i / 4;
-          // Track branch reference
-          branch_reference_map[line[ind + 5].getLexeme()].push_back(pc - 4);
-        } else {
-          i = line[ind + 5].toNumber();
-          if ((line[ind + 5].getKind() == Token::INT) &&
-              !(-32768 <= (int32_t)i && (int32_t)i <= 32767)) {
-            std::cerr << "ERROR: Step count out of range. must be -32768 <= i "
-                         "<= 32767"
-                      << std::endl;
-            ret.error = true;
-            return ret;
-          }
-          if ((line[ind + 5].getKind() == Token::HEXINT) && i > 0xffff) {
-            std::cerr << "ERROR: Step count out of range. must be i <= 0xffff"
-                      << std::endl;
-            ret.error = true;
-            return ret;
-          }
-        }
-        coutBne(s, t, i);
+    std::vector<std::string_view> fields;
+    size_t pos = 0;
+    for (;;) {
+      pos = line.find_first_not_of(" \t\r", pos);
+      if (pos == std::string_view::npos || line[pos] == '#') {
+        break;
       }
-      // Problem 7 ughhh completed?? Question 8
-      if (line[ind].getLexeme() == "lis") {
-        instr = line[ind + 1].toNumber();
-        lis(instr);
-      }
-      if (line[ind].getLexeme() == "mflo") {
-        instr = line[ind + 1].toNumber();
-        mflo(instr);
-      }
-      if (line[ind].getLexeme() == "mfhi") {
-        instr = line[ind + 1].toNumber();
-        mfhi(instr);
-      }
-    }
-    // Question 9
-    if (line[ind].getLexeme() == "mult") {
-      uint32_t s = line[ind + 1].toNumber();
-      uint32_t t = line[ind + 3].toNumber();
-      coutmult(s, t);
-    }
-    if (line[ind].getLexeme() == "multu") {
-      uint32_t s = line[ind + 1].toNumber();
-      uint32_t t = line[ind + 3].toNumber();
-      coutmultu(s, t);
+      size_t end = std::min(line.find_first_of(" \t\r", pos), line.size());
+      fields.push_back(line.substr(pos, end - pos));
+      pos = end;
     }
-    if (line[ind].getLexeme() == "div") {
-      uint32_t s = line[ind + 1].toNumber();
-      uint32_t t = line[ind + 3].toNumber();
-      coutdiv(s, t);
+    if (fields.empty()) {
+      return;
     }
-    if (line[ind].getLexeme() == "divu") {
-      uint32_t s = line[ind + 1].toNumber();
-      uint32_t t = line[ind + 3].toNumber();
-      coutdivu(s, t);
+    if (fields.size() != 2) {
+      std::cerr << "ERROR: " << manifest_path << ":" << line_number
+                << ": expected an input and an output path" << std::endl;
+      valid = false;
+      return;
     }
-    // Problem 10
-    if (line[ind].getLexeme() == "sw") {
-      uint32_t t = line[ind + 1].toNumber();
-      uint32_t i = line[ind + 3].toNumber();
-      uint32_t s = line[ind + 5].toNumber();
-      coutSw(t, i, s);
+    modules.push_back({std::string(fields[0]), std::string(fields[1])});
+  });
+  if (!valid) {
+    return 1;
+  }
+
+  std::vector<size_t> order(modules.size());
+  std::iota(order.begin(), order.end(), 0);
+  for (BatchModule &module : modules) {
+    struct stat info;
+    if (stat(module.input.c_str(), &info) == 0) {
+      module.size = info.st_size;
     }
-    if (line[ind].getLexeme() == "lw") {
-      uint32_t t = line[ind + 1].toNumber();
-      uint32_t i = line[ind + 3].toNumber();
-      uint32_t s = line[ind + 5].toNumber();
-      coutLw(t, i, s);
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return modules[a].size > modules[b].size;
+  });
+
+  auto start = std::chrono::steady_clock::now();
+  ThreadPool pool(threads);
+  std::vector<Assembler> assemblers(pool.size());
+  std::vector<Assembler::AsmReturn> results(pool.size());
+  pool.run(order.size(), [&](size_t i, unsigned thread) {
+    assemble_module(modules[order[i]], assemblers[thread], results[thread],
+                    format);
+  });
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  size_t failed = 0;
+  for (const BatchModule &module : modules) {
+    if (!module.error.empty()) {
+      std::cerr << module.input << ": " << module.error << std::endl;
+      failed++;
     }
   }
-  ret.assembly_binary_code = assembly_binary_code;
-  ret.symbolTable = symbolTable;
-  ret.lable_pc_map = lable_pc_map;
-  ret.branch_reference_map = branch_reference_map;
-  ret.asm_files = asm_files;
-  return ret;
-}
-vector<uint32_t> get_assembly_binary_code() {
-  return assembly_binary_code;
+  double seconds = elapsed.count();
+  std::cout << "Assembled " << modules.size() - failed << " of "
+            << modules.size() << " modules on " << pool.size()
+            << " threads in " << std::fixed << std::setprecision(3) << seconds
+            << " s (" << std::setprecision(1)
+            << (seconds > 0 ? modules.size() / seconds : 0.0)
+            << " modules/sec)" << std::endl;
+  return failed ? 1 : 0;
 }
-};
 
-void write_assembly_binary_code(uint32_t instr) {
-  unsigned char c = instr >> 24;
-  cout << c;
-  c = instr >> 16;
-  cout << c;
-  c = instr >> 8;
-  cout << c;
-  c = instr;
-  cout << c;
-}
-// struct REL_ENTRY
-struct REL_ENTRY {
-  uint32_t address;
-  REL_ENTRY(uint32_t address) : address(address) {}
-};
-// struct ESR_ENTRY
-struct ESR_ENTRY {
-  uint32_t address;
-  std::string label;
-  ESR_ENTRY(uint32_t address, std::string label)
-      : address(address), label(label) {}
-};
-// struct ESD_ENTRY
-struct ESD_ENTRY {
-  uint32_t address;
-  std::string label;
-  ESD_ENTRY(uint32_t address, std::string label)
-      : address(address), label(label) {}
-};
-
-vector<uint32_t>
-get_entries_binary(std::set<std::string> export_lables,
-                   std::set<std::string> import_lables,
-                   std::map<std::string, uint32_t> symbolTable,
-                   std::map<std::string, vector<uint32_t>> lable_pc_map) {
-  // print the tables to cerr
-  // vector<uint32_t> rel_enteries;
-  // ESR entries
-  // vector<uint32_t> esr_entries;
-  vector<REL_ENTRY> rel_enteries;
-  vector<ESR_ENTRY> esr_entries;
-  vector<ESD_ENTRY> esd_entries;
-  // for each export
-  for (auto const &x : export_lables) {
-    esd_entries.push_back(ESD_ENTRY{symbolTable[x], x});
+/*
+ * binasm --stream: assembles the source in one pass with
+ * Assembler::assembleStream, writing the output file as it goes. With the
+ * default output name a module is stored as output.merl, as binasm names
+ * it otherwise. Returns the exit status.
+ */
+int assemble_stream(const std::string &output_filename,
+                    const char *input_filename,
+                    const Assembler::AsmOptions &options) {
+  int in = input_filename ? open(input_filename, O_RDONLY) : 0;
+  if (in < 0) {
+    std::cerr << "ERROR: Cannot open input file: " << input_filename << ": "
+              << std::strerror(errno) << std::endl;
+    return 1;
   }
-  for (auto const &x : lable_pc_map) {
-
-    for (uint32_t pc : x.second) {
-      if (import_lables.count(x.first) == 0) {
-        rel_enteries.push_back(REL_ENTRY{pc});
-      } else {
-        esr_entries.push_back(ESR_ENTRY{pc, x.first});
-      }
+  // The output goes to a file beside it that is renamed into place only
+  // once it is complete, so a failed run leaves an earlier output alone.
+  // Anything but a regular file, such as /dev/stdout, is written directly.
+  struct stat st;
+  const bool direct =
+      stat(output_filename.c_str(), &st) == 0 && !S_ISREG(st.st_mode);
+  const std::string partial =
+      direct ? output_filename : output_filename + ".tmp";
+  int out = open(partial.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (out < 0) {
+    std::cerr << "ERROR: Cannot write output file: " << partial << ": "
+              << std::strerror(errno) << std::endl;
+    if (input_filename) {
+      close(in);
     }
+    return 1;
   }
-  vector<uint32_t> entries_binary;
-  for (auto const &x : rel_enteries) {
-    std::cerr << "Rel entry: " << x.address << endl;
-    entries_binary.push_back(0x00000001);
-    entries_binary.push_back(x.address);
+  Assembler assembler;
+  Assembler::StreamStats stats;
+  std::string message;
+  bool assembled = assembler.assembleStream(in, out, options, stats, message);
+  if (input_filename) {
+    close(in);
   }
-  for (auto const &x : esr_entries) {
-    entries_binary.push_back(0x00000011);
-    entries_binary.push_back(x.address);
-    entries_binary.push_back(x.label.length());
-    for (char c : x.label) {
-      entries_binary.push_back(c);
-    }
+  if (close(out) != 0 && assembled) {
+    message = "ERROR: Cannot write output file: " + partial + ": " +
+              std::strerror(errno);
+    assembled = false;
   }
-  for (auto const &x : esd_entries) {
-    entries_binary.push_back(0x00000005);
-    entries_binary.push_back(x.address);
-    entries_binary.push_back(x.label.length());
-    for (char c : x.label) {
-      entries_binary.push_back(c);
-    }
+  // A module written to the default name goes to output.merl instead.
+  std::string path = output_filename;
+  if (stats.merl_module && path == "output.bin") {
+    path = "output.merl";
   }
-  // print the entries_binary
-  std::cerr << "Entries binary: " << endl;
-  for (uint32_t entry : entries_binary) {
-    std::cerr << "0x" << hex << entry << endl;
+  if (assembled && !direct && std::rename(partial.c_str(), path.c_str()) != 0) {
+    message = "ERROR: Cannot write output file: " + path + ": " +
+              std::strerror(errno);
+    assembled = false;
   }
-  std::cerr << endl;
-  return entries_binary;
-}
-vector<uint32_t> get_merl_file(vector<uint32_t> assembly_binary_code, vector<uint32_t> entries_binary) {
-  // get the cookie
-  uint32_t cookie = 0x10000002;
-  // get the end of file
-  uint32_t end_of_code = assembly_binary_code.size() * 4 + 12;
-  uint32_t end_of_file = entries_binary.size() * 4 + end_of_code;
-  // print the assembly_binary_code
-
-  vector<uint32_t> merl_file;
-  merl_file.push_back(cookie);
-  merl_file.push_back(end_of_file);
-  merl_file.push_back(end_of_code);
-  merl_file.insert(merl_file.end(), assembly_binary_code.begin(),
-                   assembly_binary_code.end());
-  merl_file.insert(merl_file.end(), entries_binary.begin(),
-                   entries_binary.end());
-  // print the merl_file
-
-  // print the merl_file
-  std::cerr << "Merl file: " << endl;
-  for (uint32_t entry : merl_file) {
-    std::cerr << "0x" << hex << entry << endl;
+  if (!assembled) {
+    if (!direct) {
+      unlink(partial.c_str());
+    }
+    std::cerr << message << std::endl;
+    return 1;
   }
-  std::cerr << endl;
-
-  return merl_file;
+  Diagnostics &diag = diagnostics();
+  if (diag.enabled(DIAG_IMAGE, DIAG_INFO)) {
+    diag.out() << "Streamed " << stats.lines << " lines into "
+               << (stats.merl_module ? "MERL" : "binary") << " file " << path << ": "
+               << stats.words << " words, " << stats.symbols << " symbols, "
+               << stats.fixups << " forward references (at most "
+               << stats.peakFixups << " waiting, " << stats.latePatches
+               << " filled in after being written)" << '\n';
+  }
+  return 0;
 }
 
-
-
 int main(int argc, char* argv[]) {
   Assembler assembler;
-  // import lable from .import make set
-  std::set<std::string> import_lables;
-  // export lable from .export make set
-  std::set<std::string> export_lables;
   string file_suffix = ".bin";
-  uint32_t pc_start = 0;
   
-  // Get output filename from command line argument
+  // Command line: binasm [options] [output [input]]
+  //               binasm [-j N] --batch manifest
+  // Without an input path the source is read from standard input.
+  //   -v, -vv, -vvv     diagnostics at info, debug or trace level
+  //   --diag=LIST       only these categories: scanner, symbols,
+  //                     relocations, image (default: all)
+  //   -j N, --threads=N threads to work on (default: one per core)
+  //   --batch manifest  assemble each "input output" pair in manifest;
+  //                     diagnostics are not produced for batches
+  //   --cache file      reassemble incrementally, keeping what is known
+  //                     about every line in file between runs
+  //   --merl-v2         write modules in the MERL v2 format (see merl.h)
+  //   --merl-packed     the same, with the REL records packed into one
+  //   --stream          assemble in one pass, writing the output as the
+  //                     source is read (see Assembler::assembleStream)
   std::string output_filename = "output.bin";
-  if (argc >= 2) {
-    output_filename = argv[1];
-  }
-  try {
-    std::string line;
-    while (getline(std::cin, line)) {
-      // Tokenize each input line and treat .import/.export as commands
-      std::vector<Token> toks;
-      try {
-        toks = scan(line);
-      } catch (ScanningFailure &f) {
-        std::cerr << f.what() << std::endl;
+  const char *input_filename = nullptr;
+  const char *manifest_filename = nullptr;
+  const char *cache_filename = nullptr;
+  bool stream = false;
+  DiagLevel diag_level = DIAG_SILENT;
+  unsigned diag_categories = DIAG_ALL;
+  Assembler::AsmOptions options;
+  options.threads = 0;
+  int positional = 0;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "-v" || arg == "-vv" || arg == "-vvv") {
+      diag_level = static_cast<DiagLevel>(arg.size() - 1);
+    } else if (arg.substr(0, 7) == "--diag=") {
+      if (!parseDiagCategories(arg.substr(7), diag_categories)) {
+        std::cerr << "ERROR: Unknown diagnostic category in: " << arg
+                  << std::endl;
         return 1;
       }
-      if (!toks.empty()) {
-        if (toks[0].getKind() == Token::IMPORT) {
-          if (toks.size() >= 2 && toks[1].getKind() == Token::ID) {
-            std::string label = toks[1].getLexeme();
-            import_lables.insert(label);
-            assembler.addImportedLabel(label);
-            file_suffix = ".merl";
-            pc_start = 0xc;
-            // Update output filename to .merl if not already set
-            if (output_filename == "output.bin") {
-              output_filename = "output.merl";
-            }
-            continue;
-          }
-        } else if (toks[0].getKind() == Token::EXPORT) {
-          if (toks.size() >= 2 && toks[1].getKind() == Token::ID) {
-            std::string label = toks[1].getLexeme();
-            export_lables.insert(label);
-            file_suffix = ".merl";
-            pc_start = 0xc;
-            // Update output filename to .merl if not already set
-            if (output_filename == "output.bin") {
-              output_filename = "output.merl";
-            }
-            continue;
-          }
-        }
+    } else if (arg == "-j" || arg.substr(0, 10) == "--threads=") {
+      std::string_view count =
+          arg == "-j" ? (i + 1 < argc ? argv[++i] : "") : arg.substr(10);
+      char *end = nullptr;
+      std::string digits(count);
+      unsigned long threads = std::strtoul(digits.c_str(), &end, 10);
+      if (digits.empty() || *end != '\0' || threads > 1024) {
+        std::cerr << "ERROR: Invalid thread count: " << count << std::endl;
+        return 1;
+      }
+      options.threads = static_cast<unsigned>(threads);
+    } else if (arg == "--batch") {
+      if (i + 1 == argc) {
+        std::cerr << "ERROR: --batch needs a manifest file" << std::endl;
+        return 1;
+      }
+      manifest_filename = argv[++i];
+    } else if (arg == "--cache") {
+      if (i + 1 == argc) {
+        std::cerr << "ERROR: --cache needs a cache file" << std::endl;
+        return 1;
       }
-      // Not an import/export directive: treat as assembly source
-      assembler.addSourceLine(line);
+      cache_filename = argv[++i];
+    } else if (arg == "--stream") {
+      stream = true;
+    } else if (arg == "--merl-v2") {
+      options.merl_format = MERL_V2;
+    } else if (arg == "--merl-packed") {
+      options.merl_format = MERL_V2_PACKED;
+    } else if (!arg.empty() && arg[0] == '-') {
+      std::cerr << "ERROR: Unknown option: " << arg << std::endl;
+      std::cerr << "Usage: binasm [options] [output [input]]" << std::endl
+                << "       binasm [-j N] --batch manifest" << std::endl;
+      return 1;
+    } else if (positional == 0) {
+      output_filename = argv[i];
+      positional++;
+    } else if (positional == 1) {
+      input_filename = argv[i];
+      positional++;
+    } else {
+      std::cerr << "ERROR: Unexpected argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (stream && (manifest_filename || cache_filename)) {
+    std::cerr << "ERROR: --stream cannot be used with --batch or --cache"
+              << std::endl;
+    return 1;
+  }
+  if (manifest_filename) {
+    if (positional != 0) {
+      std::cerr << "ERROR: --batch takes its paths from the manifest"
+                << std::endl;
+      return 1;
     }
-  } catch (ScanningFailure &f) {
+    return assemble_batch(manifest_filename,
+                          options.threads ? options.threads
+                                          : defaultThreadCount(),
+                          options.merl_format);
+  }
+  diagnostics().configure(diag_level, diag_categories);
+  if (stream) {
+    return assemble_stream(output_filename, input_filename, options);
+  }
+  // Holds the whole source; every line and token refers into it.
+  SourceFile source;
+  try {
+    if (input_filename) {
+      source.map(input_filename);
+    } else {
+      source.read(0);
+    }
+  } catch (SourceFailure &f) {
     std::cerr << f.what() << std::endl;
     return 1;
   }
-  Assembler::AsmReturn result = assembler.assemble(pc_start);
-  if (result.error) return 1;
-  
-  // Debug output for branch references
-  std::cerr << "Branch Reference Map:" << std::endl;
-  for (const auto& entry : result.branch_reference_map) {
-    std::cerr << "  " << entry.first << ": ";
-    for (uint32_t pc : entry.second) {
-      std::cerr << "0x" << std::hex << pc << " ";
+  Assembler::AsmReturn result;
+  Assembler::IncrementalStats stats;
+  LineCache cache;
+  bool assembled;
+  if (cache_filename) {
+    // A missing or unreadable cache just means every line is scanned.
+    cache.load(cache_filename);
+    assembled = assembler.assembleIncremental(source.text(), options, cache,
+                                              result, stats);
+  } else {
+    assembled = assembler.assemble(source.text(), options, result);
+  }
+  if (!assembled) {
+    std::cerr << result.error_message << std::endl;
+    return 1;
+  }
+  if (result.merl_module) {
+    file_suffix = ".merl";
+    // Update output filename to .merl if not already set
+    if (output_filename == "output.bin") {
+      output_filename = "output.merl";
+    }
+  }
+
+  Diagnostics &diag = diagnostics();
+  // Every byte of the source outside of line breaks is scanned exactly once.
+  if (diag.enabled(DIAG_SCANNER, DIAG_INFO)) {
+    diag.out() << "Scanned " << std::dec << scannedByteCount()
+               << " bytes from a " << source.text().size() << " byte source"
+               << '\n';
+  }
+
+  if (diag.enabled(DIAG_SYMBOLS, DIAG_DEBUG)) {
+    std::ostream &out = diag.out();
+    out << "Symbol table:" << '\n';
+    std::vector<uint32_t> defined;
+    for (uint32_t id = 0; id < result.symbolTable.size(); id++) {
+      if (result.symbolTable[id].defined) {
+        defined.push_back(id);
+      }
+    }
+    std::sort(defined.begin(), defined.end(), [&](uint32_t a, uint32_t b) {
+      return result.symbols.name(a) < result.symbols.name(b);
+    });
+    for (uint32_t id : defined) {
+      out << "  " << result.symbols.name(id) << ": 0x" << std::hex
+          << result.symbolTable[id].address
+          << (result.symbolTable[id].imported ? " (imported)" : "") << '\n';
+    }
+    out << '\n';
+
+    out << "Branch Reference Map:" << '\n';
+    std::vector<SymbolReference> branches =
+        sortedByName(result.branch_references, result.symbols);
+    for (size_t i = 0; i < branches.size(); i++) {
+      if (i == 0 || branches[i].symbol != branches[i - 1].symbol) {
+        if (i != 0) {
+          out << '\n';
+        }
+        out << "  " << result.symbols.name(branches[i].symbol) << ": ";
+      }
+      out << "0x" << std::hex << branches[i].pc << " ";
+    }
+    if (!branches.empty()) {
+      out << '\n';
     }
-    std::cerr << std::endl;
+    out << '\n';
   }
-  std::cerr << std::endl;
   
-  // Write output to file
-  std::ofstream outfile(output_filename, std::ios::binary);
-  if (!outfile) {
-    std::cerr << "ERROR: Cannot open output file: " << output_filename << std::endl;
+  if (file_suffix == ".merl" && diag.enabled(DIAG_IMAGE, DIAG_TRACE)) {
+    print_merl_file(
+        {WordSpan(result.merl_header.data(), result.merl_header.size()),
+         result.assembly_binary_code, result.entries_binary});
+  }
+  // Write output to file, in big-endian format
+  if (!write_output_file(output_filename, result)) {
+    std::cerr << "ERROR: Cannot write output file: " << output_filename
+              << ": " << std::strerror(errno) << std::endl;
     return 1;
   }
-  
-  if (file_suffix == ".merl") {
-    // Generate MERL file
-    vector<uint32_t> entries_binary = get_entries_binary(export_lables, import_lables, result.symbolTable, result.lable_pc_map);
-    vector<uint32_t> merl_file = get_merl_file(result.assembly_binary_code, entries_binary);
-    
-    // Write MERL file in big-endian format
-    for (uint32_t word : merl_file) {
-      unsigned char c = word >> 24;
-      outfile << c;
-      c = word >> 16;
-      outfile << c;
-      c = word >> 8;
-      outfile << c;
-      c = word;
-      outfile << c;
+  if (diag.enabled(DIAG_IMAGE, DIAG_INFO)) {
+    diag.out() << "Wrote " << (file_suffix == ".merl" ? "MERL" : "binary")
+               << " file " << output_filename << '\n';
+  }
+  if (cache_filename) {
+    // An unchanged source leaves the cache as it was.
+    bool unchanged = !stats.full && stats.reused == stats.lines &&
+                     stats.relinked == 0;
+    if (!unchanged && !cache.save(cache_filename)) {
+      std::cerr << "ERROR: Cannot write cache file: " << cache_filename
+                << ": " << std::strerror(errno) << std::endl;
+      return 1;
     }
-  } else {
-    // Write binary file in big-endian format
-    for (uint32_t word : result.assembly_binary_code) {
-      unsigned char c = word >> 24;
-      outfile << c;
-      c = word >> 16;
-      outfile << c;
-      c = word >> 8;
-      outfile << c;
-      c = word;
-      outfile << c;
+    if (stats.full) {
+      std::cout << "Scanned all " << stats.lines
+                << " lines (no usable cache)" << std::endl;
+    } else {
+      std::cout << "Reused " << stats.reused << " of " << stats.lines
+                << " lines (" << stats.lines - stats.reused << " scanned, "
+                << stats.relinked << " relinked)" << std::endl;
     }
   }
-  
-  outfile.close();
   return 0;
 }
\ No newline at end of file
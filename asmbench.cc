@@ -0,0 +1,339 @@
+#include "assembler.h"
+#include "generator.h"
+#include "scanner.h"
+#include "sourcefile.h"
+#include "wordio.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+ * asmbench: times each phase of the assembler on fixed corpora.
+ *
+ * Every corpus is assembled once to warm up and then --runs more times by
+ * one Assembler into one result, the way --batch reuses them. Each run is
+ * timed phase by phase: scan, pass 1, pass 2 and the MERL records (timed
+ * inside Assembler::assemble through AsmOptions::phase_done), then the
+ * output image (imageWords and copyImage, what writing the file costs
+ * before the write itself). For each phase the median and the 10th and
+ * 90th percentile times are reported, with the median in ns per line, tokens
+ * per second and MB of source per second, and the number of allocations
+ * and bytes allocated in the median run.
+ *
+ * Each corpus is then scanned on its own, without interning names, every
+ * line through scan() into a reused TokenArena and through the scan() that
+ * returns a vector per line, timed and with its allocations counted the
+ * same way. Last, a 100 MB image is written with writeBigEndian() to
+ * /dev/null and to a file, and its words byte-swapped in memory, and the
+ * median MB/s of each is reported.
+ *
+ * The corpora are generated (see generator.h) with fixed options and seed,
+ * so numbers from different builds compare; files named on the command line
+ * are used instead, and the image is then not written.
+ */
+
+// Every allocation in the process, counted by the operator new below.
+static std::atomic<uint64_t> allocations{0};
+static std::atomic<uint64_t> allocatedBytes{0};
+
+void *operator new(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+struct Corpus {
+  std::string name;
+  std::string text;
+};
+
+// One phase's measurements, a run at a time.
+struct PhaseRuns {
+  const char *name;
+  std::vector<double> seconds;
+  std::vector<uint64_t> allocations;
+  std::vector<uint64_t> bytes;
+};
+
+double percentile(std::vector<double> values, double p) {
+  std::sort(values.begin(), values.end());
+  return values[static_cast<size_t>(p * (values.size() - 1) + 0.5)];
+}
+
+void printHeader(const char *title) {
+  std::printf("  %-8s %9s %9s %9s %9s %10s %9s %9s %10s\n", title,
+              "median ms", "p10 ms", "p90 ms", "ns/line", "Mtokens/s",
+              "MB/s", "allocs", "alloc MB");
+}
+
+void printPhase(const PhaseRuns &phase, size_t lines, size_t tokens,
+                double megabytes) {
+  const double median = percentile(phase.seconds, 0.5);
+  // The allocations of the run with the median time.
+  const size_t run = std::find(phase.seconds.begin(), phase.seconds.end(),
+                               median) -
+                     phase.seconds.begin();
+  std::printf("  %-8s %9.3f %9.3f %9.3f %9.1f ", phase.name, median * 1e3,
+              percentile(phase.seconds, 0.1) * 1e3,
+              percentile(phase.seconds, 0.9) * 1e3, median * 1e9 / lines);
+  // Rates mean nothing for phases with next to nothing to do.
+  if (median >= 1e-5) {
+    std::printf("%10.1f %9.1f", tokens / median / 1e6, megabytes / median);
+  } else {
+    std::printf("%10s %9s", "-", "-");
+  }
+  std::printf(" %9llu %10.2f\n",
+              static_cast<unsigned long long>(phase.allocations[run]),
+              phase.bytes[run] / 1e6);
+}
+
+// Times f and counts what it allocates, adding one run to phase.
+template <typename F> void measure(PhaseRuns &phase, F &&f) {
+  const uint64_t count = allocations.load(std::memory_order_relaxed);
+  const uint64_t size = allocatedBytes.load(std::memory_order_relaxed);
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const auto end = std::chrono::steady_clock::now();
+  // Read before the results are stored, which may allocate.
+  const uint64_t endCount = allocations.load(std::memory_order_relaxed);
+  const uint64_t endSize = allocatedBytes.load(std::memory_order_relaxed);
+  phase.seconds.push_back(std::chrono::duration<double>(end - start).count());
+  phase.allocations.push_back(endCount - count);
+  phase.bytes.push_back(endSize - size);
+}
+
+void benchScan(const Corpus &corpus, size_t lines, size_t tokens,
+               unsigned runs) {
+  PhaseRuns arena{"arena"}, vector{"vector"};
+  TokenArena arenaTokens;
+  size_t vectorTokens = 0;
+  for (unsigned run = 0; run <= runs; run++) {
+    PhaseRuns scratch{""};
+    measure(run ? arena : scratch, [&] {
+      arenaTokens.clear();
+      forEachLine(corpus.text, [&](std::string_view line) {
+        scan(line, arenaTokens);
+      });
+    });
+    measure(run ? vector : scratch, [&] {
+      vectorTokens = 0;
+      forEachLine(corpus.text, [&](std::string_view line) {
+        vectorTokens += scan(line).size();
+      });
+    });
+  }
+  if (arenaTokens.tokens() != tokens || vectorTokens != tokens) {
+    std::cerr << corpus.name << ": the scanners found different tokens"
+              << std::endl;
+  }
+  printHeader("scan");
+  printPhase(arena, lines, tokens, corpus.text.size() / 1e6);
+  printPhase(vector, lines, tokens, corpus.text.size() / 1e6);
+}
+
+/*
+ * Writes an image of words bytes, as the output stage writes a program:
+ * byte-swapped in blocks and written with writeBigEndian(). Reports the
+ * median MB/s of swapping the image in place, of writing it to /dev/null,
+ * which is the swap and the write calls, and of writing it to a file, which
+ * adds the page cache.
+ */
+void benchOutput(size_t words, unsigned runs) {
+  std::vector<uint32_t> image(words);
+  for (size_t i = 0; i < words; i++) {
+    image[i] = static_cast<uint32_t>(i * 2654435761u);
+  }
+  const char *tmp = std::getenv("TMPDIR");
+  std::string path = std::string(tmp && *tmp ? tmp : "/tmp") +
+                     "/asmbench.XXXXXX";
+  int file = mkstemp(&path[0]);
+  int null = open("/dev/null", O_WRONLY);
+  if (file < 0 || null < 0) {
+    std::cerr << "ERROR: Cannot open output for the image benchmark"
+              << std::endl;
+    return;
+  }
+  PhaseRuns swap{"swap"}, devnull{"/dev/null"}, disk{"file"};
+  bool ok = true;
+  for (unsigned run = 0; run <= runs && ok; run++) {
+    PhaseRuns scratch{""};
+    measure(run ? swap : scratch,
+            [&] { swapWords(image.data(), image.data(), words); });
+    measure(run ? devnull : scratch,
+            [&] { ok = ok && writeBigEndian(null, {image}); });
+    ok = ok && ftruncate(file, 0) == 0 && lseek(file, 0, SEEK_SET) == 0;
+    measure(run ? disk : scratch,
+            [&] { ok = ok && writeBigEndian(file, {image}); });
+  }
+  close(null);
+  close(file);
+  unlink(path.c_str());
+  if (!ok) {
+    std::cerr << "ERROR: Cannot write the image benchmark's output"
+              << std::endl;
+    return;
+  }
+  const double megabytes = words * 4 / 1e6;
+  std::printf("image (%.0f MB), %u runs\n", megabytes, runs);
+  std::printf("  %-9s %9s %9s %9s %9s\n", "output", "median ms", "p10 ms",
+              "p90 ms", "MB/s");
+  for (const PhaseRuns *phase : {&swap, &devnull, &disk}) {
+    const double median = percentile(phase->seconds, 0.5);
+    std::printf("  %-9s %9.3f %9.3f %9.3f %9.1f\n", phase->name,
+                median * 1e3, percentile(phase->seconds, 0.1) * 1e3,
+                percentile(phase->seconds, 0.9) * 1e3, megabytes / median);
+  }
+}
+
+void bench(const Corpus &corpus, unsigned runs, unsigned threads) {
+  size_t lines = 0, tokens = 0;
+  forEachLine(corpus.text, [&](std::string_view line) {
+    lines++;
+    tokens += scan(line).size();
+  });
+  const double megabytes = corpus.text.size() / 1e6;
+
+  enum { kPhases = 6 };
+  PhaseRuns phases[kPhases] = {{"scan"},    {"pass 1"}, {"pass 2"},
+                               {"records"}, {"image"},  {"total"}};
+  using Clock = std::chrono::steady_clock;
+  Clock::time_point marks[kPhases];
+  uint64_t counts[kPhases], sizes[kPhases];
+  int reached = 0;
+  auto mark = [&](int phase) {
+    marks[phase] = Clock::now();
+    counts[phase] = allocations.load(std::memory_order_relaxed);
+    sizes[phase] = allocatedBytes.load(std::memory_order_relaxed);
+    reached = phase + 1;
+  };
+
+  Assembler assembler;
+  Assembler::AsmReturn result;
+  Assembler::AsmOptions options;
+  options.threads = threads;
+  options.phase_done = [&](AsmPhase phase) { mark(phase); };
+  std::vector<uint32_t> image;
+  for (unsigned run = 0; run <= runs; run++) {
+    const Clock::time_point start = Clock::now();
+    const uint64_t startCount = allocations.load(std::memory_order_relaxed);
+    const uint64_t startSize = allocatedBytes.load(std::memory_order_relaxed);
+    if (!assembler.assemble(corpus.text, options, result)) {
+      std::cerr << corpus.name << ": " << result.error_message << std::endl;
+      return;
+    }
+    image.resize(imageWords(result));
+    copyImage(result, image.data());
+    mark(PHASE_RECORDS + 1);
+    if (run == 0) {
+      continue; // warming up
+    }
+    for (int phase = 0; phase < reached; phase++) {
+      const Clock::time_point from = phase ? marks[phase - 1] : start;
+      phases[phase].seconds.push_back(
+          std::chrono::duration<double>(marks[phase] - from).count());
+      phases[phase].allocations.push_back(counts[phase] -
+                                          (phase ? counts[phase - 1]
+                                                 : startCount));
+      phases[phase].bytes.push_back(sizes[phase] -
+                                    (phase ? sizes[phase - 1] : startSize));
+    }
+    PhaseRuns &total = phases[kPhases - 1];
+    total.seconds.push_back(
+        std::chrono::duration<double>(marks[reached - 1] - start).count());
+    total.allocations.push_back(counts[reached - 1] - startCount);
+    total.bytes.push_back(sizes[reached - 1] - startSize);
+  }
+
+  std::printf("%s: %zu lines, %zu tokens, %.1f MB, %u runs, %u thread%s\n",
+              corpus.name.c_str(), lines, tokens, megabytes, runs,
+              threads, threads == 1 ? "" : "s");
+  printHeader("phase");
+  for (const PhaseRuns &phase : phases) {
+    printPhase(phase, lines, tokens, megabytes);
+  }
+  benchScan(corpus, lines, tokens, runs);
+}
+
+int main(int argc, char *argv[]) {
+  // Command line: asmbench [options] [source...]
+  //   --runs=N          timed runs per corpus (default: 11)
+  //   -j N, --threads=N threads to assemble with (default: 1)
+  // Without sources, benchmarks the built-in corpora.
+  unsigned runs = 11, threads = 1;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "-j" || arg.substr(0, 10) == "--threads=" ||
+        arg.substr(0, 7) == "--runs=") {
+      const bool isRuns = arg.substr(0, 7) == "--runs=";
+      std::string_view count =
+          arg == "-j" ? (i + 1 < argc ? argv[++i] : "")
+                      : arg.substr(isRuns ? 7 : 10);
+      char *end = nullptr;
+      std::string digits(count);
+      unsigned long n = std::strtoul(digits.c_str(), &end, 10);
+      if (digits.empty() || *end != '\0' || n < 1 ||
+          n > (isRuns ? 100000 : 1024)) {
+        std::cerr << "ERROR: Invalid " << (isRuns ? "run" : "thread")
+                  << " count: " << count << std::endl;
+        return 1;
+      }
+      (isRuns ? runs : threads) = static_cast<unsigned>(n);
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+
+  std::vector<Corpus> corpora;
+  if (paths.empty()) {
+    GeneratorOptions program;
+    program.lines = 1000000;
+    corpora.push_back({"program (1M lines)", generateProgram(program)});
+    // Nothing but .words and branches, the lines whose operand checks
+    // pass 1 spends its time on.
+    GeneratorOptions checks;
+    checks.lines = 1000000;
+    checks.arithmetic = checks.multiply = checks.move = checks.memory = 0;
+    checks.jump = checks.lis = 0;
+    checks.branch = checks.word = 50;
+    corpora.push_back({"words and branches (1M lines)",
+                       generateProgram(checks)});
+    // A module also has REL, ESR and ESD records.
+    GeneratorOptions module;
+    module.lines = 300000;
+    module.imports = 64;
+    module.exports = 64;
+    corpora.push_back({"module (300K lines)", generateProgram(module)});
+  }
+  for (const std::string &path : paths) {
+    SourceFile file;
+    try {
+      file.map(path);
+    } catch (SourceFailure &f) {
+      std::cerr << f.what() << std::endl;
+      return 1;
+    }
+    corpora.push_back({path, std::string(file.text())});
+  }
+  for (const Corpus &corpus : corpora) {
+    bench(corpus, runs, threads);
+  }
+  if (paths.empty()) {
+    benchOutput(25000000, runs);
+  }
+  return 0;
+}
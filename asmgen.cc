@@ -0,0 +1,155 @@
+#include "generator.h"
+#include "wordio.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+ * asmgen: writes a synthetic assembly program for benchmarks and stress
+ * tests (see generator.h). The same options always give the same program.
+ */
+
+// Parses digits as a whole number no larger than limit.
+bool parse_count(std::string_view digits, unsigned long long limit,
+                 unsigned long long &value) {
+  std::string text(digits);
+  char *end = nullptr;
+  errno = 0;
+  value = std::strtoull(text.c_str(), &end, 10);
+  return !text.empty() && text[0] >= '0' && text[0] <= '9' && *end == '\0' &&
+         errno == 0 && value <= limit;
+}
+
+// Parses text as a share between 0 and 1.
+bool parse_share(std::string_view text, double &value) {
+  std::string copy(text);
+  char *end = nullptr;
+  value = std::strtod(copy.c_str(), &end);
+  return !copy.empty() && *end == '\0' && value >= 0 && value <= 1;
+}
+
+/* Parses an instruction mix, a comma-separated list of kind:weight pairs,
+ * into options. Kinds not listed keep their weights.
+ */
+bool parse_mix(std::string_view list, GeneratorOptions &options) {
+  struct Kind {
+    const char *name;
+    unsigned GeneratorOptions::*weight;
+  };
+  static const Kind kinds[] = {
+      {"arithmetic", &GeneratorOptions::arithmetic},
+      {"multiply", &GeneratorOptions::multiply},
+      {"move", &GeneratorOptions::move},
+      {"memory", &GeneratorOptions::memory},
+      {"branch", &GeneratorOptions::branch},
+      {"jump", &GeneratorOptions::jump},
+      {"lis", &GeneratorOptions::lis},
+      {"word", &GeneratorOptions::word}};
+  while (!list.empty()) {
+    const size_t comma = list.find(',');
+    std::string_view item = list.substr(0, comma);
+    list = comma == std::string_view::npos ? "" : list.substr(comma + 1);
+    const size_t colon = item.find(':');
+    unsigned long long weight;
+    if (colon == std::string_view::npos ||
+        !parse_count(item.substr(colon + 1), 1000000, weight)) {
+      return false;
+    }
+    const Kind *kind = nullptr;
+    for (const Kind &k : kinds) {
+      if (item.substr(0, colon) == k.name) {
+        kind = &k;
+      }
+    }
+    if (!kind) {
+      return false;
+    }
+    options.*(kind->weight) = static_cast<unsigned>(weight);
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  // Command line: asmgen [options] [output]
+  //   --lines=N            lines of code (default: 1000)
+  //   --seed=N             seed of the random numbers (default: 1)
+  //   --mix=KIND:W,...     weights of arithmetic, multiply, move, memory,
+  //                        branch, jump, lis and word lines
+  //   --labels=P           chance of a label on any line (default: 0.1)
+  //   --distance=geometric:MEAN or uniform:MAX
+  //                        branch distances in lines (default: geometric:16)
+  //   --backward=P         share of branches that go back (default: 0.5)
+  //   --imports=N          symbols to import
+  //   --exports=N          lines to export
+  //   --comments=P         share of lines with a comment (default: 0.1)
+  // Without an output path the program goes to standard output.
+  GeneratorOptions options;
+  const char *output = nullptr;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    const size_t equals = arg.find('=');
+    std::string_view name = arg.substr(0, equals);
+    std::string_view value =
+        equals == std::string_view::npos ? "" : arg.substr(equals + 1);
+    unsigned long long n = 0;
+    bool ok = true;
+    if (name == "--lines") {
+      ok = parse_count(value, 1ull << 40, n);
+      options.lines = n;
+    } else if (name == "--seed") {
+      ok = parse_count(value, UINT64_MAX, n);
+      options.seed = n;
+    } else if (name == "--mix") {
+      ok = parse_mix(value, options);
+    } else if (name == "--labels") {
+      ok = parse_share(value, options.label_density);
+    } else if (name == "--distance") {
+      const size_t colon = value.find(':');
+      std::string_view kind = value.substr(0, colon);
+      ok = colon != std::string_view::npos &&
+           (kind == "geometric" || kind == "uniform") &&
+           parse_count(value.substr(colon + 1), 32767, n);
+      options.distribution = kind == "uniform" ? GeneratorOptions::UNIFORM
+                                               : GeneratorOptions::GEOMETRIC;
+      options.distance = static_cast<unsigned>(n);
+    } else if (name == "--backward") {
+      ok = parse_share(value, options.backward);
+    } else if (name == "--imports") {
+      ok = parse_count(value, 1u << 24, n);
+      options.imports = n;
+    } else if (name == "--exports") {
+      ok = parse_count(value, 1ull << 40, n);
+      options.exports = n;
+    } else if (name == "--comments") {
+      ok = parse_share(value, options.comments);
+    } else if (arg.substr(0, 2) != "--" && !output) {
+      output = argv[i];
+    } else {
+      std::cerr << "ERROR: Unexpected argument: " << arg << std::endl;
+      return 1;
+    }
+    if (!ok) {
+      std::cerr << "ERROR: Invalid value: " << arg << std::endl;
+      return 1;
+    }
+  }
+
+  int fd = output ? open(output, O_WRONLY | O_CREAT | O_TRUNC, 0666) : 1;
+  bool ok = fd >= 0 && generateProgram(options, [&](std::string_view piece) {
+              return writeBytes(fd, piece.data(), piece.size());
+            });
+  if (output && fd >= 0 && close(fd) != 0) {
+    ok = false;
+  }
+  if (!ok) {
+    std::cerr << "ERROR: Cannot write output file: "
+              << (output ? output : "standard output") << ": "
+              << std::strerror(errno) << std::endl;
+    return 1;
+  }
+  return 0;
+}
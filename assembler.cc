@@ -0,0 +1,735 @@
+#include <algorithm>
+#include <utility>
+#include "assembler.h"
+#include "diagnostics.h"
+#include "sourcefile.h"
+#include "wordio.h"
+
+/*
+ * Operand shapes accepted by the instruction validators. Each entry is the
+ * sequence of token kinds a line must have from its first non-label token
+ * onwards; a position may accept several kinds (e.g. a branch target can be
+ * a label, a decimal or a hex integer). These are fixed by the instruction
+ * set, so they are built at compile time instead of scanning a template
+ * instruction like "lw $4, 1($3)" for every line that gets validated.
+ */
+constexpr uint32_t kindBit(Token::Kind kind) { return 1u << kind; }
+
+struct OperandShape {
+  uint32_t length;
+  uint32_t kinds[7];
+};
+
+// add $1, $2, $3
+constexpr OperandShape kRegRegRegShape{
+    6,
+    {kindBit(Token::ID), kindBit(Token::REG), kindBit(Token::COMMA),
+     kindBit(Token::REG), kindBit(Token::COMMA), kindBit(Token::REG)}};
+// mult $4, $3
+constexpr OperandShape kRegRegShape{
+    4,
+    {kindBit(Token::ID), kindBit(Token::REG), kindBit(Token::COMMA),
+     kindBit(Token::REG)}};
+// lis $4, jr $31
+constexpr OperandShape kRegShape{2, {kindBit(Token::ID), kindBit(Token::REG)}};
+// lw $4, 1($3) and lw $4, 0x1($3)
+constexpr OperandShape kMemoryShape{
+    7,
+    {kindBit(Token::ID), kindBit(Token::REG), kindBit(Token::COMMA),
+     kindBit(Token::INT) | kindBit(Token::HEXINT), kindBit(Token::LPAREN),
+     kindBit(Token::REG), kindBit(Token::RPAREN)}};
+// beq $4, $0, i and beq $4, $0, 0x0 and beq $4, $0, 1
+constexpr OperandShape kBranchShape{
+    6,
+    {kindBit(Token::ID), kindBit(Token::REG), kindBit(Token::COMMA),
+     kindBit(Token::REG), kindBit(Token::COMMA),
+     kindBit(Token::ID) | kindBit(Token::INT) | kindBit(Token::HEXINT)}};
+// .word i and .word 0x0 and .word 1
+constexpr OperandShape kWordShape{
+    2,
+    {kindBit(Token::WORD),
+     kindBit(Token::ID) | kindBit(Token::INT) | kindBit(Token::HEXINT)}};
+
+// The shape of each OperandLayout in opcodes.h, indexed by layout.
+constexpr const OperandShape *kLayoutShapes[] = {
+    &kRegShape,       // REG_D
+    &kRegShape,       // REG_S
+    &kRegRegShape,    // REG_S_T
+    &kRegRegRegShape, // REG_D_S_T
+    &kMemoryShape,    // MEMORY
+    &kBranchShape,    // BRANCH
+};
+
+// Checks that the tokens from ind to the end of the line have the given shape.
+static bool matchShape(uint32_t ind, const TokenLine &line,
+                       const OperandShape &shape) {
+  if (ind + shape.length != line.size())
+    return false;
+  for (uint32_t i = 0; i < shape.length; i++) {
+    if (!(kindBit(line.kind(ind + i)) & shape.kinds[i]))
+      return false;
+  }
+  return true;
+}
+
+
+std::vector<SymbolReference>
+sortedByName(const std::vector<SymbolReference> &refs,
+             const SymbolTable &symbols) {
+  // Rank the referenced symbols by name once, then sort by rank.
+  std::vector<uint32_t> rank(symbols.size(), 0);
+  std::vector<uint32_t> used;
+  for (const SymbolReference &ref : refs) {
+    if (!rank[ref.symbol]) {
+      rank[ref.symbol] = 1;
+      used.push_back(ref.symbol);
+    }
+  }
+  std::sort(used.begin(), used.end(), [&](uint32_t a, uint32_t b) {
+    return symbols.name(a) < symbols.name(b);
+  });
+  for (uint32_t i = 0; i < used.size(); i++) {
+    rank[used[i]] = i;
+  }
+  std::vector<SymbolReference> sorted(refs);
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [&](const SymbolReference &a, const SymbolReference &b) {
+                     return rank[a.symbol] < rank[b.symbol];
+                   });
+  return sorted;
+}
+
+// Records why assembling failed. Always returns false.
+bool Assembler::fail(std::string message) {
+  error_message = std::move(message);
+  return false;
+}
+
+// The assembler's pool, started or resized to the given number of threads.
+ThreadPool &Assembler::threadPool(unsigned threads) {
+  if (!pool || pool->size() != threads) {
+    pool.reset(new ThreadPool(threads));
+  }
+  return *pool;
+}
+
+/*
+ * Looks up the instruction starting at ind and checks its operands against
+ * the shape of its layout. Returns nullptr if the line is not a valid
+ * instruction. .word is not an instruction and is checked separately.
+ *
+ * add $1, $2, $3
+ * Token(ID, add) Token(REG, $1) Token(COMMA, ,) Token(REG, $2) Token(COMMA, ,)
+ * Token(REG, $3)
+ */
+const OpcodeDescriptor *
+Assembler::instruction(uint32_t ind, const TokenLine &line) const {
+  if (line.kind(ind) != Token::ID)
+    return nullptr;
+  const OpcodeDescriptor *op = findOpcode(line.lexeme(ind));
+  if (!op || !matchShape(ind, line, *kLayoutShapes[op->layout]))
+    return nullptr;
+  return op;
+}
+// Token(WORD, .word) Token(ID, i) / Token(HEXINT, 0x0) / Token(INT, 1)
+bool Assembler::word(uint32_t ind, const TokenLine &line) const {
+  return matchShape(ind, line, kWordShape);
+}
+/*
+ * Resolves the target of a beq/bne, token ind of line, into a word offset
+ * from pc, the address of the following instruction. Labels are recorded
+ * in the chunk's branch_references. Returns false after recording an error
+ * in the chunk.
+ */
+bool Assembler::branchOffset(const TokenLine &line, uint32_t ind, uint32_t pc,
+                             uint32_t &i, EncodeChunk &chunk) const {
+  const Token::Kind kind = line.kind(ind);
+  if (kind == Token::ID) {
+    const SymbolInfo &label = symbolTable[line.symbol(ind)];
+    if (!label.defined) {
+      chunk.error_message =
+          "ERROR: " + std::string(line.lexeme(ind)) + " is an invalid token";
+      return false;
+    }
+    i = label.address - pc;
+    i = i / 4;
+    // Track branch reference
+    chunk.branch_references.push_back({line.symbol(ind), pc - 4});
+    return true;
+  }
+  i = line.number(ind);
+  if ((kind == Token::INT) &&
+      !(-32768 <= (int32_t)i && (int32_t)i <= 32767)) {
+    chunk.error_message = "ERROR: Step count out of range. must be -32768 <= i "
+                          "<= 32767";
+    return false;
+  }
+  if ((kind == Token::HEXINT) && i > 0xffff) {
+    chunk.error_message = "ERROR: Step count out of range. must be i <= 0xffff";
+    return false;
+  }
+  return true;
+}
+/*
+ * Encodes the validated instruction starting at ind into word with the
+ * generic encoder for its format. pc is the address of the following
+ * instruction. Returns false after recording an error in the chunk.
+ */
+bool Assembler::encode(const OpcodeDescriptor &op, uint32_t ind,
+                       const TokenLine &line, uint32_t pc, uint32_t &word,
+                       EncodeChunk &chunk) const {
+  uint32_t s = 0, t = 0, d = 0, i = 0;
+  switch (op.layout) {
+  case REG_D:
+    d = line.number(ind + 1);
+    break;
+  case REG_S:
+    s = line.number(ind + 1);
+    break;
+  case REG_S_T:
+    s = line.number(ind + 1);
+    t = line.number(ind + 3);
+    break;
+  case REG_D_S_T:
+    d = line.number(ind + 1);
+    s = line.number(ind + 3);
+    t = line.number(ind + 5);
+    break;
+  case MEMORY:
+    t = line.number(ind + 1);
+    i = line.number(ind + 3);
+    s = line.number(ind + 5);
+    break;
+  case BRANCH:
+    s = line.number(ind + 1);
+    t = line.number(ind + 3);
+    if (!branchOffset(line, ind + 5, pc, i, chunk))
+      return false;
+    break;
+  }
+  word = op.format == R_TYPE ? encodeR(s, t, d, op.funct)
+                             : encodeI(op.opcode, s, t, i);
+  return true;
+}
+
+/*
+ * Pass 2 for one chunk: encodes its lines into out, which has room for
+ * every word the chunk holds. Stops at the first error, which is left in
+ * the chunk.
+ */
+bool Assembler::encodeLines(EncodeChunk &chunk, uint32_t *out) const {
+  uint32_t pc = chunk.pc;
+  for (size_t n = chunk.first; n < chunk.last; n++) {
+    const TokenLine line = chunk.tokens->line(n);
+    if (line.empty())
+      continue;
+    uint32_t ind = 0;
+    while (ind < line.size() && line.kind(ind) == Token::LABEL) {
+      ind++;
+    }
+    // token is not a label
+    if (ind == line.size())
+      continue;
+    
+    // Increment PC BEFORE processing instruction
+    pc += 4;
+    uint32_t instr = 0;
+    
+    if (ind < line.size() && line.kind(ind) == Token::WORD) {
+      ind++;
+      if (line.kind(ind) == Token::ID) {
+        const SymbolInfo &label = symbolTable[line.symbol(ind)];
+        if (!label.defined) {
+          chunk.error_message =
+              "ERROR: Invalid Lablel:" + std::string(line.lexeme(ind));
+          return false;
+        }
+        instr = label.address;
+        // The reference is to this word, which pc is already past.
+        chunk.word_references.push_back({line.symbol(ind), pc - 4});
+      } else {
+        instr = line.number(ind);
+      }
+      *out++ = instr;
+    } else {
+      // Pass 1 accepted the line, so the mnemonic is in the table.
+      const OpcodeDescriptor &op = *findOpcode(line.lexeme(ind));
+      if (!encode(op, ind, line, pc, *out++, chunk))
+        return false;
+    }
+  }
+  return true;
+}
+
+/*
+ * Pass 2: encodes every line into assembly_binary_code, which pass 1 sized.
+ * The symbol table no longer changes, so each chunk of lines only depends
+ * on itself and chunks can be encoded in parallel. Their references are
+ * then appended in chunk order, and the first error in source order wins,
+ * so the result is the same as encoding the lines one after another. A
+ * source scanned in parallel is encoded a scanned chunk at a time, from
+ * the chunk's own tokens.
+ */
+bool Assembler::encodeProgram(uint32_t pc_start, unsigned threads) {
+  const size_t count = chunkStarts.size();
+  if (threads <= 1 || count <= 1) {
+    EncodeChunk whole;
+    whole.tokens = scanChunkCount ? &scanChunks[0].lines : &assemblyProgram;
+    whole.first = 0;
+    whole.last = whole.tokens->lines();
+    whole.pc = pc_start;
+    whole.word_references.swap(word_references);
+    whole.branch_references.swap(branch_references);
+    bool ok = encodeLines(whole, assembly_binary_code.data());
+    whole.word_references.swap(word_references);
+    whole.branch_references.swap(branch_references);
+    if (!ok) {
+      return fail(std::move(whole.error_message));
+    }
+    return true;
+  }
+
+  if (chunks.size() < count) {
+    chunks.resize(count);
+  }
+  for (size_t c = 0; c < count; c++) {
+    EncodeChunk &chunk = chunks[c];
+    if (scanChunkCount) {
+      chunk.tokens = &scanChunks[c].lines;
+      chunk.first = 0;
+      chunk.last = chunk.tokens->lines();
+    } else {
+      chunk.tokens = &assemblyProgram;
+      chunk.first = chunkStarts[c].line;
+      chunk.last =
+          c + 1 < count ? chunkStarts[c + 1].line : assemblyProgram.lines();
+    }
+    chunk.pc = chunkStarts[c].pc;
+    chunk.word_references.clear();
+    chunk.branch_references.clear();
+    chunk.error_message.clear();
+  }
+  uint32_t *code = assembly_binary_code.data();
+  threadPool(threads).run(count, [&](size_t c, unsigned) {
+    EncodeChunk &chunk = chunks[c];
+    encodeLines(chunk, code + (chunk.pc - pc_start) / 4);
+  });
+
+  size_t words = 0, branches = 0;
+  for (size_t c = 0; c < count; c++) {
+    if (!chunks[c].error_message.empty()) {
+      return fail(chunks[c].error_message);
+    }
+    words += chunks[c].word_references.size();
+    branches += chunks[c].branch_references.size();
+  }
+  word_references.reserve(words);
+  branch_references.reserve(branches);
+  for (size_t c = 0; c < count; c++) {
+    word_references.insert(word_references.end(),
+                           chunks[c].word_references.begin(),
+                           chunks[c].word_references.end());
+    branch_references.insert(branch_references.end(),
+                             chunks[c].branch_references.begin(),
+                             chunks[c].branch_references.end());
+  }
+  return true;
+}
+
+void Assembler::reset() {
+  assembly_binary_code.clear();
+  symbols.clear();
+  symbolTable.clear();
+  word_references.clear();
+  branch_references.clear();
+  merl_module = false;
+  assemblyProgram.clear();
+  error_message.clear();
+  chunkStarts.clear();
+  scanChunkCount = 0;
+}
+
+/*
+ * Takes the line just added to the program back out if it is a .import or
+ * .export, and records what it declares.
+ */
+void Assembler::recordDirective() {
+  symbolTable.resize(symbols.size());
+  const TokenLine line = assemblyProgram.line(assemblyProgram.lines() - 1);
+  if (line.size() >= 2 && line.kind(1) == Token::ID) {
+    if (line.kind(0) == Token::IMPORT) {
+      SymbolInfo &info = symbolTable[line.symbol(1)];
+      info.imported = true;
+      info.defined = true;
+      info.address = 0;
+      merl_module = true;
+      assemblyProgram.popLine();
+      return;
+    }
+    if (line.kind(0) == Token::EXPORT) {
+      symbolTable[line.symbol(1)].exported = true;
+      merl_module = true;
+      assemblyProgram.popLine();
+      return;
+    }
+  }
+}
+
+void Assembler::addSourceTokens(std::vector<Token> tokens) {
+  for (const Token &token : tokens) {
+    assemblyProgram.push(token);
+  }
+  assemblyProgram.endLine();
+  recordDirective();
+}
+
+void Assembler::addSourceLine(std::string_view line) {
+  scan(line, assemblyProgram, &symbols);
+  recordDirective();
+}
+
+/*
+ * Scans the lines of one chunk with the chunk's own symbols and does the
+ * part of pass 1 that only needs the line itself: it checks instructions
+ * and counts words, and notes where labels are defined. A scanning error
+ * stops the chunk; a rejected line does not, since a scanning error later
+ * in the source must still take precedence over it.
+ */
+void Assembler::scanChunk(ScanChunk &chunk) const {
+  try {
+    forEachLine(chunk.text, [&](std::string_view text) {
+      scan(text, chunk.lines, &chunk.symbols);
+      const size_t n = chunk.lines.lines() - 1;
+      const TokenLine line = chunk.lines.line(n);
+      if (line.size() >= 2 && line.kind(1) == Token::ID) {
+        if (line.kind(0) == Token::IMPORT) {
+          chunk.imports.push_back(line.symbol(1));
+          chunk.lines.popLine();
+          return;
+        }
+        if (line.kind(0) == Token::EXPORT) {
+          chunk.exports.push_back(line.symbol(1));
+          chunk.lines.popLine();
+          return;
+        }
+      }
+      if (chunk.invalidLine == NO_LINE) {
+        uint32_t ind = 0;
+        while (ind < line.size() && line.kind(ind) == Token::LABEL) {
+          chunk.labels.push_back({line.symbol(ind), n, chunk.words});
+          ind++;
+        }
+        if (ind < line.size()) {
+          if (instruction(ind, line) || word(ind, line)) {
+            chunk.words++;
+          } else {
+            chunk.invalidLine = n;
+          }
+        }
+      }
+    });
+  } catch (ScanningFailure &f) {
+    chunk.scanFailed = true;
+    chunk.error_message = f.what();
+  }
+  publishScannedBytes();
+}
+
+/*
+ * Scans source in chunks split at line boundaries, one chunk per task, and
+ * merges them into the program as if every line had been passed to
+ * addSourceLine in order. Interning each chunk's symbols in chunk order
+ * hands out the same ids as scanning serially, so the tokens are then
+ * renumbered in parallel. They stay in the chunks' arenas, which pass 2
+ * encodes from. Returns false if a line cannot be scanned.
+ */
+bool Assembler::scanInParallel(std::string_view source, unsigned threads) {
+  scanChunkCount = 0;
+  for (size_t start = 0; start < source.size(); scanChunkCount++) {
+    size_t end = std::min(start + kChunkBytes, source.size());
+    end = source.find('\n', end);
+    end = end == std::string_view::npos ? source.size() : end + 1;
+    if (scanChunks.size() <= scanChunkCount) {
+      scanChunks.emplace_back();
+    }
+    ScanChunk &chunk = scanChunks[scanChunkCount];
+    chunk.text = source.substr(start, end - start);
+    chunk.symbols.clear();
+    chunk.lines.clear();
+    chunk.labels.clear();
+    chunk.imports.clear();
+    chunk.exports.clear();
+    chunk.ids.clear();
+    chunk.words = 0;
+    chunk.invalidLine = NO_LINE;
+    chunk.scanFailed = false;
+    chunk.error_message.clear();
+    start = end;
+  }
+  ThreadPool &workers = threadPool(threads);
+  workers.run(scanChunkCount,
+              [&](size_t c, unsigned) { scanChunk(scanChunks[c]); });
+
+  for (size_t c = 0; c < scanChunkCount; c++) {
+    if (scanChunks[c].scanFailed) {
+      return fail(scanChunks[c].error_message);
+    }
+  }
+  size_t lines = 0;
+  for (size_t c = 0; c < scanChunkCount; c++) {
+    ScanChunk &chunk = scanChunks[c];
+    for (uint32_t id = 0; id < chunk.symbols.size(); id++) {
+      chunk.ids.push_back(symbols.intern(chunk.symbols.name(id)));
+    }
+    chunk.firstLine = lines;
+    lines += chunk.lines.lines();
+  }
+  symbolTable.resize(symbols.size());
+  for (size_t c = 0; c < scanChunkCount; c++) {
+    for (uint32_t id : scanChunks[c].imports) {
+      SymbolInfo &info = symbolTable[scanChunks[c].ids[id]];
+      info.imported = true;
+      info.defined = true;
+      info.address = 0;
+      merl_module = true;
+    }
+    for (uint32_t id : scanChunks[c].exports) {
+      symbolTable[scanChunks[c].ids[id]].exported = true;
+      merl_module = true;
+    }
+  }
+
+  workers.run(scanChunkCount, [&](size_t c, unsigned) {
+    TokenArena &tokens = scanChunks[c].lines;
+    const std::vector<uint32_t> &ids = scanChunks[c].ids;
+    for (size_t t = 0; t < tokens.tokens(); t++) {
+      const Token::Kind kind = tokens.kind(t);
+      if (kind == Token::ID || kind == Token::LABEL) {
+        tokens.setSymbol(t, ids[tokens.symbol(t)]);
+      }
+    }
+  });
+  return true;
+}
+
+/*
+ * Hands the results over to ret without copying, and resets the assembler
+ * for the next source. It is left with whatever storage ret held before.
+ */
+void Assembler::moveResults(AsmReturn &ret) {
+  std::swap(ret.assembly_binary_code, assembly_binary_code);
+  std::swap(ret.symbols, symbols);
+  std::swap(ret.symbolTable, symbolTable);
+  std::swap(ret.word_references, word_references);
+  std::swap(ret.branch_references, branch_references);
+  std::swap(ret.error_message, error_message);
+  ret.merl_module = merl_module;
+  ret.error = !ret.error_message.empty();
+  reset();
+}
+
+/*
+ * Pass 1: gives every label the address of the line it is on, and checks
+ * that every line is a valid instruction or .word. Sizes
+ * assembly_binary_code for pass 2.
+ */
+bool Assembler::defineLabels(uint32_t pc_start) {
+  uint32_t pc = pc_start;
+  for (size_t n = 0; n < assemblyProgram.lines(); n++) {
+    if (n % kChunkLines == 0) {
+      chunkStarts.push_back({n, pc});
+    }
+    const TokenLine line = assemblyProgram.line(n);
+    if (line.empty())
+      continue;
+
+    uint32_t ind = 0;
+    // Any number of labels may come before the instruction.
+    while (ind < line.size() && line.kind(ind) == Token::LABEL) {
+      SymbolInfo &label = symbolTable[line.symbol(ind)];
+      if (label.defined) {
+        return fail("ERROR: Duplicate Labels");
+      }
+      label.defined = true;
+      label.address = pc;
+      ind++;
+    }
+    if (ind == line.size())
+      continue;
+    // at this point the following MUST be valid instructions if not then the
+    // code is invalid
+    bool found = instruction(ind, line) || word(ind, line);
+
+    if (!found) {
+      return fail("ERROR: Invalid instruction or parameters");
+    } else {
+      pc += 4;
+    }
+  }
+
+  assembly_binary_code.resize((pc - pc_start) / 4);
+  return true;
+}
+
+/*
+ * Pass 1 for a source scanned in parallel. The chunks have already checked
+ * their lines and counted their words; walking them in order gives each
+ * chunk its first address and each label its address. Labels are defined
+ * in source order and the walk stops at the first line pass 1 rejects, so
+ * the error reported is the one the serial pass would report.
+ */
+bool Assembler::mergeLabels(uint32_t pc_start) {
+  uint32_t pc = pc_start;
+  for (size_t c = 0; c < scanChunkCount; c++) {
+    const ScanChunk &chunk = scanChunks[c];
+    chunkStarts.push_back({chunk.firstLine, pc});
+    for (const LabelDefinition &definition : chunk.labels) {
+      if (definition.line > chunk.invalidLine)
+        break;
+      SymbolInfo &label = symbolTable[chunk.ids[definition.symbol]];
+      if (label.defined) {
+        return fail("ERROR: Duplicate Labels");
+      }
+      label.defined = true;
+      label.address = pc + definition.word * 4;
+    }
+    if (chunk.invalidLine != NO_LINE) {
+      return fail("ERROR: Invalid instruction or parameters");
+    }
+    pc += chunk.words * 4;
+  }
+  assembly_binary_code.resize((pc - pc_start) / 4);
+  return true;
+}
+
+bool Assembler::assemble(uint32_t pc_start, AsmReturn &ret,
+                         unsigned threads) {
+  bool ok = scanChunkCount ? mergeLabels(pc_start) : defineLabels(pc_start);
+  // ------------------------------------------------------------------------------------------------------------------
+  ok = ok && encodeProgram(pc_start, threads);
+  moveResults(ret);
+  return ok;
+}
+
+Assembler::AsmReturn Assembler::assemble(uint32_t pc_start) {
+  AsmReturn ret;
+  assemble(pc_start, ret);
+  return ret;
+}
+
+bool Assembler::assemble(std::string_view source, const AsmOptions &options,
+                         AsmReturn &result) {
+  // Take over the storage of the caller's previous result, so that
+  // assembling module after module into the same result reuses it.
+  moveResults(result);
+  result.merl_header = {};
+  result.entries_binary.clear();
+  unsigned threads = options.threads ? options.threads : defaultThreadCount();
+  if (threads > 1 && source.size() > kChunkBytes) {
+    if (!scanInParallel(source, threads)) {
+      moveResults(result);
+      return false;
+    }
+  } else {
+    try {
+      forEachLine(source, [&](std::string_view line) { addSourceLine(line); });
+    } catch (ScanningFailure &f) {
+      fail(f.what());
+      moveResults(result);
+      return false;
+    }
+  }
+  auto done = [&](AsmPhase phase) {
+    if (options.phase_done) {
+      options.phase_done(phase);
+    }
+  };
+  done(PHASE_SCAN);
+  // A MERL module's code follows its three word header.
+  const uint32_t pc_start = merl_module ? 0xc : 0;
+  bool ok = scanChunkCount ? mergeLabels(pc_start) : defineLabels(pc_start);
+  if (ok) {
+    done(PHASE_PASS1);
+    ok = encodeProgram(pc_start, threads);
+  }
+  moveResults(result);
+  if (!ok) {
+    return false;
+  }
+  done(PHASE_PASS2);
+  if (result.merl_module && options.merl_records) {
+    get_entries_binary(result, result.entries_binary, options.merl_format);
+    result.merl_header = merlHeader(result.assembly_binary_code.size(),
+                                    result.entries_binary.size(),
+                                    options.merl_format);
+  }
+  done(PHASE_RECORDS);
+  return true;
+}
+
+void get_entries_binary(const Assembler::AsmReturn &result,
+                        std::vector<uint32_t> &entries_binary,
+                        MerlFormat format) {
+  // The records go through a MerlModule, so they are written by the same
+  // code as those of every other tool: each .word label in name order, as
+  // a REL or ESR record, then each export in name order.
+  MerlModule module;
+  for (const SymbolReference &ref :
+       sortedByName(result.word_references, result.symbols)) {
+    if (result.symbolTable[ref.symbol].imported) {
+      module.addSymbol(module.imports, ref.pc, result.symbols.name(ref.symbol));
+    } else {
+      module.relocations.push_back(ref.pc);
+    }
+  }
+  std::vector<uint32_t> exports;
+  for (uint32_t id = 0; id < result.symbolTable.size(); id++) {
+    if (result.symbolTable[id].exported) {
+      exports.push_back(id);
+    }
+  }
+  std::sort(exports.begin(), exports.end(), [&](uint32_t a, uint32_t b) {
+    return result.symbols.name(a) < result.symbols.name(b);
+  });
+  for (uint32_t id : exports) {
+    module.addSymbol(module.exports, result.symbolTable[id].address,
+                     result.symbols.name(id));
+  }
+  Diagnostics &diag = diagnostics();
+  if (diag.enabled(DIAG_RELOCATIONS, DIAG_DEBUG)) {
+    for (uint32_t address : module.relocations) {
+      diag.out() << "Rel entry: " << std::dec << address << '\n';
+    }
+  }
+  entries_binary.clear();
+  merlRecords(module, entries_binary, format);
+  // print the entries_binary
+  if (diag.enabled(DIAG_RELOCATIONS, DIAG_TRACE)) {
+    diag.out() << "Entries binary: " << '\n';
+    for (uint32_t entry : entries_binary) {
+      diag.out() << "0x" << std::hex << entry << '\n';
+    }
+    diag.out() << '\n';
+  }
+}
+
+size_t imageWords(const Assembler::AsmReturn &result) {
+  if (!result.merl_module) {
+    return result.assembly_binary_code.size();
+  }
+  return result.merl_header.size() + result.assembly_binary_code.size() +
+         result.entries_binary.size();
+}
+
+void copyImage(const Assembler::AsmReturn &result, uint32_t *out) {
+  if (result.merl_module) {
+    swapWords(result.merl_header.data(), out, result.merl_header.size());
+    out += result.merl_header.size();
+  }
+  swapWords(result.assembly_binary_code.data(), out,
+            result.assembly_binary_code.size());
+  out += result.assembly_binary_code.size();
+  if (result.merl_module) {
+    swapWords(result.entries_binary.data(), out, result.entries_binary.size());
+  }
+}
@@ -0,0 +1,318 @@
+#ifndef CS241_ASSEMBLER_H
+#define CS241_ASSEMBLER_H
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "linecache.h"
+#include "merl.h"
+#include "opcodes.h"
+#include "scanner.h"
+#include "symbols.h"
+#include "threadpool.h"
+
+/* The assembler library (libmipsasm).
+ *
+ * An Assembler turns MIPS assembly source held in memory into code words
+ * and, for sources that .import or .export symbols, the records of a MERL
+ * module. It does no I/O of its own and all of its state lives in the
+ * Assembler, so one process can assemble any number of sources, with one
+ * Assembler per thread:
+ *
+ *   Assembler assembler;
+ *   Assembler::AsmReturn result;
+ *   for (std::string_view source : sources) {
+ *     if (!assembler.assemble(source, {}, result)) {
+ *       report(result.error_message);
+ *     } else {
+ *       store(result);
+ *     }
+ *   }
+ *
+ * Results are moved out rather than copied. When the same AsmReturn is
+ * passed back in, its vectors are cleared and refilled, so after the first
+ * few sources assembling a module does not allocate for its output.
+ */
+
+// What the assembler knows about an interned symbol.
+struct SymbolInfo {
+  uint32_t address = 0;
+  bool defined = false; // by a label, or by .import (at address 0)
+  bool imported = false;
+  bool exported = false;
+};
+
+// A use of a symbol by a .word or a branch at the given address.
+struct SymbolReference {
+  uint32_t symbol;
+  uint32_t pc;
+};
+
+/*
+ * Returns refs ordered by symbol name, keeping the order of references to
+ * the same symbol. Output that lists symbols is written in this order, so
+ * it does not depend on the order in which ids were handed out.
+ */
+std::vector<SymbolReference>
+sortedByName(const std::vector<SymbolReference> &refs,
+             const SymbolTable &symbols);
+
+// The phases of Assembler::assemble(), in order.
+enum AsmPhase {
+  PHASE_SCAN,    // scanning every line (and, when scanning in parallel, the
+                 // checks pass 1 makes on each line on its own)
+  PHASE_PASS1,   // defining labels and laying out the code
+  PHASE_PASS2,   // encoding
+  PHASE_RECORDS  // building the MERL records and header
+};
+
+class Assembler {
+  public:
+    struct AsmOptions {
+      // Build the MERL header and linker records of a module. Callers that
+      // only want the code words can turn this off.
+      bool merl_records = true;
+      // The MERL format of the records and header (see merl.h).
+      MerlFormat merl_format = MERL_V1;
+      // Threads that scan and encode, counting the caller; 0 means one per
+      // core. The output is the same for any count.
+      unsigned threads = 1;
+      // If set, called as each phase ends, for profiling. Phases after a
+      // failure are not reported.
+      std::function<void(AsmPhase)> phase_done;
+    };
+
+    struct AsmReturn {
+      std::vector<uint32_t> assembly_binary_code;
+      // Symbol names refer into the assembled source.
+      SymbolTable symbols;
+      // Indexed by symbol id.
+      std::vector<SymbolInfo> symbolTable;
+      // Addresses recorded for each .word label, in source order.
+      std::vector<SymbolReference> word_references;
+      // Addresses of each beq/bne with a label target, in source order.
+      std::vector<SymbolReference> branch_references;
+      // Set if the source imports or exports anything; the output is then
+      // merl_header, assembly_binary_code and entries_binary, in that order.
+      bool merl_module = false;
+      std::array<uint32_t, 3> merl_header{};
+      std::vector<uint32_t> entries_binary;
+      bool error = false;
+      // The message to report when error is set.
+      std::string error_message;
+    };
+
+    // How much of a source assembleIncremental() took from its cache.
+    struct IncrementalStats {
+      size_t lines = 0;    // lines in the source
+      size_t reused = 0;   // taken from the cache without being scanned
+      size_t relinked = 0; // reused lines whose label values changed
+      bool full = false;   // the cache did not fit, so every line was scanned
+    };
+
+    // What assembleStream() did.
+    struct StreamStats {
+      size_t lines = 0;       // lines read
+      uint64_t words = 0;     // words written, header and records included
+      size_t fixups = 0;      // forward references filled in later
+      size_t peakFixups = 0;  // the most forward references waiting at once
+      size_t latePatches = 0; // filled in after their word was written out
+      size_t symbols = 0;     // names interned
+      bool merl_module = false; // the output is a MERL file
+    };
+
+  private:
+    // Pass 2 works on chunks of this many lines. Pass 1 records where the
+    // code of each chunk starts, so chunks can be encoded in any order.
+    static constexpr size_t kChunkLines = 1 << 14;
+    // Sources larger than this are scanned in parallel, in pieces of about
+    // this size.
+    static constexpr size_t kChunkBytes = 1 << 20;
+    static constexpr size_t NO_LINE = SIZE_MAX;
+
+    // The first line of a chunk of the program and the address of its
+    // first word.
+    struct ChunkStart {
+      size_t line;
+      uint32_t pc;
+    };
+
+    // A label defined on a line of a ScanChunk.
+    struct LabelDefinition {
+      uint32_t symbol; // id in the chunk's symbols
+      size_t line;     // index into the chunk's lines
+      uint32_t word;   // words the chunk emits before this line
+    };
+
+    // A piece of the source scanned and checked by one thread, on its own,
+    // before its symbols and addresses are merged into the program.
+    struct ScanChunk {
+      std::string_view text;
+      SymbolTable symbols;
+      // Program lines; .import and .export are recorded separately.
+      TokenArena lines;
+      std::vector<LabelDefinition> labels;
+      std::vector<uint32_t> imports;
+      std::vector<uint32_t> exports;
+      // The id in the program of each of the chunk's symbols.
+      std::vector<uint32_t> ids;
+      uint32_t words = 0;
+      // The first line pass 1 rejects.
+      size_t invalidLine = NO_LINE;
+      size_t firstLine = 0; // index of the first line in the program
+      bool scanFailed = false;
+      std::string error_message;
+    };
+
+    // The lines [first, last) of tokens and what encoding them produced.
+    // Each chunk is encoded by one thread.
+    struct EncodeChunk {
+      // The program, or the chunk it was scanned in.
+      const TokenArena *tokens = nullptr;
+      size_t first = 0;
+      size_t last = 0;
+      uint32_t pc = 0; // address of the chunk's first word
+      std::vector<SymbolReference> word_references;
+      std::vector<SymbolReference> branch_references;
+      std::string error_message;
+    };
+
+    std::vector<uint32_t> assembly_binary_code;
+    // Every identifier and label name seen while scanning, as dense ids.
+    SymbolTable symbols;
+    // Indexed by symbol id.
+    std::vector<SymbolInfo> symbolTable;
+    std::vector<SymbolReference> word_references;
+    std::vector<SymbolReference> branch_references;
+    // Set once a .import or .export has been seen.
+    bool merl_module = false;
+    // The scanned tokens of every source line. Their lexemes refer into the
+    // caller's source buffer, which must outlive assemble().
+    TokenArena assemblyProgram;
+    // Why the last pass failed.
+    std::string error_message;
+    // Where pass 2 splits the program.
+    std::vector<ChunkStart> chunkStarts;
+    // The pieces the source was scanned in, if it was scanned in parallel.
+    size_t scanChunkCount = 0;
+    // Kept between runs so their storage is reused.
+    std::vector<ScanChunk> scanChunks;
+    std::vector<EncodeChunk> chunks;
+    std::unique_ptr<ThreadPool> pool;
+
+    bool fail(std::string message);
+    void recordDirective();
+    ThreadPool &threadPool(unsigned threads);
+    const OpcodeDescriptor *instruction(uint32_t ind,
+                                        const TokenLine &line) const;
+    bool word(uint32_t ind, const TokenLine &line) const;
+    void scanChunk(ScanChunk &chunk) const;
+    bool scanInParallel(std::string_view source, unsigned threads);
+    bool defineLabels(uint32_t pc_start);
+    bool mergeLabels(uint32_t pc_start);
+    void describeLine(std::string_view text, TokenArena &tokens,
+                      LineRecord &record, std::vector<LineSpan> &labels,
+                      std::string &step_error) const;
+    bool linkLines(const std::vector<std::string_view> &text,
+                   std::vector<LineRecord> &records,
+                   const std::vector<LineSpan> &labels,
+                   const std::vector<std::pair<size_t, std::string>>
+                       &step_errors,
+                   size_t first_scanned, size_t end_scanned,
+                   IncrementalStats &stats);
+    bool branchOffset(const TokenLine &line, uint32_t ind, uint32_t pc,
+                      uint32_t &i, EncodeChunk &chunk) const;
+    bool encode(const OpcodeDescriptor &op, uint32_t ind,
+                const TokenLine &line, uint32_t pc, uint32_t &word,
+                EncodeChunk &chunk) const;
+    bool encodeLines(EncodeChunk &chunk, uint32_t *out) const;
+    bool encodeProgram(uint32_t pc_start, unsigned threads);
+    void moveResults(AsmReturn &ret);
+
+  public:
+    /* Assembles the whole of source into result, replacing what result
+     * held before and reusing its storage. Returns false, with
+     * result.error and result.error_message set, if the source is not
+     * valid. source must outlive result.symbols.
+     */
+    bool assemble(std::string_view source, const AsmOptions &options,
+                  AsmReturn &result);
+
+    /* Assembles source like the above, starting from what cache recorded
+     * about the lines of an earlier version of it. Only the lines that
+     * changed are scanned and encoded again: lines before and after them
+     * that are still the same are taken from the cache, and their labels
+     * and label values are brought up to date. If too little of the source
+     * matches, every line is scanned. On success cache is updated to
+     * describe source. Always works on the calling thread.
+     */
+    bool assembleIncremental(std::string_view source,
+                             const AsmOptions &options, LineCache &cache,
+                             AsmReturn &result, IncrementalStats &stats);
+
+    /* Assembles the source read from the file descriptor in in one pass,
+     * writing the output file to out as it goes, so neither the source nor
+     * the code is ever held whole. Each line is encoded as it is read. A
+     * .word or branch whose label is not defined yet is written with a
+     * placeholder and kept as a fixup on the label, and is filled in when
+     * the label is defined. Words are written out in large blocks, keeping
+     * back the last few branch ranges' worth so nearly every fixup lands in
+     * memory; the rest are written into the file in place. Memory grows
+     * with the names and waiting fixups, and for a MERL module with its
+     * records, but not with the length of the source.
+     *
+     * The output is the same file assemble() writes. The output format is
+     * fixed by the first label or instruction, so .import and .export must
+     * come before it. A MERL header, and any fixup that lands in words
+     * already written, needs out to be seekable. When a source has several
+     * errors the one reported may differ from assemble(), because errors
+     * are found in the order of the lines rather than pass by pass. On
+     * failure message says why and out is truncated; if out is a file
+     * that cannot be truncated, message says that too. Works on the
+     * calling thread; options.threads and options.phase_done are not used.
+     */
+    bool assembleStream(int in, int out, const AsmOptions &options,
+                        StreamStats &stats, std::string &message);
+
+    // Forgets the current program, keeping allocated storage for reuse.
+    void reset();
+
+    // Adds a line that has already been scanned with this assembler's
+    // symbols, so it is not scanned again. .import and .export lines are
+    // recorded here and not added to the program.
+    void addSourceTokens(std::vector<Token> tokens);
+    // The line is not copied; its buffer must stay alive until assemble()
+    // returns. Throws ScanningFailure if the line cannot be scanned.
+    void addSourceLine(std::string_view line);
+    // True if the source imports or exports anything, so it must be a MERL
+    // file.
+    bool isMerlModule() const { return merl_module; }
+    // Assembles the lines added so far, placing the first word at pc_start,
+    // and moves the results into ret. The assembler is then empty again.
+    bool assemble(uint32_t pc_start, AsmReturn &ret, unsigned threads = 1);
+    AsmReturn assemble(uint32_t pc_start);
+};
+
+/* Fills entries_binary with the MERL linker records of an assembled module:
+ * REL and ESR entries for every .word label, then an ESD entry for every
+ * export. In v2 a string table of the imported and exported names comes
+ * first, and MERL_V2_PACKED packs the REL entries into one record.
+ */
+void get_entries_binary(const Assembler::AsmReturn &result,
+                        std::vector<uint32_t> &entries_binary,
+                        MerlFormat format = MERL_V1);
+
+// The number of words in the output file of an assembled source.
+size_t imageWords(const Assembler::AsmReturn &result);
+
+/* Writes the output file of an assembled source into out, which must hold
+ * imageWords(result) words, as big-endian words ready to be stored.
+ */
+void copyImage(const Assembler::AsmReturn &result, uint32_t *out);
+
+#endif
@@ -0,0 +1,77 @@
+#include <cerrno>
+#include <unistd.h>
+#include "diagnostics.h"
+
+Diagnostics::StderrBuffer::StderrBuffer() {
+  setp(block, block + sizeof(block));
+}
+
+Diagnostics::StderrBuffer::int_type
+Diagnostics::StderrBuffer::overflow(int_type c) {
+  if (sync() != 0) {
+    return traits_type::eof();
+  }
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+int Diagnostics::StderrBuffer::sync() {
+  const char *data = pbase();
+  size_t length = pptr() - pbase();
+  while (length > 0) {
+    ssize_t written = write(2, data, length);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    data += written;
+    length -= written;
+  }
+  setp(block, block + sizeof(block));
+  return 0;
+}
+
+Diagnostics::Diagnostics() : stream(&buffer) {}
+
+Diagnostics::~Diagnostics() { flush(); }
+
+void Diagnostics::configure(DiagLevel level, unsigned categories) {
+  this->level = level;
+  this->categories = categories;
+}
+
+void Diagnostics::flush() { stream.flush(); }
+
+Diagnostics &diagnostics() {
+  static Diagnostics instance;
+  return instance;
+}
+
+bool parseDiagCategories(std::string_view list, unsigned &categories) {
+  categories = 0;
+  while (!list.empty()) {
+    size_t comma = list.find(',');
+    std::string_view name = list.substr(0, comma);
+    if (name == "scanner") {
+      categories |= DIAG_SCANNER;
+    } else if (name == "symbols") {
+      categories |= DIAG_SYMBOLS;
+    } else if (name == "relocations") {
+      categories |= DIAG_RELOCATIONS;
+    } else if (name == "image") {
+      categories |= DIAG_IMAGE;
+    } else if (name == "all") {
+      categories |= DIAG_ALL;
+    } else {
+      return false;
+    }
+    list = comma == std::string_view::npos ? std::string_view()
+                                           : list.substr(comma + 1);
+  }
+  return true;
+}
@@ -0,0 +1,87 @@
+#ifndef CS241_DIAGNOSTICS_H
+#define CS241_DIAGNOSTICS_H
+#include <ostream>
+#include <streambuf>
+#include <string_view>
+
+/*
+ * Optional diagnostic output on standard error.
+ *
+ * Every message has a level and a category, and is only produced when the
+ * configured level is at least the message's level and its category is
+ * selected. The default is silent. Errors are not diagnostics: they are
+ * always reported.
+ *
+ * Callers test enabled() before formatting anything, so a disabled
+ * category costs a single comparison even inside hot loops:
+ *
+ *   if (diagnostics().enabled(DIAG_RELOCATIONS, DIAG_DEBUG)) {
+ *     diagnostics().out() << "Rel entry: " << address << '\n';
+ *   }
+ *
+ * Output is buffered and written to standard error in large blocks instead
+ * of being flushed per line, so use '\n' rather than std::endl.
+ */
+
+enum DiagLevel {
+  DIAG_SILENT = 0,
+  DIAG_INFO,  // one-line summaries
+  DIAG_DEBUG, // tables: symbols, relocation entries
+  DIAG_TRACE  // every word of the output
+};
+
+enum DiagCategory : unsigned {
+  DIAG_SCANNER = 1,
+  DIAG_SYMBOLS = 2,
+  DIAG_RELOCATIONS = 4,
+  DIAG_IMAGE = 8,
+  DIAG_ALL = 15
+};
+
+class Diagnostics {
+    // Collects output in a fixed block and writes it to stderr when full.
+    class StderrBuffer : public std::streambuf {
+        char block[1 << 16];
+
+      public:
+        StderrBuffer();
+
+      protected:
+        int_type overflow(int_type c) override;
+        int sync() override;
+    };
+
+    DiagLevel level = DIAG_SILENT;
+    unsigned categories = DIAG_ALL;
+    StderrBuffer buffer;
+    std::ostream stream;
+
+  public:
+    Diagnostics();
+    ~Diagnostics();
+    Diagnostics(const Diagnostics &) = delete;
+    Diagnostics &operator=(const Diagnostics &) = delete;
+
+    void configure(DiagLevel level, unsigned categories);
+
+    bool enabled(DiagCategory category, DiagLevel at) const {
+      return level >= at && (categories & category);
+    }
+
+    // The stream enabled messages are formatted into.
+    std::ostream &out() { return stream; }
+
+    // Writes everything buffered so far to standard error.
+    void flush();
+};
+
+// The process-wide diagnostics.
+Diagnostics &diagnostics();
+
+/* Parses a comma separated list of category names (scanner, symbols,
+ * relocations, image, all) into a DiagCategory mask. Returns false if a
+ * name is not recognized.
+ */
+bool parseDiagCategories(std::string_view list, unsigned &categories);
+
+#endif
@@ -0,0 +1,500 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include "disassembler.h"
+#include "threadpool.h"
+
+namespace {
+
+// For each function code and opcode, the kOpcodes row that has it, or -1.
+struct DecodeTable {
+  int8_t funct[64];
+  int8_t opcode[64];
+};
+
+constexpr DecodeTable buildDecodeTable() {
+  DecodeTable table{};
+  for (int i = 0; i < 64; ++i) {
+    table.funct[i] = -1;
+    table.opcode[i] = -1;
+  }
+  for (size_t i = 0; i < kOpcodeCount; ++i) {
+    if (kOpcodes[i].format == R_TYPE) {
+      table.funct[kOpcodes[i].funct] = static_cast<int8_t>(i);
+    } else {
+      table.opcode[kOpcodes[i].opcode] = static_cast<int8_t>(i);
+    }
+  }
+  return table;
+}
+
+constexpr DecodeTable kDecodeTable = buildDecodeTable();
+
+// Words lines are written in pieces of, so pieces can go to threads.
+constexpr size_t kChunkWords = 1 << 16;
+// Column the address comment starts in.
+constexpr size_t kCommentColumn = 30;
+
+// Longest line render() builds in its buffer. Names have no length limit,
+// so they are appended to the output directly and never go in the buffer;
+// the rest of a line, comment included, is well under this.
+constexpr size_t kLineBytes = 128;
+
+// These write at p and return the end of what they wrote.
+char *putText(char *p, std::string_view text) {
+  std::memcpy(p, text.data(), text.size());
+  return p + text.size();
+}
+
+char *putHex(char *p, uint32_t value) {
+  static const char digits[] = "0123456789abcdef";
+  for (int i = 7; i >= 0; --i, value >>= 4) {
+    p[i] = digits[value & 15];
+  }
+  return p + 8;
+}
+
+char *putDecimal(char *p, int32_t value) {
+  return std::to_chars(p, p + 11, value).ptr;
+}
+
+char *putRegister(char *p, uint32_t r) {
+  *p++ = '$';
+  if (r >= 10) {
+    *p++ = static_cast<char>('0' + r / 10);
+  }
+  *p++ = static_cast<char>('0' + r % 10);
+  return p;
+}
+
+/* A prefix P such that lo < P + digits < hi for every nonempty string of
+ * digits, so that names P + digits (all of one length) sort between lo and
+ * hi in numeric order. lo may be empty, and hi null for no upper bound.
+ * Returns an empty string if there is no such prefix that is a valid
+ * identifier; only an hi of lo (or "A", for an empty lo) followed by zeros
+ * leaves no room.
+ */
+std::string prefixBetween(const std::string &lo, const std::string *hi) {
+  if (!hi) {
+    return lo.empty() ? "L" : lo + "0";
+  }
+  std::string low = lo;
+  if (low.empty()) {
+    // Identifiers start with a letter, and 'A' is the first.
+    if ((*hi)[0] > 'A') {
+      return "A";
+    }
+    low = "A";
+  }
+  // Anything that starts with low and goes on is above lo. If hi does not
+  // start with low, it is above all of them.
+  if (hi->compare(0, low.size(), low) != 0) {
+    return low + "0";
+  }
+  // Otherwise follow hi to its first character above '0', the first
+  // character an identifier can go on with, and go below it.
+  const size_t above = hi->find_first_not_of('0', low.size());
+  if (above == std::string::npos) {
+    return "";
+  }
+  return hi->substr(0, above) + "0";
+}
+
+} // namespace
+
+const OpcodeDescriptor *decodeInstruction(uint32_t word) {
+  const uint32_t opcode = word >> 26;
+  if (opcode != 0) {
+    const int8_t row = kDecodeTable.opcode[opcode];
+    return row < 0 ? nullptr : &kOpcodes[row];
+  }
+  const int8_t row = kDecodeTable.funct[word & 63];
+  // The shift amount is never used, and each layout leaves some of the
+  // register fields zero.
+  if (row < 0 || (word >> 6 & 31) != 0) {
+    return nullptr;
+  }
+  const OpcodeDescriptor &op = kOpcodes[row];
+  const uint32_t s = word >> 21 & 31, t = word >> 16 & 31, d = word >> 11 & 31;
+  switch (op.layout) {
+  case REG_D:
+    return s == 0 && t == 0 ? &op : nullptr;
+  case REG_S:
+    return t == 0 && d == 0 ? &op : nullptr;
+  case REG_S_T:
+    return d == 0 ? &op : nullptr;
+  default:
+    return &op;
+  }
+}
+
+Disassembler::Disassembler(const uint32_t *code, size_t words, uint32_t base,
+                           const MerlModule *module, bool addresses)
+    : code(code), words(words), base(base), addresses(addresses),
+      dataWords((words + 64) / 64) {
+  if (module) {
+    nameRelocations(*module);
+    // Only a source that imports or exports something assembles to a MERL
+    // file, and an import nothing uses adds no record. Made-up names start
+    // with a capital, so this one cannot clash.
+    if (imports.empty() && exports.empty()) {
+      imports.push_back("merl");
+    }
+  }
+  nameBranchTargets();
+}
+
+/* Names the words and addresses the records of module refer to. A REL
+ * record's word holds the address of a label, and the assembler sorts REL
+ * records by the name of that label, keeping the references to one label
+ * in address order. So the records fall into runs that each refer to one
+ * label, and the labels' names must sort in the order of their runs. A run
+ * whose address an export names keeps that name; the runs in between get
+ * names made to fall between the names around them.
+ */
+void Disassembler::nameRelocations(const MerlModule &module) {
+  auto wordIndex = [&](uint32_t address, size_t &index) {
+    if (address < base || (address - base) % 4 != 0 ||
+        (address - base) / 4 > words) {
+      return false;
+    }
+    index = (address - base) / 4;
+    return true;
+  };
+  auto markData = [&](size_t index) {
+    dataWords[index >> 6] |= uint64_t(1) << (index & 63);
+  };
+  // Import and export names, which no made-up name may take.
+  std::unordered_map<std::string, uint32_t> ids;
+  auto nameId = [&](std::string_view name) {
+    auto found = ids.emplace(name, static_cast<uint32_t>(names.size()));
+    if (found.second) {
+      names.emplace_back(name);
+    }
+    return found.first->second;
+  };
+
+  for (const MerlSymbol &symbol : module.imports) {
+    const uint32_t id = nameId(module.name(symbol));
+    const size_t index = (symbol.address - base) / 4;
+    symbolWords.emplace_back(index, id);
+    markData(index);
+    imports.push_back(names[id]);
+  }
+  // Exports by address, then name.
+  std::vector<std::pair<uint32_t, std::string>> exported;
+  for (const MerlSymbol &symbol : module.exports) {
+    const uint32_t id = nameId(module.name(symbol));
+    exports.push_back(names[id]);
+    size_t index;
+    if (wordIndex(symbol.address, index)) {
+      labels.emplace_back(index, id);
+      exported.emplace_back(symbol.address, names[id]);
+    }
+  }
+  std::sort(imports.begin(), imports.end());
+  imports.erase(std::unique(imports.begin(), imports.end()), imports.end());
+  std::sort(exports.begin(), exports.end());
+  exports.erase(std::unique(exports.begin(), exports.end()), exports.end());
+  std::sort(exported.begin(), exported.end());
+  exported.erase(std::unique(exported.begin(), exported.end()),
+                 exported.end());
+
+  // The runs of REL records: the word each refers to, and its name id.
+  struct Run {
+    size_t target;
+    uint32_t id = 0;
+    bool fixed = false;
+  };
+  std::vector<Run> runs;
+  const size_t firstSymbolWord = symbolWords.size();
+  uint32_t previous = 0;
+  for (uint32_t address : module.relocations) {
+    const size_t index = (address - base) / 4;
+    markData(index);
+    size_t target;
+    if (!wordIndex(code[index], target)) {
+      continue; // not an address in the code, so left as a number
+    }
+    if (runs.empty() || runs.back().target != target || address <= previous) {
+      runs.push_back({target});
+    }
+    // The run for now; its name id once the runs are named.
+    symbolWords.emplace_back(index, runs.size() - 1);
+    previous = address;
+  }
+  // Runs at exported addresses take the export's name, if one is left
+  // that keeps the names in order.
+  std::vector<bool> used(exported.size());
+  const std::string *last = nullptr;
+  for (Run &run : runs) {
+    const uint32_t address = base + 4 * static_cast<uint32_t>(run.target);
+    size_t e = std::lower_bound(exported.begin(), exported.end(),
+                                std::make_pair(address, std::string())) -
+               exported.begin();
+    for (; e < exported.size() && exported[e].first == address; ++e) {
+      if ((!last || *last < exported[e].second) && !used[e]) {
+        used[e] = true;
+        run.id = ids[exported[e].second];
+        run.fixed = true;
+        last = &exported[e].second;
+        break;
+      }
+    }
+  }
+  // The rest, a stretch between two named runs at a time. Names made this
+  // way all differ, being in order, so only imports and exports can clash.
+  std::vector<size_t> unsorted; // runs whose names could not be made
+  for (size_t first = 0; first < runs.size();) {
+    if (runs[first].fixed) {
+      first++;
+      continue;
+    }
+    size_t end = first;
+    while (end < runs.size() && !runs[end].fixed) {
+      end++;
+    }
+    const std::string lo = first > 0 ? names[runs[first - 1].id] : "";
+    const std::string *hi = end < runs.size() ? &names[runs[end].id] : nullptr;
+    const std::string prefix = prefixBetween(lo, hi);
+    const size_t width = std::to_string(end - first - 1).size();
+    std::string name = prefix + std::string(width, '0');
+    for (size_t k = first; k < end; k++) {
+      // name holds k - first in its last width characters.
+      for (size_t n = k - first, c = name.size(); n; n /= 10) {
+        name[--c] = static_cast<char>('0' + n % 10);
+      }
+      runs[k].id = static_cast<uint32_t>(names.size());
+      names.push_back(name);
+      if (prefix.empty() || ids.count(name)) {
+        unsorted.push_back(k);
+      }
+    }
+    first = end;
+  }
+  // Names that cannot sort in place still assemble to the same code; only
+  // the order of the REL records changes.
+  if (!unsorted.empty()) {
+    std::unordered_set<std::string> taken(names.begin(), names.end());
+    size_t fallback = 0;
+    for (size_t k : unsorted) {
+      std::string name;
+      do {
+        name = "R" + std::to_string(fallback++);
+      } while (!taken.insert(name).second);
+      names[runs[k].id] = std::move(name);
+    }
+  }
+  for (const Run &run : runs) {
+    labels.emplace_back(run.target, run.id);
+  }
+  for (size_t k = firstSymbolWord; k < symbolWords.size(); k++) {
+    symbolWords[k].second = runs[symbolWords[k].second].id;
+  }
+  // A word named by two records keeps one name, an import's if it has
+  // one, as imports have the first ids.
+  std::sort(symbolWords.begin(), symbolWords.end());
+  symbolWords.erase(std::unique(symbolWords.begin(), symbolWords.end(),
+                                [](const std::pair<uint32_t, uint32_t> &a,
+                                   const std::pair<uint32_t, uint32_t> &b) {
+                                  return a.first == b.first;
+                                }),
+                    symbolWords.end());
+}
+
+/* Finds the words after each lis, and gives a label to every branch
+ * target in the code that has none.
+ */
+void Disassembler::nameBranchTargets() {
+  std::vector<uint32_t> targets;
+  for (size_t i = 0; i < words; i++) {
+    if (isData(i)) {
+      continue;
+    }
+    const OpcodeDescriptor *op = decodeInstruction(code[i]);
+    if (!op) {
+      continue;
+    }
+    if (op->layout == REG_D && op->funct == 20) { // lis
+      dataWords[(i + 1) >> 6] |= uint64_t(1) << ((i + 1) & 63);
+    } else if (op->layout == BRANCH) {
+      const int64_t target =
+          static_cast<int64_t>(i) + 1 + static_cast<int16_t>(code[i] & 0xffff);
+      if (target >= 0 && target <= static_cast<int64_t>(words)) {
+        targets.push_back(static_cast<uint32_t>(target));
+      }
+    }
+  }
+  std::sort(labels.begin(), labels.end());
+  labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+  std::sort(targets.begin(), targets.end());
+  targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+  // Only names that start with L can clash with these.
+  std::unordered_set<std::string> taken;
+  for (const std::string &name : names) {
+    if (name[0] == 'L') {
+      taken.insert(name);
+    }
+  }
+  const size_t named = labels.size();
+  for (uint32_t target : targets) {
+    auto it = std::lower_bound(labels.begin(), labels.begin() + named,
+                               std::make_pair(target, 0u));
+    if (it != labels.begin() + named && it->first == target) {
+      continue;
+    }
+    // Named after its address: L and the address in hexadecimal.
+    char digits[9] = {'L'};
+    std::string name(digits, std::to_chars(digits + 1, digits + 9,
+                                           base + 4 * target, 16).ptr);
+    while (!taken.insert(name).second) {
+      name += 'x';
+    }
+    labels.emplace_back(target, static_cast<uint32_t>(names.size()));
+    names.push_back(std::move(name));
+  }
+  std::inplace_merge(labels.begin(), labels.begin() + named, labels.end());
+}
+
+const std::string *Disassembler::labelAt(size_t index) const {
+  auto it = std::lower_bound(labels.begin(), labels.end(),
+                             std::make_pair(static_cast<uint32_t>(index), 0u));
+  return it != labels.end() && it->first == index ? &names[it->second]
+                                                  : nullptr;
+}
+
+void Disassembler::header(std::string &out) const {
+  for (const std::string &name : imports) {
+    out += ".import " + name + "\n";
+  }
+  for (const std::string &name : exports) {
+    out += ".export " + name + "\n";
+  }
+}
+
+void Disassembler::render(size_t first, size_t last, std::string &out) const {
+  auto label = std::lower_bound(
+      labels.begin(), labels.end(),
+      std::make_pair(static_cast<uint32_t>(first), 0u));
+  auto symbol = std::lower_bound(
+      symbolWords.begin(), symbolWords.end(),
+      std::make_pair(static_cast<uint32_t>(first), 0u));
+  auto putLabels = [&](size_t index) {
+    for (; label != labels.end() && label->first == index; ++label) {
+      out += names[label->second];
+      out += ":\n";
+    }
+  };
+  char line[kLineBytes];
+  // Characters of the current line already moved from line to out.
+  size_t flushed = 0;
+  // Moves what line holds to out, then appends name; returns where the
+  // rest of the line goes.
+  auto putName = [&](char *p, const std::string &name) {
+    out.append(line, p);
+    out += name;
+    flushed += (p - line) + name.size();
+    return line;
+  };
+  for (size_t i = first; i < last; i++) {
+    putLabels(i);
+    flushed = 0;
+    char *p = putText(line, "  ");
+    const uint32_t word = code[i];
+    const OpcodeDescriptor *op = isData(i) ? nullptr : decodeInstruction(word);
+    if (!op) {
+      p = putText(p, ".word ");
+      if (symbol != symbolWords.end() && symbol->first == i) {
+        p = putName(p, names[symbol->second]);
+        ++symbol;
+      } else {
+        p = putHex(putText(p, "0x"), word);
+      }
+    } else {
+      const uint32_t s = word >> 21 & 31, t = word >> 16 & 31,
+                     d = word >> 11 & 31;
+      const int16_t imm = static_cast<int16_t>(word & 0xffff);
+      p = putText(p, op->mnemonic);
+      *p++ = ' ';
+      switch (op->layout) {
+      case REG_D:
+        p = putRegister(p, d);
+        break;
+      case REG_S:
+        p = putRegister(p, s);
+        break;
+      case REG_S_T:
+        p = putRegister(putText(putRegister(p, s), ", "), t);
+        break;
+      case REG_D_S_T:
+        p = putRegister(putText(putRegister(p, d), ", "), s);
+        p = putRegister(putText(p, ", "), t);
+        break;
+      case MEMORY:
+        p = putDecimal(putText(putRegister(p, t), ", "), imm);
+        *p++ = '(';
+        p = putRegister(p, s);
+        *p++ = ')';
+        break;
+      case BRANCH: {
+        p = putRegister(putText(putRegister(p, s), ", "), t);
+        p = putText(p, ", ");
+        const int64_t target = static_cast<int64_t>(i) + 1 + imm;
+        const std::string *name =
+            target >= 0 && target <= static_cast<int64_t>(words)
+                ? labelAt(static_cast<size_t>(target))
+                : nullptr;
+        p = name ? putName(p, *name) : putDecimal(p, imm);
+        break;
+      }
+      }
+    }
+    if (addresses) {
+      do {
+        *p++ = ' ';
+      } while (flushed + (p - line) < kCommentColumn + 1);
+      p = putText(p, "; ");
+      p = putHex(p, base + 4 * static_cast<uint32_t>(i));
+      p = putHex(putText(p, "  "), word);
+    }
+    *p++ = '\n';
+    out.append(line, p);
+  }
+  if (last == words) {
+    putLabels(words);
+  }
+}
+
+bool disassemble(const Disassembler &disassembler, unsigned threads,
+                 const std::function<bool(std::string_view)> &sink) {
+  std::string text;
+  disassembler.header(text);
+  if (!text.empty() && !sink(text)) {
+    return false;
+  }
+  ThreadPool pool(threads ? threads : defaultThreadCount());
+  const size_t words = disassembler.size();
+  const size_t chunks = std::max<size_t>(1, (words + kChunkWords - 1) /
+                                                kChunkWords);
+  // A few pieces per thread at a time, so memory stays bounded however
+  // large the code is.
+  std::vector<std::string> pieces(std::min<size_t>(chunks, 4 * pool.size()));
+  for (size_t next = 0; next < chunks; next += pieces.size()) {
+    const size_t count = std::min(pieces.size(), chunks - next);
+    pool.run(count, [&](size_t k, unsigned) {
+      const size_t first = (next + k) * kChunkWords;
+      pieces[k].clear();
+      disassembler.render(first, std::min(words, first + kChunkWords),
+                          pieces[k]);
+    });
+    for (size_t k = 0; k < count; k++) {
+      if (!sink(pieces[k])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
@@ -0,0 +1,91 @@
+#ifndef CS241_DISASSEMBLER_H
+#define CS241_DISASSEMBLER_H
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "merl.h"
+#include "opcodes.h"
+
+/* Turns code words back into assembly source that binasm assembles into
+ * the same words.
+ *
+ * Each word is decoded with two 64-entry tables built from kOpcodes, one
+ * indexed by the function code of R-type words and one by the opcode of
+ * I-type words. A word that no instruction encodes exactly (unused fields
+ * must be zero), and the word after every lis, is written as a .word.
+ *
+ * Labels come from the module's records: every export names its address,
+ * every REL record's word becomes a .word of a label at the address it
+ * holds, and every ESR record's word a .word of its import. The assembler
+ * writes REL records in order of label name, so the labels of REL targets
+ * are given names that sort in the order the records are in, around the
+ * names of the exports, and reassembling a module gives back the same
+ * file. The target of a branch is named too, if it is in the code.
+ *
+ * Preparing the labels takes one pass over the words; after that, any
+ * range of words can be written out on its own, so ranges can be written
+ * in parallel.
+ */
+
+/* Returns the descriptor of the instruction that encodes to word, or
+ * nullptr if there is none.
+ */
+const OpcodeDescriptor *decodeInstruction(uint32_t word);
+
+class Disassembler {
+    const uint32_t *code;
+    size_t words;
+    uint32_t base;
+    bool addresses;
+    std::vector<std::string> names;
+    // Label name ids by word index, sorted; index words is the end.
+    std::vector<std::pair<uint32_t, uint32_t>> labels;
+    // The name id held by each word that a REL or ESR record names,
+    // sorted by word index.
+    std::vector<std::pair<uint32_t, uint32_t>> symbolWords;
+    // One bit per word written as a .word: the words after lis, and those
+    // in symbolWords.
+    std::vector<uint64_t> dataWords;
+    std::vector<std::string> imports;
+    std::vector<std::string> exports;
+
+    bool isData(size_t index) const {
+      return dataWords[index >> 6] >> (index & 63) & 1;
+    }
+    void nameRelocations(const MerlModule &module);
+    void nameBranchTargets();
+    const std::string *labelAt(size_t index) const;
+
+  public:
+    /* Prepares to disassemble the words [code, code + words), the first of
+     * which is at address base. module, if given, is the MERL module the
+     * code belongs to and base must be MERL_CODE_START. With addresses
+     * set, every line ends in a comment with its address and word. The
+     * code must stay alive as long as the Disassembler.
+     */
+    Disassembler(const uint32_t *code, size_t words, uint32_t base,
+                 const MerlModule *module = nullptr, bool addresses = true);
+
+    size_t size() const { return words; }
+
+    // Appends the .import and .export lines the source starts with.
+    void header(std::string &out) const;
+
+    /* Appends the lines of the words [first, last). The labels at the end
+     * of the code are written with the last word.
+     */
+    void render(size_t first, size_t last, std::string &out) const;
+};
+
+/* Writes out the whole source of disassembler, header first, using threads
+ * threads (0 for one per core). Pieces of the source are handed to sink in
+ * order; if sink returns false, writing stops and this returns false.
+ */
+bool disassemble(const Disassembler &disassembler, unsigned threads,
+                 const std::function<bool(std::string_view)> &sink);
+
+#endif
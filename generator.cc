@@ -0,0 +1,289 @@
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <vector>
+#include "generator.h"
+
+namespace {
+
+// A fixed sequence of pseudo-random numbers (xorshift64*).
+struct Random {
+  uint64_t state;
+
+  explicit Random(uint64_t seed) : state(seed * 0x9e3779b97f4a7c15ull + 1) {}
+
+  uint32_t next() {
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return static_cast<uint32_t>((state * 0x2545f4914f6cdd1dull) >> 32);
+  }
+  uint32_t below(uint32_t n) {
+    return static_cast<uint32_t>((uint64_t(next()) * n) >> 32);
+  }
+  // True with probability p.
+  bool chance(double p) { return next() < p * 4294967296.0; }
+  // Uniform in (0, 1].
+  double unit() { return (next() + 1.0) / 4294967296.0; }
+};
+
+// Labels are remembered for this many lines either side of the current
+// one, which covers every branch offset.
+constexpr size_t kWindow = 1 << 16;
+// The farthest a branch can reach: its offset is a 16-bit word count from
+// the line after it.
+constexpr size_t kReachForward = 32767;
+constexpr size_t kReachBack = 32767;
+// How far a backward branch looks for a label to go to.
+constexpr size_t kLabelSearch = 64;
+// The size of the pieces handed to the sink.
+constexpr size_t kPieceBytes = 1 << 20;
+
+class Writer {
+    const GeneratorOptions &options;
+    const std::function<bool(std::string_view)> &sink;
+    Random random;
+    std::string out;
+    // Lines in the window that have a label, and lines ahead that need one.
+    std::vector<uint64_t> labelled;
+    std::vector<uint64_t> wanted;
+    size_t line = 0;
+
+    static bool test(const std::vector<uint64_t> &bits, size_t line) {
+      return bits[line % kWindow >> 6] >> (line & 63) & 1;
+    }
+    static void set(std::vector<uint64_t> &bits, size_t line, bool on) {
+      const uint64_t bit = uint64_t(1) << (line & 63);
+      uint64_t &word = bits[line % kWindow >> 6];
+      word = on ? word | bit : word & ~bit;
+    }
+
+    void number(uint64_t n) {
+      char text[20];
+      out.append(text, std::to_chars(text, text + sizeof(text), n).ptr);
+    }
+    void signedNumber(int n) {
+      char text[12];
+      out.append(text, std::to_chars(text, text + sizeof(text), n).ptr);
+    }
+    void reg() {
+      out += '$';
+      number(random.below(32));
+    }
+    void label(size_t at) {
+      out += 'L';
+      number(at);
+    }
+    size_t distance();
+    size_t target();
+    void wordOperand(bool imports);
+
+  public:
+    Writer(const GeneratorOptions &options,
+           const std::function<bool(std::string_view)> &sink)
+        : options(options), sink(sink), random(options.seed),
+          labelled(kWindow / 64), wanted(kWindow / 64) {}
+
+    bool write();
+};
+
+size_t Writer::distance() {
+  const unsigned mean = options.distance;
+  size_t d;
+  if (options.distribution == GeneratorOptions::UNIFORM) {
+    d = random.below(mean + 1);
+  } else if (mean == 0) {
+    d = 0;
+  } else {
+    // The number of failures before a success with probability
+    // 1 / (mean + 1), which averages mean.
+    d = static_cast<size_t>(std::log(random.unit()) /
+                            std::log(1.0 - 1.0 / (mean + 1.0)));
+  }
+  return d;
+}
+
+/* Picks the line a branch or .word on the current line refers to, making
+ * sure it will have a label.
+ */
+size_t Writer::target() {
+  const size_t d = distance();
+  if (random.chance(options.backward)) {
+    // Branching to line t takes an offset of t - line - 1.
+    const size_t lowest = line > kReachBack ? line - kReachBack : 0;
+    const size_t want = line > lowest + d ? line - d : lowest;
+    for (size_t t = want + 1; t-- > lowest && want - t < kLabelSearch;) {
+      if (test(labelled, t)) {
+        return t;
+      }
+    }
+    for (size_t t = want + 1; t <= line && t - want < kLabelSearch; t++) {
+      if (test(labelled, t)) {
+        return t;
+      }
+    }
+  }
+  size_t t = line + 1 + std::min(d, kReachForward);
+  t = std::min(t, options.lines);
+  set(wanted, t, true);
+  return t;
+}
+
+void Writer::wordOperand(bool imports) {
+  const uint32_t choice = random.below(imports ? 3 : 2);
+  if (choice == 0) {
+    const uint32_t value = random.next();
+    if (value & 1) {
+      out += "0x";
+      char text[8];
+      out.append(text, std::to_chars(text, text + 8, value, 16).ptr);
+    } else {
+      number(value);
+    }
+  } else if (choice == 1) {
+    label(target());
+  } else {
+    out += "ext";
+    number(random.below(static_cast<uint32_t>(options.imports)));
+  }
+}
+
+bool Writer::write() {
+  const size_t lines = options.lines;
+  const size_t exports = std::min(options.exports, lines);
+  for (size_t i = 0; i < options.imports; i++) {
+    out += ".import ext";
+    number(i);
+    out += '\n';
+  }
+  // The k-th export is line k * lines / exports.
+  auto exportLine = [&](size_t k) { return k * lines / exports; };
+  for (size_t k = 0; k < exports; k++) {
+    out += ".export ";
+    label(exportLine(k));
+    out += '\n';
+  }
+
+  const unsigned weights[] = {options.arithmetic, options.multiply,
+                              options.move,       options.memory,
+                              options.branch,     options.jump,
+                              options.lis,        options.word};
+  unsigned total = 0;
+  for (unsigned w : weights) {
+    total += w;
+  }
+  size_t nextExport = 0;
+  bool afterLis = false;
+  for (line = 0; line < lines; line++) {
+    bool labelHere = test(wanted, line) || random.chance(options.label_density);
+    set(wanted, line, false);
+    while (nextExport < exports && exportLine(nextExport) == line) {
+      labelHere = true;
+      nextExport++;
+    }
+    set(labelled, line, labelHere);
+    if (labelHere) {
+      label(line);
+      out += ": ";
+    }
+
+    unsigned kind = 0;
+    if (total) {
+      for (unsigned pick = random.below(total); pick >= weights[kind]; kind++) {
+        pick -= weights[kind];
+      }
+    }
+    if (afterLis) {
+      kind = 7;
+    } else if (kind == 6 && line + 1 == lines) {
+      kind = 0; // no room for the word after it
+    }
+    switch (kind) {
+    case 0: {
+      static const char *const ops[] = {"add ", "sub ", "slt ", "sltu "};
+      out += ops[random.below(4)];
+      reg();
+      out += ", ";
+      reg();
+      out += ", ";
+      reg();
+      break;
+    }
+    case 1: {
+      static const char *const ops[] = {"mult ", "multu ", "div ", "divu "};
+      out += ops[random.below(4)];
+      reg();
+      out += ", ";
+      reg();
+      break;
+    }
+    case 2:
+      out += random.below(2) ? "mfhi " : "mflo ";
+      reg();
+      break;
+    case 3:
+      out += random.below(2) ? "lw " : "sw ";
+      reg();
+      out += ", ";
+      signedNumber((static_cast<int>(random.below(128)) - 64) * 4);
+      out += '(';
+      reg();
+      out += ')';
+      break;
+    case 4:
+      out += random.below(2) ? "beq " : "bne ";
+      reg();
+      out += ", ";
+      reg();
+      out += ", ";
+      label(target());
+      break;
+    case 5:
+      out += random.below(2) ? "jr " : "jalr ";
+      reg();
+      break;
+    case 6:
+      out += "lis ";
+      reg();
+      break;
+    default:
+      out += ".word ";
+      wordOperand(options.imports > 0);
+      break;
+    }
+    afterLis = kind == 6;
+    if (random.chance(options.comments)) {
+      out += " ; generated";
+    }
+    out += '\n';
+    if (out.size() >= kPieceBytes) {
+      if (!sink(out)) {
+        return false;
+      }
+      out.clear();
+    }
+  }
+  // Forward references can reach the end of the program.
+  if (test(wanted, lines)) {
+    label(lines);
+    out += ":\n";
+  }
+  return out.empty() || sink(out);
+}
+
+} // namespace
+
+bool generateProgram(const GeneratorOptions &options,
+                     const std::function<bool(std::string_view)> &sink) {
+  Writer writer(options, sink);
+  return writer.write();
+}
+
+std::string generateProgram(const GeneratorOptions &options) {
+  std::string program;
+  generateProgram(options, [&](std::string_view piece) {
+    program += piece;
+    return true;
+  });
+  return program;
+}
@@ -0,0 +1,68 @@
+#ifndef CS241_GENERATOR_H
+#define CS241_GENERATOR_H
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+/* Synthetic assembly programs of any size, for benchmarks and stress tests.
+ *
+ * A program is a list of lines that each assemble to one word, after the
+ * .import and .export lines of a module. Each line's kind is drawn from the
+ * weights of the instruction mix, and the same options and seed always give
+ * the same program: the random numbers come from a fixed generator, not
+ * from <random>, whose distributions differ between libraries.
+ *
+ * Labels are named after the line they are on, L<line>. Every line gets a
+ * label with probability label_density, and so does every line a forward
+ * branch or a .word refers to, and every exported line. A branch goes
+ * forward or back a distance drawn from the distance distribution; going
+ * back, it takes the closest label at or before that line, and goes
+ * forward instead if there is none close by. Distances are capped so every
+ * branch offset fits in 16 bits.
+ */
+
+struct GeneratorOptions {
+  uint64_t seed = 1;
+  // Lines of code, not counting .import and .export lines.
+  size_t lines = 1000;
+
+  // Relative weights of the kinds of line.
+  unsigned arithmetic = 35; // add, sub, slt, sltu
+  unsigned multiply = 6;    // mult, multu, div, divu
+  unsigned move = 4;        // mfhi, mflo
+  unsigned memory = 20;     // lw, sw
+  unsigned branch = 15;     // beq, bne
+  unsigned jump = 2;        // jr, jalr
+  unsigned lis = 8;         // lis, then a .word of a constant or label
+  unsigned word = 10;       // .word of a constant, label or import
+
+  // The chance that any one line has a label.
+  double label_density = 0.1;
+  // Branch distances in lines: geometric with mean distance, or uniform
+  // in [0, distance].
+  enum Distribution { GEOMETRIC, UNIFORM };
+  Distribution distribution = GEOMETRIC;
+  unsigned distance = 16;
+  // The share of branches that go back.
+  double backward = 0.5;
+
+  // Symbols imported (ext0, ext1, ...) and lines exported, spread evenly
+  // through the program. Either makes the program a MERL module.
+  size_t imports = 0;
+  size_t exports = 0;
+  // The share of lines that end with a comment.
+  double comments = 0.1;
+};
+
+/* Generates the program options describe, handing it to sink in pieces of
+ * about a megabyte. Stops and returns false if sink returns false.
+ */
+bool generateProgram(const GeneratorOptions &options,
+                     const std::function<bool(std::string_view)> &sink);
+
+// Generates the whole program into a string.
+std::string generateProgram(const GeneratorOptions &options);
+
+#endif
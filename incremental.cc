@@ -0,0 +1,295 @@
+#include <algorithm>
+#include "assembler.h"
+#include "sourcefile.h"
+
+/*
+ * Incremental assembly.
+ *
+ * Every line is reduced to a LineRecord, which is all that assembling needs
+ * to know about the line on its own. Linking the records in order then does
+ * what the two passes do with the scanned lines: it gives labels their
+ * addresses, checks for duplicates and undefined labels, and fills in the
+ * words that depend on labels. Records of unchanged lines come from the
+ * cache, so only changed lines are scanned, checked and encoded again.
+ */
+
+namespace {
+
+// Reuse the cache only if at least this fraction of the lines still match.
+const size_t kMinReusePercent = 50;
+
+std::string_view spanOf(std::string_view line, LineSpan span) {
+  return line.substr(span.offset, span.length);
+}
+
+LineSpan spanIn(std::string_view line, std::string_view name) {
+  return {static_cast<uint32_t>(name.data() - line.data()),
+          static_cast<uint32_t>(name.size())};
+}
+
+} // namespace
+
+/*
+ * Scans one line into tokens, replacing what it held, and does everything
+ * that depends on the line alone: the checks of pass 1, and encoding it
+ * except for any label it uses. Throws ScanningFailure if the line cannot
+ * be scanned.
+ */
+void Assembler::describeLine(std::string_view text, TokenArena &tokens,
+                             LineRecord &record, std::vector<LineSpan> &labels,
+                             std::string &step_error) const {
+  tokens.clear();
+  scan(text, tokens);
+  const TokenLine line = tokens.line(0);
+  record = LineRecord{};
+  record.hash = hashLine(text);
+  record.length = static_cast<uint32_t>(text.size());
+  record.kind = LINE_BLANK;
+
+  // .import and .export, as recordDirective() recognizes them.
+  if (line.size() >= 2 && line.kind(1) == Token::ID &&
+      (line.kind(0) == Token::IMPORT || line.kind(0) == Token::EXPORT)) {
+    record.kind = line.kind(0) == Token::IMPORT ? LINE_IMPORT : LINE_EXPORT;
+    record.symbol = spanIn(text, line.lexeme(1));
+    return;
+  }
+  uint32_t ind = 0;
+  while (ind < line.size() && line.kind(ind) == Token::LABEL) {
+    std::string_view label = line.lexeme(ind);
+    labels.push_back(spanIn(text, label.substr(0, label.size() - 1)));
+    record.labelCount++;
+    ind++;
+  }
+  if (ind == line.size())
+    return;
+
+  if (word(ind, line)) {
+    record.kind = LINE_CODE;
+    if (line.kind(ind + 1) == Token::ID) {
+      record.reference = REF_WORD;
+      record.symbol = spanIn(text, line.lexeme(ind + 1));
+    } else {
+      record.word = line.number(ind + 1);
+    }
+    return;
+  }
+  const OpcodeDescriptor *op = instruction(ind, line);
+  if (!op) {
+    record.kind = LINE_INVALID;
+    return;
+  }
+  record.kind = LINE_CODE;
+  if (op->layout == BRANCH && line.kind(ind + 5) == Token::ID) {
+    record.reference = REF_BRANCH;
+    record.symbol = spanIn(text, line.lexeme(ind + 5));
+    record.word = encodeI(op->opcode, line.number(ind + 1),
+                          line.number(ind + 3), 0);
+    return;
+  }
+  // Nothing left depends on other lines, so this is the final encoding.
+  EncodeChunk scratch;
+  if (!encode(*op, ind, line, 0, record.word, scratch)) {
+    record.kind = LINE_BAD_STEP;
+    step_error = std::move(scratch.error_message);
+  }
+}
+
+/*
+ * The two passes over the records of every line, in order. Errors are
+ * found in the order the passes find them, so the message is the one a full
+ * assembly reports. On success the label parts of the records' words are
+ * up to date. Lines outside [first_scanned, end_scanned) came from the
+ * cache; those whose words change are counted as relinked.
+ */
+bool Assembler::linkLines(
+    const std::vector<std::string_view> &text, std::vector<LineRecord> &records,
+    const std::vector<LineSpan> &labels,
+    const std::vector<std::pair<size_t, std::string>> &step_errors,
+    size_t first_scanned, size_t end_scanned, IncrementalStats &stats) {
+  // Intern every name, the symbol each line uses and the labels it defines.
+  std::vector<uint32_t> lineSymbol(records.size(), SymbolTable::NONE);
+  std::vector<uint32_t> labelSymbol(labels.size());
+  size_t l = 0;
+  for (size_t n = 0; n < records.size(); n++) {
+    const LineRecord &record = records[n];
+    for (uint32_t k = 0; k < record.labelCount; k++, l++) {
+      labelSymbol[l] = symbols.intern(spanOf(text[n], labels[l]));
+    }
+    if (record.symbol.length) {
+      lineSymbol[n] = symbols.intern(spanOf(text[n], record.symbol));
+    }
+  }
+  symbolTable.assign(symbols.size(), SymbolInfo{});
+  for (size_t n = 0; n < records.size(); n++) {
+    if (records[n].kind == LINE_IMPORT) {
+      SymbolInfo &info = symbolTable[lineSymbol[n]];
+      info.imported = true;
+      info.defined = true;
+      info.address = 0;
+      merl_module = true;
+    } else if (records[n].kind == LINE_EXPORT) {
+      symbolTable[lineSymbol[n]].exported = true;
+      merl_module = true;
+    }
+  }
+  // A MERL module's code follows its three word header.
+  const uint32_t pc_start = merl_module ? 0xc : 0;
+
+  // Pass 1: labels.
+  uint32_t pc = pc_start;
+  l = 0;
+  for (const LineRecord &record : records) {
+    for (uint32_t k = 0; k < record.labelCount; k++, l++) {
+      SymbolInfo &label = symbolTable[labelSymbol[l]];
+      if (label.defined) {
+        return fail("ERROR: Duplicate Labels");
+      }
+      label.defined = true;
+      label.address = pc;
+    }
+    if (record.kind == LINE_INVALID) {
+      return fail("ERROR: Invalid instruction or parameters");
+    }
+    if (record.kind == LINE_CODE || record.kind == LINE_BAD_STEP) {
+      pc += 4;
+    }
+  }
+
+  // Pass 2: words.
+  assembly_binary_code.resize((pc - pc_start) / 4);
+  uint32_t *out = assembly_binary_code.data();
+  pc = pc_start;
+  for (size_t n = 0; n < records.size(); n++) {
+    LineRecord &record = records[n];
+    if (record.kind == LINE_BAD_STEP) {
+      for (const auto &error : step_errors) {
+        if (error.first == n) {
+          return fail(error.second);
+        }
+      }
+    }
+    if (record.kind != LINE_CODE)
+      continue;
+    pc += 4;
+    uint32_t word = record.word;
+    if (record.reference != REF_NONE) {
+      const uint32_t symbol = lineSymbol[n];
+      const SymbolInfo &label = symbolTable[symbol];
+      if (record.reference == REF_WORD) {
+        if (!label.defined) {
+          return fail("ERROR: Invalid Lablel:" +
+                      std::string(symbols.name(symbol)));
+        }
+        word = label.address;
+        word_references.push_back({symbol, pc - 4});
+      } else {
+        if (!label.defined) {
+          return fail("ERROR: " + std::string(symbols.name(symbol)) +
+                      " is an invalid token");
+        }
+        uint32_t i = label.address - pc;
+        i = i / 4;
+        word = (word & 0xffff0000) | (i & 0xffff);
+        branch_references.push_back({symbol, pc - 4});
+      }
+      if (word != record.word && (n < first_scanned || n >= end_scanned)) {
+        stats.relinked++;
+      }
+      record.word = word;
+    }
+    *out++ = word;
+  }
+  return true;
+}
+
+bool Assembler::assembleIncremental(std::string_view source,
+                                    const AsmOptions &options,
+                                    LineCache &cache, AsmReturn &result,
+                                    IncrementalStats &stats) {
+  moveResults(result);
+  result.merl_header = {};
+  result.entries_binary.clear();
+  stats = IncrementalStats{};
+
+  std::vector<std::string_view> text;
+  forEachLine(source, [&](std::string_view line) { text.push_back(line); });
+  std::vector<uint64_t> hashes(text.size());
+  for (size_t n = 0; n < text.size(); n++) {
+    hashes[n] = hashLine(text[n]);
+  }
+  stats.lines = text.size();
+
+  // The unchanged lines are the longest common prefix and suffix.
+  const std::vector<LineRecord> &old = cache.lines;
+  auto same = [&](size_t n, size_t o) {
+    return hashes[n] == old[o].hash && text[n].size() == old[o].length;
+  };
+  const size_t common = std::min(text.size(), old.size());
+  size_t prefix = 0;
+  while (prefix < common && same(prefix, prefix)) {
+    prefix++;
+  }
+  size_t suffix = 0;
+  while (prefix + suffix < common &&
+         same(text.size() - 1 - suffix, old.size() - 1 - suffix)) {
+    suffix++;
+  }
+  if ((prefix + suffix) * 100 < text.size() * kMinReusePercent) {
+    prefix = suffix = 0;
+    stats.full = true;
+  }
+  const size_t first_scanned = prefix;
+  const size_t end_scanned = text.size() - suffix;
+  stats.reused = prefix + suffix;
+
+  std::vector<LineRecord> records(text.size());
+  std::vector<LineSpan> labels;
+  std::vector<std::pair<size_t, std::string>> step_errors;
+  // The labels of the cached prefix, then of the changed lines, then of the
+  // cached suffix.
+  size_t old_label = 0;
+  for (size_t n = 0; n < prefix; n++) {
+    old_label += old[n].labelCount;
+  }
+  labels.assign(cache.labels.begin(), cache.labels.begin() + old_label);
+  std::copy(old.begin(), old.begin() + prefix, records.begin());
+  try {
+    std::string step_error;
+    // Holds one line at a time.
+    TokenArena tokens;
+    for (size_t n = first_scanned; n < end_scanned; n++) {
+      describeLine(text[n], tokens, records[n], labels, step_error);
+      if (!step_error.empty()) {
+        step_errors.emplace_back(n, std::move(step_error));
+        step_error.clear();
+      }
+    }
+  } catch (ScanningFailure &f) {
+    fail(f.what());
+    moveResults(result);
+    return false;
+  }
+  const size_t old_suffix = old.size() - suffix;
+  for (size_t o = prefix; o < old_suffix; o++) {
+    old_label += old[o].labelCount;
+  }
+  labels.insert(labels.end(), cache.labels.begin() + old_label,
+                cache.labels.end());
+  std::copy(old.begin() + old_suffix, old.end(), records.begin() + end_scanned);
+
+  if (!linkLines(text, records, labels, step_errors, first_scanned,
+                 end_scanned, stats)) {
+    moveResults(result);
+    return false;
+  }
+  cache.lines.swap(records);
+  cache.labels.swap(labels);
+  moveResults(result);
+  if (result.merl_module && options.merl_records) {
+    get_entries_binary(result, result.entries_binary, options.merl_format);
+    result.merl_header = merlHeader(result.assembly_binary_code.size(),
+                                    result.entries_binary.size(),
+                                    options.merl_format);
+  }
+  return true;
+}
@@ -0,0 +1,167 @@
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include "linecache.h"
+#include "sourcefile.h"
+#include "wordio.h"
+
+namespace {
+
+struct CacheHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+  uint64_t lineCount;
+  uint64_t labelCount;
+  // hashLine() of the bytes of the records and of the labels.
+  uint64_t lineHash;
+  uint64_t labelHash;
+};
+
+const char kCacheMagic[8] = {'B', 'I', 'N', 'A', 'S', 'M', 'L', 'C'};
+const uint32_t kCacheVersion = 2;
+
+template <typename T>
+std::string_view bytesOf(const std::vector<T> &items) {
+  return {reinterpret_cast<const char *>(items.data()),
+          items.size() * sizeof(T)};
+}
+
+// True if span lies within a line of the given length.
+bool fitsIn(LineSpan span, uint32_t length) {
+  return span.offset <= length && span.length <= length - span.offset;
+}
+
+/*
+ * Checks that records and labels are something describeLine() could have
+ * produced, so that nothing read from a damaged or foreign file can send
+ * incremental assembly outside a line or the label list.
+ */
+bool validRecords(const std::vector<LineRecord> &lines,
+                  const std::vector<LineSpan> &labels) {
+  uint64_t label = 0;
+  for (const LineRecord &record : lines) {
+    if (record.kind > LINE_EXPORT || record.reference > REF_BRANCH ||
+        (record.reference != REF_NONE && record.kind != LINE_CODE) ||
+        record.reserved[0] != 0 || record.reserved[1] != 0) {
+      return false;
+    }
+    // Directives and label references name a symbol; nothing else does.
+    const bool named = record.kind == LINE_IMPORT ||
+                       record.kind == LINE_EXPORT ||
+                       record.reference != REF_NONE;
+    if ((record.symbol.length != 0) != named ||
+        !fitsIn(record.symbol, record.length)) {
+      return false;
+    }
+    if (record.labelCount > labels.size() - label ||
+        (record.labelCount != 0 &&
+         (record.kind == LINE_IMPORT || record.kind == LINE_EXPORT))) {
+      return false;
+    }
+    for (uint32_t k = 0; k < record.labelCount; k++, label++) {
+      if (labels[label].length == 0 ||
+          !fitsIn(labels[label], record.length)) {
+        return false;
+      }
+    }
+  }
+  return label == labels.size();
+}
+
+} // namespace
+
+uint64_t hashLine(std::string_view line) {
+  const uint64_t multiplier = 0xff51afd7ed558ccdULL;
+  uint64_t hash = 0x9e3779b97f4a7c15ULL ^ line.size();
+  size_t i = 0;
+  for (; i + 8 <= line.size(); i += 8) {
+    uint64_t word;
+    std::memcpy(&word, line.data() + i, 8);
+    hash = (hash ^ word) * multiplier;
+    hash ^= hash >> 32;
+  }
+  uint64_t tail = 0;
+  std::memcpy(&tail, line.data() + i, line.size() - i);
+  hash = (hash ^ tail) * multiplier;
+  return hash ^ (hash >> 29);
+}
+
+bool LineCache::load(const std::string &path) {
+  clear();
+  SourceFile file;
+  try {
+    file.map(path);
+  } catch (SourceFailure &) {
+    return false;
+  }
+  std::string_view data = file.text();
+  CacheHeader header;
+  if (data.size() < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data.data(), sizeof(header));
+  if (std::memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0 ||
+      header.version != kCacheVersion ||
+      header.recordSize != sizeof(LineRecord) ||
+      header.lineCount > data.size() / sizeof(LineRecord) ||
+      header.labelCount > data.size() / sizeof(LineSpan) ||
+      data.size() != sizeof(header) + header.lineCount * sizeof(LineRecord) +
+                         header.labelCount * sizeof(LineSpan)) {
+    return false;
+  }
+  lines.resize(header.lineCount);
+  labels.resize(header.labelCount);
+  const char *at = data.data() + sizeof(header);
+  std::memcpy(lines.data(), at, lines.size() * sizeof(LineRecord));
+  at += lines.size() * sizeof(LineRecord);
+  std::memcpy(labels.data(), at, labels.size() * sizeof(LineSpan));
+  if (hashLine(bytesOf(lines)) != header.lineHash ||
+      hashLine(bytesOf(labels)) != header.labelHash ||
+      !validRecords(lines, labels)) {
+    clear();
+    return false;
+  }
+  return true;
+}
+
+bool LineCache::save(const std::string &path) const {
+  CacheHeader header;
+  std::memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+  header.version = kCacheVersion;
+  header.recordSize = sizeof(LineRecord);
+  header.lineCount = lines.size();
+  header.labelCount = labels.size();
+  header.lineHash = hashLine(bytesOf(lines));
+  header.labelHash = hashLine(bytesOf(labels));
+
+  const std::string partial = path + ".tmp";
+  int fd = open(partial.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = writeBytes(fd, &header, sizeof(header)) &&
+            writeBytes(fd, lines.data(), lines.size() * sizeof(LineRecord)) &&
+            writeBytes(fd, labels.data(), labels.size() * sizeof(LineSpan));
+  int err = errno;
+  if (close(fd) < 0 && ok) {
+    ok = false;
+    err = errno;
+  }
+  if (ok && std::rename(partial.c_str(), path.c_str()) < 0) {
+    ok = false;
+    err = errno;
+  }
+  if (!ok) {
+    unlink(partial.c_str());
+  }
+  errno = err;
+  return ok;
+}
+
+void LineCache::clear() {
+  lines.clear();
+  labels.clear();
+}
@@ -0,0 +1,86 @@
+#ifndef CS241_LINECACHE_H
+#define CS241_LINECACHE_H
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* The per-line cache behind incremental assembly.
+ *
+ * A LineRecord holds everything assembling needs to know about one source
+ * line that does not depend on the rest of the source: what kind of line it
+ * is, the labels it defines, the name it refers to and its encoding. Names
+ * are kept as spans of the line rather than as strings, so when a line is
+ * found unchanged its names are taken straight from the new source. The
+ * line itself is identified by the hash and length of its text.
+ *
+ * The cache file is the records in host byte order behind a short header;
+ * it is only meant to be read back by the binasm that wrote it.
+ */
+
+enum LineKind : uint8_t {
+  LINE_BLANK = 0, // nothing, or only labels
+  LINE_CODE,      // an instruction or .word: one word of output
+  LINE_IMPORT,
+  LINE_EXPORT,
+  // Only while assembling; a cache never holds a line with an error.
+  LINE_INVALID,  // rejected by pass 1
+  LINE_BAD_STEP  // a branch whose step count is out of range
+};
+
+// What the label part of a LINE_CODE word depends on.
+enum LineReference : uint8_t {
+  REF_NONE = 0,
+  REF_WORD,  // .word label: the word is the label's address
+  REF_BRANCH // beq/bne label: the low half is the offset to the label
+};
+
+// The name of a symbol, as a span of its line.
+struct LineSpan {
+  uint32_t offset;
+  uint32_t length;
+};
+
+struct LineRecord {
+  uint64_t hash;
+  uint32_t length;
+  // The encoding. For REF_BRANCH the low half is filled in when the label
+  // is resolved.
+  uint32_t word;
+  // The label a LINE_CODE word refers to, or the symbol a LINE_IMPORT or
+  // LINE_EXPORT names; empty otherwise.
+  LineSpan symbol;
+  // How many labels the line defines; they follow on from those of the
+  // lines before it in LineCache::labels.
+  uint32_t labelCount;
+  uint8_t kind;
+  uint8_t reference;
+  uint8_t reserved[2];
+};
+static_assert(sizeof(LineRecord) == 32, "LineRecord is stored as is");
+
+// Hashes the text of a line, eight bytes at a time.
+uint64_t hashLine(std::string_view line);
+
+class LineCache {
+  public:
+    std::vector<LineRecord> lines;
+    // The labels every line defines, in source order.
+    std::vector<LineSpan> labels;
+
+    /* Replaces the cache with the one stored at path. Returns false, leaving
+     * the cache empty, if there is no such file, it is not a cache this
+     * version wrote, or any of its records could not have been written by
+     * it (such as a span that runs past the end of its line).
+     */
+    bool load(const std::string &path);
+
+    /* Stores the cache at path, replacing any previous file only once the
+     * new one is complete. Returns false (with errno set) on failure.
+     */
+    bool save(const std::string &path) const;
+
+    void clear();
+};
+
+#endif
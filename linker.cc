@@ -0,0 +1,129 @@
+#include <algorithm>
+#include "linker.h"
+#include "symbols.h"
+#include "threadpool.h"
+
+namespace {
+
+// What linking leaves of one module's records, with addresses moved.
+struct LinkedRecords {
+  std::vector<uint32_t> relocations;
+  std::vector<MerlSymbol> imports; // names are still the module's
+};
+
+void linkModules(const std::vector<MerlModule> &modules, ThreadPool &pool,
+                 MerlModule &linked) {
+  linked.clear();
+  const size_t count = modules.size();
+
+  // Where each module's code goes.
+  std::vector<size_t> codeStart(count + 1, 0);
+  for (size_t m = 0; m < count; m++) {
+    codeStart[m + 1] = codeStart[m] + modules[m].code.size();
+  }
+  if (codeStart[count] > (UINT32_MAX - MERL_CODE_START) / 4) {
+    throw MerlFailure("ERROR: Linked code is too large for a MERL file");
+  }
+  auto shift = [&](size_t m) {
+    return static_cast<uint32_t>(codeStart[m] * 4);
+  };
+
+  // Every export, by name, at its linked address.
+  SymbolTable exportNames;
+  std::vector<uint32_t> exportAddress;
+  std::vector<size_t> namesStart(count + 1, 0);
+  for (size_t m = 0; m < count; m++) {
+    const MerlModule &module = modules[m];
+    namesStart[m + 1] = namesStart[m] + module.names.size();
+    for (const MerlSymbol &symbol : module.exports) {
+      std::string_view name = module.name(symbol);
+      if (exportNames.intern(name) != exportAddress.size()) {
+        throw MerlFailure("ERROR: Duplicate export: " + std::string(name));
+      }
+      const uint32_t address = symbol.address + shift(m);
+      exportAddress.push_back(address);
+      linked.exports.push_back(
+          {address, static_cast<uint32_t>(symbol.nameOffset + namesStart[m]),
+           symbol.nameLength});
+    }
+  }
+
+  // Each module's code and records, moved and resolved on its own.
+  linked.code.resize(codeStart[count]);
+  std::vector<LinkedRecords> parts(count);
+  pool.run(count, [&](size_t m, unsigned) {
+    const MerlModule &module = modules[m];
+    const uint32_t by = shift(m);
+    uint32_t *code = linked.code.data() + codeStart[m];
+    std::copy(module.code.begin(), module.code.end(), code);
+    LinkedRecords &part = parts[m];
+    part.relocations.reserve(module.relocations.size() +
+                             module.imports.size());
+    for (uint32_t address : module.relocations) {
+      code[(address - MERL_CODE_START) / 4] += by;
+      part.relocations.push_back(address + by);
+    }
+    for (const MerlSymbol &symbol : module.imports) {
+      const uint32_t id = exportNames.find(module.name(symbol));
+      if (id == SymbolTable::NONE) {
+        part.imports.push_back(
+            {symbol.address + by, symbol.nameOffset, symbol.nameLength});
+        continue;
+      }
+      code[(symbol.address - MERL_CODE_START) / 4] = exportAddress[id];
+      part.relocations.push_back(symbol.address + by);
+    }
+  });
+
+  // Gather the records in module order.
+  std::vector<size_t> relocationStart(count + 1, 0);
+  std::vector<size_t> importStart(count + 1, 0);
+  for (size_t m = 0; m < count; m++) {
+    relocationStart[m + 1] = relocationStart[m] + parts[m].relocations.size();
+    importStart[m + 1] = importStart[m] + parts[m].imports.size();
+  }
+  linked.relocations.resize(relocationStart[count]);
+  linked.imports.resize(importStart[count]);
+  linked.names.resize(namesStart[count]);
+  pool.run(count, [&](size_t m, unsigned) {
+    const LinkedRecords &part = parts[m];
+    std::copy(part.relocations.begin(), part.relocations.end(),
+              linked.relocations.begin() + relocationStart[m]);
+    MerlSymbol *imports = linked.imports.data() + importStart[m];
+    for (const MerlSymbol &symbol : part.imports) {
+      *imports = symbol;
+      imports->nameOffset += namesStart[m];
+      imports++;
+    }
+    std::copy(modules[m].names.begin(), modules[m].names.end(),
+              linked.names.begin() + namesStart[m]);
+  });
+}
+
+} // namespace
+
+void linkMerlFiles(const std::vector<std::string> &paths, unsigned threads,
+                   MerlModule &linked) {
+  std::vector<MerlModule> modules(paths.size());
+  std::vector<std::string> errors(paths.size());
+  ThreadPool pool(threads ? threads : defaultThreadCount());
+  pool.run(paths.size(), [&](size_t m, unsigned) {
+    try {
+      loadMerl(paths[m], modules[m]);
+    } catch (MerlFailure &f) {
+      errors[m] = f.what();
+    }
+  });
+  for (const std::string &error : errors) {
+    if (!error.empty()) {
+      throw MerlFailure(error);
+    }
+  }
+  linkModules(modules, pool, linked);
+}
+
+void linkMerlModules(const std::vector<MerlModule> &modules, unsigned threads,
+                     MerlModule &linked) {
+  ThreadPool pool(threads ? threads : defaultThreadCount());
+  linkModules(modules, pool, linked);
+}
@@ -0,0 +1,32 @@
+#ifndef CS241_LINKER_H
+#define CS241_LINKER_H
+#include <string>
+#include <vector>
+#include "merl.h"
+
+/* Links MERL modules into one.
+ *
+ * The modules' code is laid out end to end in the order given. Every
+ * address in a module is moved by the size of the code before it: those in
+ * its records, and those held in the words its REL records name. Each
+ * exported symbol goes into one hash table of every export; an import that
+ * a module exports is filled in with the export's address and becomes a
+ * REL record, and the rest stay imports of the linked module. All exports
+ * are kept.
+ *
+ * Reading the files and moving each module's code and records are spread
+ * over threads threads (0 for one per core). The work is linear in the
+ * total size of the modules: each record is looked at once, and each import
+ * is one lookup in the table of exports.
+ *
+ * Throws MerlFailure if a file cannot be read, if two modules export the
+ * same symbol, or if the linked code would not fit in the address space.
+ */
+void linkMerlFiles(const std::vector<std::string> &paths, unsigned threads,
+                   MerlModule &linked);
+
+// As linkMerlFiles, for modules already in memory.
+void linkMerlModules(const std::vector<MerlModule> &modules, unsigned threads,
+                     MerlModule &linked);
+
+#endif
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <vector>
+#include "loader.h"
+
+namespace {
+
+/* Marks the word at every address in bits, one bit per word of code. The
+ * first time an address is seen only its bit is set; if it comes again,
+ * delta is added to its word there and then, so every repeat still counts.
+ */
+void markWords(uint32_t *code, const uint32_t *addresses, size_t count,
+               uint32_t first, uint32_t delta, std::vector<uint64_t> &bits) {
+  for (size_t i = 0; i < count; i++) {
+    const uint32_t index = (addresses[i] - first) / 4;
+    const uint64_t bit = uint64_t(1) << (index & 63);
+    uint64_t &word = bits[index >> 6];
+    if (word & bit) {
+      code[index] += delta;
+    } else {
+      word |= bit;
+    }
+  }
+}
+
+} // namespace
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+// Adds delta to the marked words of sixteen at a time with a masked add.
+// Compiled for AVX-512 only; relocateWords checks that the CPU has it
+// before calling this.
+__attribute__((target("avx512f")))
+static size_t addMarkedAvx512(uint32_t *code, size_t words,
+                              const uint64_t *bits, uint32_t delta) {
+  const __m512i add = _mm512_set1_epi32(static_cast<int>(delta));
+  size_t i = 0;
+  for (; i + 16 <= words; i += 16) {
+    const __mmask16 marked = static_cast<__mmask16>(bits[i >> 6] >> (i & 63));
+    if (!marked) {
+      continue;
+    }
+    __m512i block = _mm512_loadu_si512(code + i);
+    _mm512_storeu_si512(code + i, _mm512_mask_add_epi32(block, marked, block,
+                                                        add));
+  }
+  return i;
+}
+#endif
+
+void relocateWords(uint32_t *code, size_t words, uint32_t first,
+                   const uint32_t *addresses, size_t count, uint32_t delta) {
+  if (std::is_sorted(addresses, addresses + count)) {
+    // Already one pass in order over the code, as packed REL records read.
+    for (size_t i = 0; i < count; i++) {
+      code[(addresses[i] - first) / 4] += delta;
+    }
+    return;
+  }
+  std::vector<uint64_t> bits((words + 63) / 64);
+  markWords(code, addresses, count, first, delta, bits);
+  size_t i = 0;
+#if defined(__x86_64__) || defined(__i386__)
+  static const bool avx512 = __builtin_cpu_supports("avx512f");
+  if (avx512) {
+    i = addMarkedAvx512(code, words, bits.data(), delta);
+  }
+#endif
+  // The rest a set bit at a time, skipping runs of unmarked words.
+  for (size_t w = i / 64; w < bits.size(); w++) {
+    uint64_t marked = bits[w];
+    if (w == i / 64) {
+      marked &= ~uint64_t(0) << (i & 63);
+    }
+    for (; marked; marked &= marked - 1) {
+      code[w * 64 + __builtin_ctzll(marked)] += delta;
+    }
+  }
+}
+
+void loadModule(MerlModule &module, uint32_t load_address) {
+  if (load_address % 4 != 0) {
+    throw MerlFailure("ERROR: Load address is not a multiple of 4");
+  }
+  if (!module.imports.empty()) {
+    throw MerlFailure("ERROR: Unresolved import: " +
+                      std::string(module.name(module.imports.front())));
+  }
+  relocateWords(module.code.data(), module.code.size(), MERL_CODE_START,
+                module.relocations.data(), module.relocations.size(),
+                load_address - MERL_CODE_START);
+}
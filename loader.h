@@ -0,0 +1,39 @@
+#ifndef CS241_LOADER_H
+#define CS241_LOADER_H
+#include <cstddef>
+#include <cstdint>
+#include "merl.h"
+
+/* Loading MERL modules at an address.
+ *
+ * A module's addresses count from the start of its file, whose first code
+ * word is at MERL_CODE_START. Loading its code at load_address moves every
+ * address by load_address - MERL_CODE_START, so that is what is added to
+ * each word a REL record names.
+ */
+
+/* Adds delta to the word at each of the count addresses, where code holds
+ * words words from address first on; every address must be that of one of
+ * them. An address that appears more than once gets delta added once for
+ * each time.
+ *
+ * REL records come in no particular order, and adding to the words in that
+ * order is a random access into the code for each one. Instead the
+ * addresses only set bits in a bitmap of the code, an eighth of a byte per
+ * word that mostly stays in cache, and then one pass in order over the code
+ * adds delta to every marked word. Where the CPU has AVX-512 the pass
+ * goes sixteen words at a time with a masked add. Addresses already in
+ * order, as packed REL records are read, are added to directly in one pass.
+ */
+void relocateWords(uint32_t *code, size_t words, uint32_t first,
+                   const uint32_t *addresses, size_t count, uint32_t delta);
+
+/* Turns the code of module, in place, into its image when loaded at
+ * load_address, which must be a multiple of 4. The REL addresses, which
+ * reading the module collected into one array, are applied with
+ * relocateWords. Throws MerlFailure, leaving the code as it was, if the module still has
+ * imports, which loading cannot fill in.
+ */
+void loadModule(MerlModule &module, uint32_t load_address);
+
+#endif
@@ -0,0 +1,493 @@
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include "merl.h"
+#include "sourcefile.h"
+#include "wordio.h"
+
+namespace {
+
+// Reads the big-endian words of a MERL file, checking every read.
+class WordReader {
+    const char *bytes;
+    size_t count;
+
+  public:
+    explicit WordReader(std::string_view data)
+        : bytes(data.data()), count(data.size() / 4) {}
+
+    size_t size() const { return count; }
+
+    uint32_t operator[](size_t i) const {
+      uint32_t word;
+      std::memcpy(&word, bytes + i * 4, 4);
+      return __builtin_bswap32(word);
+    }
+
+    const char *at(size_t i) const { return bytes + i * 4; }
+};
+
+std::string hex(uint32_t value) {
+  static const char digits[] = "0123456789abcdef";
+  std::string out = "0x";
+  bool started = false;
+  for (int shift = 28; shift >= 0; shift -= 4) {
+    unsigned digit = (value >> shift) & 0xf;
+    if (digit || started || shift == 0) {
+      out += digits[digit];
+      started = true;
+    }
+  }
+  return out;
+}
+
+// Reads the length and name that follow the address of an ESR or ESD
+// record at word i, returning the index of the next record.
+size_t readSymbol(const WordReader &words, size_t i, size_t end,
+                  std::vector<MerlSymbol> &symbols, MerlModule &module) {
+  if (i + 3 > end) {
+    throw MerlFailure("ERROR: Truncated MERL record at " + hex(i * 4));
+  }
+  const uint32_t address = words[i + 1];
+  const uint32_t length = words[i + 2];
+  if (length > end - i - 3) {
+    throw MerlFailure("ERROR: MERL symbol name runs past the end of the "
+                      "module at " + hex(i * 4));
+  }
+  const size_t offset = module.names.size();
+  module.names.resize(offset + length);
+  for (uint32_t k = 0; k < length; k++) {
+    const uint32_t c = words[i + 3 + k];
+    if (c == 0 || c > 0xff) {
+      throw MerlFailure("ERROR: Invalid character in MERL symbol name at " +
+                        hex((i + 3 + k) * 4));
+    }
+    module.names[offset + k] = static_cast<char>(c);
+  }
+  symbols.push_back({address, static_cast<uint32_t>(offset), length});
+  return i + 3 + length;
+}
+
+// Reads the string table of a v2 module at word i into module.names, with
+// the span of each name in strings, returning the index of the next record.
+size_t readStrings(const WordReader &words, size_t i, size_t end,
+                   std::vector<MerlSymbol> &strings, MerlModule &module) {
+  if (i + 3 > end) {
+    throw MerlFailure("ERROR: Truncated MERL record at " + hex(i * 4));
+  }
+  const uint32_t count = words[i + 1];
+  const uint32_t length = words[i + 2];
+  if (length / 4 + (length % 4 != 0) > end - i - 3) {
+    throw MerlFailure("ERROR: MERL string table runs past the end of the "
+                      "module at " + hex(i * 4));
+  }
+  // The names are big-endian words, so the bytes are in file order.
+  const std::string_view table(words.at(i + 3), length);
+  if (count > length || (length && table.back() != '\0')) {
+    throw MerlFailure("ERROR: Invalid MERL string table at " + hex(i * 4));
+  }
+  strings.reserve(count);
+  module.names.reserve(module.names.size() + length - count);
+  size_t start = 0;
+  for (uint32_t k = 0; k < count; k++) {
+    const size_t nul = table.find('\0', start);
+    if (nul == std::string_view::npos) {
+      throw MerlFailure("ERROR: MERL string table at " + hex(i * 4) +
+                        " holds fewer than " + std::to_string(count) +
+                        " names");
+    }
+    strings.push_back({0, static_cast<uint32_t>(module.names.size()),
+                       static_cast<uint32_t>(nul - start)});
+    module.names.append(table.substr(start, nul - start));
+    start = nul + 1;
+  }
+  if (start != length) {
+    throw MerlFailure("ERROR: MERL string table at " + hex(i * 4) +
+                      " holds more than " + std::to_string(count) + " names");
+  }
+  // The padding of the last word.
+  for (size_t k = length; k % 4 != 0; k++) {
+    if (words.at(i + 3)[k] != '\0') {
+      throw MerlFailure("ERROR: Invalid MERL string table at " + hex(i * 4));
+    }
+  }
+  return i + 3 + (length + 3) / 4;
+}
+
+// Reads the address and name index of a v2 ESR or ESD record at word i,
+// returning the index of the next record.
+size_t readIndexedSymbol(const WordReader &words, size_t i, size_t end,
+                         const std::vector<MerlSymbol> &strings,
+                         std::vector<MerlSymbol> &symbols) {
+  if (i + 3 > end) {
+    throw MerlFailure("ERROR: Truncated MERL record at " + hex(i * 4));
+  }
+  const uint32_t index = words[i + 2];
+  if (index >= strings.size()) {
+    throw MerlFailure("ERROR: MERL name index " + std::to_string(index) +
+                      " at " + hex(i * 4) + " is not in the string table");
+  }
+  symbols.push_back(
+      {words[i + 1], strings[index].nameOffset, strings[index].nameLength});
+  return i + 3;
+}
+
+// Reads a packed REL record at word i, appending its addresses to
+// relocations, and returns the index of the next record. Code words run up
+// to, but not including, word codeEnd.
+size_t readPackedRelocations(const WordReader &words, size_t i, size_t end,
+                             size_t codeEnd,
+                             std::vector<uint32_t> &relocations) {
+  if (i + 3 > end) {
+    throw MerlFailure("ERROR: Truncated MERL record at " + hex(i * 4));
+  }
+  const uint32_t count = words[i + 1];
+  const uint32_t length = words[i + 2];
+  const size_t first = MERL_CODE_START / 4;
+  // A byte gives at most one address, or a run of code words.
+  if (length / 4 + (length % 4 != 0) > end - i - 3 ||
+      count > size_t(length) + (codeEnd - first)) {
+    throw MerlFailure("ERROR: Packed REL record at " + hex(i * 4) +
+                      " runs past the end of the module");
+  }
+  const unsigned char *p =
+      reinterpret_cast<const unsigned char *>(words.at(i + 3));
+  const unsigned char *const stop = p + length;
+  const size_t base = relocations.size();
+  relocations.resize(base + count);
+  uint32_t *out = relocations.data() + base;
+  uint32_t *const outEnd = out + count;
+  auto invalid = [&]() {
+    return MerlFailure("ERROR: Invalid packed REL record at " + hex(i * 4));
+  };
+  // The word of the last address, starting just before the code. It
+  // never goes down, so checking the first and last address checks them
+  // all.
+  uint64_t word = first - 1;
+  while (p < stop) {
+    uint64_t x = *p++;
+    if (x & 0x80) {
+      x &= 0x7f;
+      for (unsigned shift = 7;; shift += 7) {
+        if (p == stop || shift > 28) {
+          throw invalid();
+        }
+        const uint64_t byte = *p++;
+        x |= (byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+          break;
+        }
+      }
+    }
+    if (!(x & 1)) {
+      if (out == outEnd) {
+        throw invalid();
+      }
+      word += x >> 1;
+      *out++ = static_cast<uint32_t>(word * 4);
+    } else {
+      // A run of addresses of adjacent words, after the last.
+      const uint64_t run = (x >> 1) + 2;
+      if (run > uint64_t(outEnd - out)) {
+        throw invalid();
+      }
+      for (uint64_t k = 0; k < run; k++) {
+        out[k] = static_cast<uint32_t>((word + 1 + k) * 4);
+      }
+      out += run;
+      word += run;
+    }
+  }
+  if (out != outEnd ||
+      (count && (relocations[base] < MERL_CODE_START || word >= codeEnd))) {
+    throw invalid();
+  }
+  for (size_t k = length; k % 4 != 0; k++) {
+    if (words.at(i + 3)[k] != '\0') {
+      throw invalid();
+    }
+  }
+  return i + 3 + (length + 3) / 4;
+}
+
+// Appends bytes to out packed four to a word, most significant first, the
+// order they have in the big-endian file, with zeros after the last.
+void packBytes(std::string_view bytes, std::vector<uint32_t> &out) {
+  out.reserve(out.size() + (bytes.size() + 3) / 4);
+  size_t k = 0;
+  for (; k + 4 <= bytes.size(); k += 4) {
+    uint32_t word;
+    std::memcpy(&word, bytes.data() + k, 4);
+    out.push_back(__builtin_bswap32(word));
+  }
+  if (k < bytes.size()) {
+    uint32_t word = 0;
+    for (size_t shift = 24; k < bytes.size(); k++, shift -= 8) {
+      word |= uint32_t(static_cast<unsigned char>(bytes[k])) << shift;
+    }
+    out.push_back(word);
+  }
+}
+
+} // namespace
+
+bool hasMerlCookie(std::string_view bytes) {
+  if (bytes.size() < 4) {
+    return false;
+  }
+  uint32_t cookie;
+  std::memcpy(&cookie, bytes.data(), 4);
+  cookie = __builtin_bswap32(cookie);
+  return cookie == MERL_COOKIE || cookie == MERL2_COOKIE;
+}
+
+void MerlModule::addSymbol(std::vector<MerlSymbol> &symbols,
+                           uint32_t address, std::string_view name) {
+  symbols.push_back({address, static_cast<uint32_t>(names.size()),
+                     static_cast<uint32_t>(name.size())});
+  names.append(name);
+}
+
+void MerlModule::clear() {
+  code.clear();
+  relocations.clear();
+  imports.clear();
+  exports.clear();
+  names.clear();
+}
+
+MerlFormat readMerl(std::string_view bytes, MerlModule &module) {
+  module.clear();
+  const WordReader words(bytes);
+  if (bytes.size() % 4 != 0 || words.size() < 3 ||
+      (words[0] != MERL_COOKIE && words[0] != MERL2_COOKIE)) {
+    throw MerlFailure("ERROR: Not a MERL file");
+  }
+  MerlFormat format = words[0] == MERL_COOKIE ? MERL_V1 : MERL_V2;
+  const uint32_t end_of_module = words[1];
+  const uint32_t end_of_code = words[2];
+  if (end_of_module != bytes.size()) {
+    throw MerlFailure("ERROR: MERL header gives a module length of " +
+                      hex(end_of_module) + " for a file of " +
+                      hex(bytes.size()) + " bytes");
+  }
+  if (end_of_code < MERL_CODE_START || end_of_code > end_of_module ||
+      end_of_code % 4 != 0) {
+    throw MerlFailure("ERROR: Invalid end of code in MERL header: " +
+                      hex(end_of_code));
+  }
+
+  // The code section goes across in one pass.
+  const size_t first = MERL_CODE_START / 4;
+  const size_t code_end = end_of_code / 4;
+  module.code.resize(code_end - first);
+  const char *code = words.at(first);
+  if (reinterpret_cast<uintptr_t>(code) % alignof(uint32_t) != 0) {
+    std::memcpy(module.code.data(), code, module.code.size() * 4);
+    code = reinterpret_cast<const char *>(module.code.data());
+  }
+  swapWords(reinterpret_cast<const uint32_t *>(code), module.code.data(),
+            module.code.size());
+
+  auto inCode = [&](uint32_t address) {
+    return address >= MERL_CODE_START && address < end_of_code &&
+           address % 4 == 0;
+  };
+  size_t i = code_end;
+  const size_t end = words.size();
+  // The names of a v2 module's string table, as spans of module.names.
+  std::vector<MerlSymbol> strings;
+  bool haveStrings = false;
+  while (i < end) {
+    const uint32_t marker = words[i];
+    if (marker == MERL_REL) {
+      if (i + 2 > end) {
+        throw MerlFailure("ERROR: Truncated MERL record at " + hex(i * 4));
+      }
+      const uint32_t address = words[i + 1];
+      if (!inCode(address)) {
+        throw MerlFailure("ERROR: REL record at " + hex(i * 4) +
+                          " patches " + hex(address) +
+                          ", which is not a code word");
+      }
+      module.relocations.push_back(address);
+      i += 2;
+    } else if (marker == MERL_PACKED_REL && format != MERL_V1) {
+      i = readPackedRelocations(words, i, end, code_end, module.relocations);
+      format = MERL_V2_PACKED;
+    } else if (marker == MERL_STRINGS && format != MERL_V1) {
+      if (haveStrings) {
+        throw MerlFailure("ERROR: Second MERL string table at " + hex(i * 4));
+      }
+      i = readStrings(words, i, end, strings, module);
+      haveStrings = true;
+    } else if (marker == MERL_ESR) {
+      i = format == MERL_V1
+              ? readSymbol(words, i, end, module.imports, module)
+              : readIndexedSymbol(words, i, end, strings, module.imports);
+      if (!inCode(module.imports.back().address)) {
+        throw MerlFailure("ERROR: ESR record for " +
+                          std::string(module.name(module.imports.back())) +
+                          " patches " + hex(module.imports.back().address) +
+                          ", which is not a code word");
+      }
+    } else if (marker == MERL_ESD) {
+      i = format == MERL_V1
+              ? readSymbol(words, i, end, module.exports, module)
+              : readIndexedSymbol(words, i, end, strings, module.exports);
+    } else {
+      throw MerlFailure("ERROR: Unknown MERL record " + hex(marker) + " at " +
+                        hex(i * 4));
+    }
+  }
+  return format;
+}
+
+MerlFormat loadMerl(const std::string &path, MerlModule &module) {
+  SourceFile file;
+  try {
+    file.map(path);
+    return readMerl(file.text(), module);
+  } catch (SourceFailure &f) {
+    throw MerlFailure(f.what());
+  } catch (MerlFailure &f) {
+    throw MerlFailure(path + ": " + f.what());
+  }
+}
+
+void merlStrings(const std::vector<std::string_view> &names,
+                 std::vector<uint32_t> &out) {
+  std::string table;
+  for (std::string_view name : names) {
+    table.append(name);
+    table += '\0';
+  }
+  out.push_back(MERL_STRINGS);
+  out.push_back(static_cast<uint32_t>(names.size()));
+  out.push_back(static_cast<uint32_t>(table.size()));
+  packBytes(table, out);
+}
+
+void merlPackedRelocations(std::vector<uint32_t> addresses,
+                           std::vector<uint32_t> &out) {
+  std::sort(addresses.begin(), addresses.end());
+  std::string bytes;
+  bytes.reserve(addresses.size());
+  auto put = [&](uint64_t x) {
+    for (; x >= 0x80; x >>= 7) {
+      bytes += static_cast<char>(x | 0x80);
+    }
+    bytes += static_cast<char>(x);
+  };
+  // Each address is its distance in words from the last, doubled; an odd
+  // number 2k + 1 stands for the addresses of the next k + 2 words.
+  uint64_t last = MERL_CODE_START / 4 - 1;
+  const size_t count = addresses.size();
+  for (size_t k = 0; k < count;) {
+    size_t run = 0;
+    while (k + run < count && addresses[k + run] / 4 == last + 1 + run) {
+      run++;
+    }
+    if (run >= 2) {
+      put((run - 2) << 1 | 1);
+      last += run;
+      k += run;
+    } else {
+      put((addresses[k] / 4 - last) << 1);
+      last = addresses[k] / 4;
+      k++;
+    }
+  }
+  out.push_back(MERL_PACKED_REL);
+  out.push_back(static_cast<uint32_t>(count));
+  out.push_back(static_cast<uint32_t>(bytes.size()));
+  packBytes(bytes, out);
+}
+
+void merlRecords(const MerlModule &module, std::vector<uint32_t> &out,
+                 MerlFormat format) {
+  if (format != MERL_V1) {
+    // Each name once, in order of first use.
+    std::unordered_map<std::string_view, uint32_t> index;
+    std::vector<std::string_view> names;
+    std::vector<uint32_t> importIndex, exportIndex;
+    auto intern = [&](const std::vector<MerlSymbol> &list,
+                      std::vector<uint32_t> &ids) {
+      ids.reserve(list.size());
+      for (const MerlSymbol &symbol : list) {
+        auto [it, added] = index.emplace(module.name(symbol), names.size());
+        if (added) {
+          names.push_back(module.name(symbol));
+        }
+        ids.push_back(it->second);
+      }
+    };
+    intern(module.imports, importIndex);
+    intern(module.exports, exportIndex);
+    merlStrings(names, out);
+    if (format == MERL_V2_PACKED) {
+      merlPackedRelocations(module.relocations, out);
+    } else {
+      out.reserve(out.size() + module.relocations.size() * 2);
+      for (uint32_t address : module.relocations) {
+        out.push_back(MERL_REL);
+        out.push_back(address);
+      }
+    }
+    out.reserve(out.size() +
+                (module.imports.size() + module.exports.size()) * 3);
+    for (size_t k = 0; k < module.imports.size(); k++) {
+      out.push_back(MERL_ESR);
+      out.push_back(module.imports[k].address);
+      out.push_back(importIndex[k]);
+    }
+    for (size_t k = 0; k < module.exports.size(); k++) {
+      out.push_back(MERL_ESD);
+      out.push_back(module.exports[k].address);
+      out.push_back(exportIndex[k]);
+    }
+    return;
+  }
+  size_t words = module.relocations.size() * 2 + module.names.size() +
+                 (module.imports.size() + module.exports.size()) * 3;
+  out.reserve(out.size() + words);
+  for (uint32_t address : module.relocations) {
+    out.push_back(MERL_REL);
+    out.push_back(address);
+  }
+  auto symbols = [&](uint32_t marker, const std::vector<MerlSymbol> &list) {
+    for (const MerlSymbol &symbol : list) {
+      out.push_back(marker);
+      out.push_back(symbol.address);
+      out.push_back(symbol.nameLength);
+      for (char c : module.name(symbol)) {
+        out.push_back(static_cast<unsigned char>(c));
+      }
+    }
+  };
+  symbols(MERL_ESR, module.imports);
+  symbols(MERL_ESD, module.exports);
+}
+
+std::array<uint32_t, 3> merlHeader(size_t codeWords, size_t recordWords,
+                                   MerlFormat format) {
+  const uint32_t end_of_code = MERL_CODE_START + codeWords * 4;
+  const uint32_t cookie = format == MERL_V1 ? MERL_COOKIE : MERL2_COOKIE;
+  return {cookie, static_cast<uint32_t>(end_of_code + recordWords * 4),
+          end_of_code};
+}
+
+bool writeMerlFile(const char *path, const MerlModule &module,
+                   MerlFormat format) {
+  std::vector<uint32_t> records;
+  merlRecords(module, records, format);
+  const std::array<uint32_t, 3> header =
+      merlHeader(module.code.size(), records.size(), format);
+  return writeBigEndianFile(
+      path, {WordSpan(header.data(), header.size()), module.code, records});
+}
+
+MerlFailure::MerlFailure(std::string message) : message(std::move(message)) {}
+
+const std::string &MerlFailure::what() const { return message; }
@@ -0,0 +1,137 @@
+#ifndef CS241_MERL_H
+#define CS241_MERL_H
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/* MERL modules in memory (see docs/merl.md).
+ *
+ * Every address in a MERL file, those in its records as well as those held
+ * in code words, is counted from the start of the file, so the first code
+ * word is at MERL_CODE_START. A MerlModule keeps them that way; only the
+ * words are converted to host byte order.
+ *
+ * MERL v2 keeps the header and code of v1 but stores each symbol name once,
+ * packed four bytes to a word in a string table, and its ESR and ESD
+ * records name symbols by their index in that table. Modules read the same
+ * from either format, so converting between them only rewrites the records.
+ *
+ * A v2 module may also hold all of its REL records as one packed record:
+ * the addresses in order, each as a varint of its distance from the one
+ * before, with runs of adjacent words as a single varint. Reading it gives
+ * the relocations in address order.
+ */
+
+enum MerlFormat {
+  MERL_V1,
+  MERL_V2,
+  MERL_V2_PACKED // v2 with the REL records packed into one
+};
+
+const uint32_t MERL_COOKIE = 0x10000002;
+// beq $1, $1, 2: like the v1 cookie, a branch over the rest of the header.
+const uint32_t MERL2_COOKIE = 0x10210002;
+const uint32_t MERL_CODE_START = 0xc;
+// Record markers.
+const uint32_t MERL_REL = 0x01;
+const uint32_t MERL_ESD = 0x05;
+const uint32_t MERL_ESR = 0x11;
+// The string table of a v2 module.
+const uint32_t MERL_STRINGS = 0x21;
+// Packed REL records, in v2 only.
+const uint32_t MERL_PACKED_REL = 0x31;
+
+// An ESR or ESD record: an address and the name of a symbol.
+struct MerlSymbol {
+  uint32_t address;
+  // The name, as a span of MerlModule::names.
+  uint32_t nameOffset;
+  uint32_t nameLength;
+};
+
+class MerlModule {
+  public:
+    std::vector<uint32_t> code;
+    // REL records: the addresses of words that hold addresses.
+    std::vector<uint32_t> relocations;
+    // ESR records: the addresses of words that hold an imported symbol.
+    std::vector<MerlSymbol> imports;
+    // ESD records: the addresses of exported symbols.
+    std::vector<MerlSymbol> exports;
+    // The names of every import and export, end to end.
+    std::string names;
+
+    std::string_view name(const MerlSymbol &symbol) const {
+      return std::string_view(names).substr(symbol.nameOffset,
+                                            symbol.nameLength);
+    }
+
+    // Adds an ESR or ESD record to symbols, keeping its name in names.
+    void addSymbol(std::vector<MerlSymbol> &symbols, uint32_t address,
+                   std::string_view name);
+
+    // Empties the module, keeping the allocated storage for reuse.
+    void clear();
+};
+
+// True if bytes start with the cookie of either MERL format.
+bool hasMerlCookie(std::string_view bytes);
+
+/* Reads a MERL file of either format held in bytes into module, returning
+ * its format. Throws MerlFailure if it is not a well-formed MERL file: the
+ * cookie and both lengths in the header must be right, every record must
+ * fit in the file, every address a REL or ESR record patches must be that
+ * of a code word, and every name index must be in the string table.
+ */
+MerlFormat readMerl(std::string_view bytes, MerlModule &module);
+
+/* Maps the file at path and reads it as with readMerl. Errors name the
+ * file.
+ */
+MerlFormat loadMerl(const std::string &path, MerlModule &module);
+
+/* Appends a v2 string table holding names, in order, to out. Names must
+ * not hold a NUL, which ends each name in the table.
+ */
+void merlStrings(const std::vector<std::string_view> &names,
+                 std::vector<uint32_t> &out);
+
+/* Appends a packed REL record of the given addresses, which it sorts, to
+ * out. Every address must be that of a code word.
+ */
+void merlPackedRelocations(std::vector<uint32_t> addresses,
+                           std::vector<uint32_t> &out);
+
+/* Appends the records of module to out, REL first, then ESR, then ESD; in
+ * v2 the string table comes before them all. MERL_V2_PACKED writes the REL
+ * records as one packed record, in address order.
+ */
+void merlRecords(const MerlModule &module, std::vector<uint32_t> &out,
+                 MerlFormat format = MERL_V1);
+
+// The header of a MERL file with the given code and record sections.
+std::array<uint32_t, 3> merlHeader(size_t codeWords, size_t recordWords,
+                                   MerlFormat format = MERL_V1);
+
+/* Writes module to the file at path as a big-endian MERL file. Returns
+ * false (with errno set) on failure.
+ */
+bool writeMerlFile(const char *path, const MerlModule &module,
+                   MerlFormat format = MERL_V1);
+
+/* An exception class thrown when a MERL file is malformed, or when modules
+ * cannot be linked.
+ */
+class MerlFailure {
+    std::string message;
+
+  public:
+    MerlFailure(std::string message);
+
+    // Returns the message associated with the exception.
+    const std::string &what() const;
+};
+
+#endif
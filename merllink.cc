@@ -0,0 +1,103 @@
+#include "linker.h"
+#include "loader.h"
+#include "merl.h"
+#include "wordio.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * merllink: links MERL modules, such as binasm writes, into one.
+ *
+ * The linked module is written as a MERL file, or with --bin as a flat
+ * binary to be loaded at address 0. A flat binary has nowhere to keep
+ * imports, so every import must be exported by one of the modules.
+ */
+
+static int usage() {
+  std::cerr << "Usage: merllink [-j N] [--bin] [--merl-v2|--merl-packed] "
+               "output module..."
+            << std::endl;
+  return 1;
+}
+
+int main(int argc, char *argv[]) {
+  // Command line: merllink [options] output module...
+  //   -j N, --threads=N threads to work on (default: one per core)
+  //   --bin             write a flat binary loaded at address 0
+  //   --merl-v2         write the MERL v2 format (see merl.h)
+  //   --merl-packed     the same, with the REL records packed into one
+  unsigned threads = 0;
+  bool flat = false;
+  MerlFormat format = MERL_V1;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "-j" || arg.substr(0, 10) == "--threads=") {
+      std::string_view count =
+          arg == "-j" ? (i + 1 < argc ? argv[++i] : "") : arg.substr(10);
+      char *end = nullptr;
+      std::string digits(count);
+      unsigned long n = std::strtoul(digits.c_str(), &end, 10);
+      if (digits.empty() || *end != '\0' || n > 1024) {
+        std::cerr << "ERROR: Invalid thread count: " << count << std::endl;
+        return 1;
+      }
+      threads = static_cast<unsigned>(n);
+    } else if (arg == "--bin") {
+      flat = true;
+    } else if (arg == "--merl-v2") {
+      format = MERL_V2;
+    } else if (arg == "--merl-packed") {
+      format = MERL_V2_PACKED;
+    } else if (!arg.empty() && arg[0] == '-') {
+      std::cerr << "ERROR: Unknown option: " << arg << std::endl;
+      return usage();
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.size() < 2) {
+    return usage();
+  }
+  const std::string output = paths.front();
+  paths.erase(paths.begin());
+
+  auto start = std::chrono::steady_clock::now();
+  MerlModule linked;
+  try {
+    linkMerlFiles(paths, threads, linked);
+  } catch (MerlFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+  bool written;
+  if (flat) {
+    try {
+      loadModule(linked, 0);
+    } catch (MerlFailure &f) {
+      std::cerr << f.what() << std::endl;
+      return 1;
+    }
+    written = writeBigEndianFile(output.c_str(), {linked.code});
+  } else {
+    written = writeMerlFile(output.c_str(), linked, format);
+  }
+  if (!written) {
+    std::cerr << "ERROR: Cannot write output file: " << output << ": "
+              << std::strerror(errno) << std::endl;
+    return 1;
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::cout << "Linked " << paths.size() << " modules (" << linked.code.size()
+            << " words, " << linked.relocations.size() << " relocations, "
+            << linked.imports.size() << " unresolved imports) in "
+            << std::fixed << std::setprecision(3) << elapsed.count() << " s"
+            << std::endl;
+  return 0;
+}
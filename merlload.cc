@@ -0,0 +1,71 @@
+#include "loader.h"
+#include "merl.h"
+#include "wordio.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/*
+ * merlload: loads a MERL module at an address and writes the loaded image,
+ * the module's code with every REL record applied, as a flat big-endian
+ * binary. The module must have no imports left; link it with merllink
+ * first.
+ */
+
+int main(int argc, char *argv[]) {
+  // Command line: merlload [-a address] output module
+  //   -a address  where the first code word is loaded (default 0); decimal,
+  //               or hexadecimal with a 0x prefix
+  uint32_t load_address = 0;
+  const char *output = nullptr;
+  const char *input = nullptr;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "-a") {
+      std::string digits = i + 1 < argc ? argv[++i] : "";
+      char *end = nullptr;
+      unsigned long long address = std::strtoull(digits.c_str(), &end, 0);
+      if (digits.empty() || *end != '\0' || address > UINT32_MAX) {
+        std::cerr << "ERROR: Invalid load address: " << digits << std::endl;
+        return 1;
+      }
+      load_address = static_cast<uint32_t>(address);
+    } else if (!output) {
+      output = argv[i];
+    } else if (!input) {
+      input = argv[i];
+    } else {
+      std::cerr << "ERROR: Unexpected argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (!input) {
+    std::cerr << "Usage: merlload [-a address] output module" << std::endl;
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  MerlModule module;
+  try {
+    loadMerl(input, module);
+    loadModule(module, load_address);
+  } catch (MerlFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+  if (!writeBigEndianFile(output, {module.code})) {
+    std::cerr << "ERROR: Cannot write output file: " << output << ": "
+              << std::strerror(errno) << std::endl;
+    return 1;
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::cout << "Loaded " << module.code.size() << " words at 0x" << std::hex
+            << load_address << std::dec << " (" << module.relocations.size()
+            << " relocations) in " << std::fixed << std::setprecision(3)
+            << elapsed.count() << " s" << std::endl;
+  return 0;
+}
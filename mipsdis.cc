@@ -0,0 +1,207 @@
+#include "assembler.h"
+#include "disassembler.h"
+#include "merl.h"
+#include "sourcefile.h"
+#include "wordio.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+ * mipsdis: disassembles a binary or the code of a MERL module back into
+ * assembly source.
+ *
+ * The input is a MERL module if it starts with a MERL cookie and reads as
+ * one, and otherwise a binary loaded at address 0. The source goes to the
+ * output file, or to standard output.
+ *
+ * With --check nothing is written: the source is assembled again in memory
+ * and the result compared with the input, byte for byte, which checks both
+ * the file and the tools that made it.
+ */
+
+// Assembles source and compares its output file with original, which holds
+// code_words words of code, after a header if it is a MERL module. Returns
+// false, after reporting the first difference, if they are not the same.
+bool round_trip(const std::string &source, std::string_view original,
+                bool merl, MerlFormat format, size_t code_words,
+                unsigned threads) {
+  Assembler assembler;
+  Assembler::AsmReturn result;
+  Assembler::AsmOptions options;
+  options.threads = threads;
+  options.merl_format = format;
+  if (!assembler.assemble(source, options, result)) {
+    std::cerr << "ERROR: Disassembly does not assemble: "
+              << result.error_message << std::endl;
+    return false;
+  }
+  std::vector<uint32_t> image(imageWords(result));
+  copyImage(result, image.data());
+  const size_t bytes = image.size() * 4;
+  const size_t common = std::min(bytes, original.size());
+  const char *words = reinterpret_cast<const char *>(image.data());
+  size_t offset = 0;
+  while (offset < common && words[offset] == original[offset]) {
+    offset++;
+  }
+  if (offset == common && bytes == original.size()) {
+    return true;
+  }
+  offset -= offset % 4;
+  if (offset == common) {
+    std::fprintf(stderr,
+                 "ERROR: Reassembled file has %zu bytes, not %zu\n", bytes,
+                 original.size());
+    return false;
+  }
+  uint32_t was = 0, now = 0;
+  std::memcpy(&was, original.data() + offset, 4);
+  std::memcpy(&now, words + offset, 4);
+  swapWords(&was, &was, 1);
+  swapWords(&now, &now, 1);
+  // Linked modules, for one, keep their REL records in another order.
+  const char *where = "";
+  if (merl) {
+    where = offset < MERL_CODE_START                  ? " (header)"
+            : offset < MERL_CODE_START + 4 * code_words ? " (code)"
+                                                        : " (records)";
+  }
+  std::fprintf(stderr,
+               "ERROR: Reassembled file differs at offset 0x%zx%s: 0x%08x "
+               "became 0x%08x\n",
+               offset, where, was, now);
+  return false;
+}
+
+int main(int argc, char *argv[]) {
+  // Command line: mipsdis [options] input [output]
+  //   -j N, --threads=N threads to work on (default: one per core)
+  //   --bare            leave out the address and word after each line
+  //   --check           reassemble the source and compare it with the input
+  //                     instead of writing it out
+  //   --stats           report how many words were disassembled, and how
+  //                     fast, on standard error
+  unsigned threads = 0;
+  bool bare = false, check = false, stats = false;
+  const char *input = nullptr;
+  const char *output = nullptr;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "-j" || arg.substr(0, 10) == "--threads=") {
+      std::string_view count =
+          arg == "-j" ? (i + 1 < argc ? argv[++i] : "") : arg.substr(10);
+      char *end = nullptr;
+      std::string digits(count);
+      unsigned long n = std::strtoul(digits.c_str(), &end, 10);
+      if (digits.empty() || *end != '\0' || n > 1024) {
+        std::cerr << "ERROR: Invalid thread count: " << count << std::endl;
+        return 1;
+      }
+      threads = static_cast<unsigned>(n);
+    } else if (arg == "--bare") {
+      bare = true;
+    } else if (arg == "--check") {
+      check = true;
+    } else if (arg == "--stats") {
+      stats = true;
+    } else if (!input) {
+      input = argv[i];
+    } else if (!output) {
+      output = argv[i];
+    } else {
+      std::cerr << "ERROR: Unexpected argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (!input || (check && output)) {
+    std::cerr << "Usage: mipsdis [options] input [output]" << std::endl;
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  SourceFile file;
+  try {
+    file.map(input);
+  } catch (SourceFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+  std::string_view bytes = file.text();
+  MerlModule module;
+  MerlFormat format = MERL_V1;
+  bool merl = false;
+  if (hasMerlCookie(bytes)) {
+    // A binary can start with a cookie too: it is a branch.
+    try {
+      format = readMerl(bytes, module);
+      merl = true;
+    } catch (MerlFailure &) {
+    }
+  }
+  if (!merl) {
+    if (bytes.size() % 4 != 0) {
+      std::cerr << "ERROR: Binary is not a whole number of words" << std::endl;
+      return 1;
+    }
+    module.code.resize(bytes.size() / 4);
+    std::memcpy(module.code.data(), bytes.data(), bytes.size());
+    swapWords(module.code.data(), module.code.data(), module.code.size());
+  }
+  Disassembler disassembler(module.code.data(), module.code.size(),
+                            merl ? MERL_CODE_START : 0,
+                            merl ? &module : nullptr, !bare);
+
+  size_t written = 0;
+  bool ok;
+  if (check) {
+    std::string source;
+    disassemble(disassembler, threads, [&](std::string_view text) {
+      source += text;
+      return true;
+    });
+    written = source.size();
+    ok = round_trip(source, bytes, merl, format, module.code.size(),
+                    threads);
+  } else {
+    int fd = output ? open(output, O_WRONLY | O_CREAT | O_TRUNC, 0666) : 1;
+    ok = fd >= 0 && disassemble(disassembler, threads,
+                                [&](std::string_view text) {
+                                  written += text.size();
+                                  return writeBytes(fd, text.data(),
+                                                    text.size());
+                                });
+    if (output && fd >= 0 && close(fd) != 0) {
+      ok = false;
+    }
+    if (!ok) {
+      std::cerr << "ERROR: Cannot write output file: "
+                << (output ? output : "standard output") << ": "
+                << std::strerror(errno) << std::endl;
+    }
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  if (check && ok) {
+    static const char *const kinds[] = {"MERL module", "MERL v2 module",
+                                        "packed MERL v2 module"};
+    const char *kind = merl ? kinds[format] : "binary";
+    std::cout << "Round trip OK: " << module.code.size() << " words of "
+              << kind << " " << input << std::endl;
+  }
+  if (stats) {
+    const double seconds = elapsed.count();
+    std::fprintf(stderr,
+                 "Disassembled %zu words into %zu bytes in %.3f s "
+                 "(%.1f MB/s of code)\n",
+                 module.code.size(), written, seconds,
+                 seconds > 0 ? bytes.size() / seconds / 1e6 : 0.0);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,327 @@
+#include "assembler.h"
+#include "merl.h"
+#include "loader.h"
+#include "simulator.h"
+#include "sourcefile.h"
+#include "wordio.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * mipssim: runs a MIPS program on the simulator.
+ *
+ * The program is assembly source, which is assembled in memory first, or
+ * a binary: a MERL module if it starts with a MERL cookie, and otherwise
+ * bare code words. --source and --binary say which; without them a .asm
+ * or .s file is source and a .bin or .merl file a binary, and any other
+ * file is taken as a binary only if it starts with a MERL cookie or holds
+ * a zero byte. A binary is loaded at address 0. A MERL
+ * module's code is loaded at 0xc, where the assembler placed it, so its
+ * addresses need no relocation; its imports may only be the system
+ * routines (print, init, new, delete, exit).
+ */
+
+// What the program file holds.
+enum ProgramKind { GUESS, SOURCE, BINARY };
+
+// The kind a file name's extension implies, or GUESS.
+ProgramKind kindOf(std::string_view path) {
+  const size_t dot = path.rfind('.');
+  const size_t slash = path.rfind('/');
+  if (dot == std::string_view::npos ||
+      (slash != std::string_view::npos && dot < slash)) {
+    return GUESS;
+  }
+  std::string_view extension = path.substr(dot);
+  if (extension == ".asm" || extension == ".s") {
+    return SOURCE;
+  }
+  if (extension == ".bin" || extension == ".merl") {
+    return BINARY;
+  }
+  return GUESS;
+}
+
+// A labelled address, for the profile.
+struct ProfileLabel {
+  uint32_t address;
+  std::string name;
+};
+
+// Fills in the system routines a module imports. Returns false, after
+// reporting it, if it imports anything else.
+bool resolveSystemImports(MerlModule &module) {
+  for (const MerlSymbol &symbol : module.imports) {
+    const uint32_t address = systemRoutine(std::string(module.name(symbol)));
+    if (!address) {
+      std::cerr << "ERROR: Unresolved import: " << module.name(symbol)
+                << std::endl;
+      return false;
+    }
+    module.code[(symbol.address - MERL_CODE_START) / 4] = address;
+  }
+  module.imports.clear();
+  return true;
+}
+
+/* Prints how many instructions ran under each label: every instruction
+ * counts towards the closest label at or before it.
+ */
+void print_profile(const Simulator &simulator,
+                   std::vector<ProfileLabel> labels) {
+  std::sort(labels.begin(), labels.end(),
+            [](const ProfileLabel &a, const ProfileLabel &b) {
+              return a.address < b.address ||
+                     (a.address == b.address && a.name < b.name);
+            });
+  // Labels at the same address share one line.
+  std::vector<ProfileLabel> regions;
+  for (const ProfileLabel &label : labels) {
+    if (!regions.empty() && regions.back().address == label.address) {
+      regions.back().name += ", " + label.name;
+    } else {
+      regions.push_back(label);
+    }
+  }
+  const uint32_t base = simulator.codeBase();
+  if (regions.empty() || regions.front().address > base) {
+    regions.insert(regions.begin(), {base, "(start)"});
+  }
+  const std::vector<uint64_t> &counts = simulator.instructionCounts();
+  std::vector<std::pair<uint64_t, size_t>> totals;
+  for (size_t k = 0; k < regions.size(); k++) {
+    const size_t first = (regions[k].address - base) / 4;
+    const size_t last = k + 1 < regions.size()
+                            ? (regions[k + 1].address - base) / 4
+                            : counts.size();
+    uint64_t sum = 0;
+    for (size_t i = first; i < std::min(last, counts.size()); i++) {
+      sum += counts[i];
+    }
+    if (sum) {
+      totals.emplace_back(sum, k);
+    }
+  }
+  std::stable_sort(totals.begin(), totals.end(),
+                   [](const std::pair<uint64_t, size_t> &a,
+                      const std::pair<uint64_t, size_t> &b) {
+                     return a.first > b.first;
+                   });
+  const uint64_t steps = simulator.steps();
+  std::fprintf(stderr, "Profile: %llu instructions\n",
+               static_cast<unsigned long long>(steps));
+  std::fprintf(stderr, "%14s %7s  %-10s %s\n", "count", "%", "address",
+               "label");
+  for (const auto &total : totals) {
+    const ProfileLabel &label = regions[total.second];
+    std::fprintf(stderr, "%14llu %6.2f%%  0x%08x %s\n",
+                 static_cast<unsigned long long>(total.first),
+                 steps ? 100.0 * total.first / steps : 0.0, label.address,
+                 label.name.c_str());
+  }
+}
+
+void print_registers(const Simulator &simulator) {
+  for (unsigned r = 1; r < 32; r++) {
+    std::fprintf(stderr, "$%02u = 0x%08x%s", r, simulator.reg(r),
+                 r % 4 == 0 || r == 31 ? "\n" : "   ");
+  }
+}
+
+int main(int argc, char *argv[]) {
+  // Command line: mipssim [options] program
+  //   -r N=VALUE        start with VALUE in register $N (repeatable)
+  //   -j N, --threads=N threads to assemble source with (default: one per
+  //                     core)
+  //   --max-steps=N     stop with an error after N instructions
+  //   --profile         count the instructions run under each label
+  //   --stats           report how many instructions ran, and how fast
+  //   --registers       print the registers when the program ends
+  //   --source          the program is assembly source
+  //   --binary          the program is a binary or a MERL module
+  // Profiles, statistics and registers go to standard error.
+  std::vector<std::pair<unsigned, uint32_t>> initial;
+  Assembler::AsmOptions options;
+  options.threads = 0;
+  uint64_t max_steps = UINT64_MAX;
+  bool profile = false, stats = false, registers = false;
+  ProgramKind kind = GUESS;
+  const char *program = nullptr;
+  for (int i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg == "-r") {
+      std::string setting = i + 1 < argc ? argv[++i] : "";
+      char *end = nullptr;
+      unsigned long r = std::strtoul(setting.c_str(), &end, 10);
+      const bool named = end != setting.c_str() && *end == '=' && r < 32;
+      const char *digits = named ? end + 1 : "";
+      long long value = std::strtoll(digits, &end, 0);
+      if (!named || !*digits || *end != '\0' || value < INT32_MIN ||
+          value > UINT32_MAX) {
+        std::cerr << "ERROR: Invalid register setting: " << setting
+                  << std::endl;
+        return 1;
+      }
+      initial.emplace_back(r, static_cast<uint32_t>(value));
+    } else if (arg == "-j" || arg.substr(0, 10) == "--threads=") {
+      std::string_view count =
+          arg == "-j" ? (i + 1 < argc ? argv[++i] : "") : arg.substr(10);
+      char *end = nullptr;
+      std::string digits(count);
+      unsigned long threads = std::strtoul(digits.c_str(), &end, 10);
+      if (digits.empty() || *end != '\0' || threads > 1024) {
+        std::cerr << "ERROR: Invalid thread count: " << count << std::endl;
+        return 1;
+      }
+      options.threads = static_cast<unsigned>(threads);
+    } else if (arg.substr(0, 12) == "--max-steps=") {
+      std::string digits(arg.substr(12));
+      char *end = nullptr;
+      max_steps = std::strtoull(digits.c_str(), &end, 10);
+      if (digits.empty() || *end != '\0') {
+        std::cerr << "ERROR: Invalid step count: " << digits << std::endl;
+        return 1;
+      }
+    } else if (arg == "--profile") {
+      profile = true;
+    } else if (arg == "--stats") {
+      stats = true;
+    } else if (arg == "--registers") {
+      registers = true;
+    } else if (arg == "--source") {
+      kind = SOURCE;
+    } else if (arg == "--binary") {
+      kind = BINARY;
+    } else if (!program) {
+      program = argv[i];
+    } else {
+      std::cerr << "ERROR: Unexpected argument: " << arg << std::endl;
+      return 1;
+    }
+  }
+  if (!program) {
+    std::cerr << "Usage: mipssim [options] program" << std::endl;
+    return 1;
+  }
+
+  SourceFile file;
+  try {
+    file.map(program);
+  } catch (SourceFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+  std::string_view bytes = file.text();
+  if (kind == GUESS) {
+    kind = kindOf(program);
+  }
+  const bool merl = kind != SOURCE && hasMerlCookie(bytes);
+  // Source is text, so only a binary holds a zero byte.
+  const bool binary =
+      kind == BINARY || merl ||
+      (kind == GUESS && bytes.find('\0') != std::string_view::npos);
+
+  // The code and where it goes, and the labels the profile can name.
+  std::vector<uint32_t> code;
+  uint32_t base = 0;
+  std::vector<ProfileLabel> labels;
+  MerlModule module;
+  bool is_module = merl;
+  try {
+    if (merl) {
+      readMerl(bytes, module);
+    } else if (binary) {
+      if (bytes.size() % 4 != 0) {
+        std::cerr << "ERROR: Binary is not a whole number of words"
+                  << std::endl;
+        return 1;
+      }
+      code.resize(bytes.size() / 4);
+      std::memcpy(code.data(), bytes.data(), bytes.size());
+      swapWords(code.data(), code.data(), code.size());
+    } else {
+      Assembler assembler;
+      Assembler::AsmReturn result;
+      if (!assembler.assemble(bytes, options, result)) {
+        std::cerr << result.error_message << std::endl;
+        return 1;
+      }
+      for (uint32_t id = 0; id < result.symbolTable.size(); id++) {
+        const SymbolInfo &info = result.symbolTable[id];
+        if (info.defined && !info.imported) {
+          labels.push_back(
+              {info.address, std::string(result.symbols.name(id))});
+        }
+      }
+      if (result.merl_module) {
+        is_module = true;
+        // Read back the module the assembler would have written.
+        std::vector<uint32_t> image(imageWords(result));
+        copyImage(result, image.data());
+        readMerl(std::string_view(reinterpret_cast<const char *>(image.data()),
+                                  image.size() * 4),
+                 module);
+      } else {
+        code.swap(result.assembly_binary_code);
+      }
+    }
+    if (is_module) {
+      if (!resolveSystemImports(module)) {
+        return 1;
+      }
+      loadModule(module, MERL_CODE_START);
+      code.swap(module.code);
+      base = MERL_CODE_START;
+      if (labels.empty()) {
+        for (const MerlSymbol &symbol : module.exports) {
+          labels.push_back(
+              {symbol.address, std::string(module.name(symbol))});
+        }
+      }
+    }
+  } catch (MerlFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+
+  Simulator simulator;
+  simulator.load(code, base);
+  for (const auto &setting : initial) {
+    simulator.setReg(setting.first, setting.second);
+  }
+  simulator.setStepLimit(max_steps);
+  auto start = std::chrono::steady_clock::now();
+  int status = 0;
+  try {
+    simulator.run(profile);
+  } catch (SimulationFailure &f) {
+    std::cerr << f.what() << std::endl;
+    status = 1;
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  if (registers) {
+    print_registers(simulator);
+  }
+  if (profile) {
+    print_profile(simulator, std::move(labels));
+  }
+  if (stats) {
+    const double seconds = elapsed.count();
+    std::fprintf(stderr,
+                 "Ran %llu instructions in %.3f s (%.1f million/sec), "
+                 "%zu pages of memory\n",
+                 static_cast<unsigned long long>(simulator.steps()), seconds,
+                 seconds > 0 ? simulator.steps() / seconds / 1e6 : 0.0,
+                 simulator.memoryPages());
+  }
+  return status;
+}
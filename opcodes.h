@@ -0,0 +1,117 @@
+#ifndef CS241_OPCODES_H
+#define CS241_OPCODES_H
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/*
+ * The instruction set understood by the assembler, described as data.
+ *
+ * Every mnemonic has one row in kOpcodes giving its encoding format, the
+ * fixed bits of its encoding and how its operands are laid out. The
+ * assembler validates and encodes every instruction from this table, so
+ * adding an instruction only takes a new row here (plus, if it introduces
+ * a new operand layout, a shape for that layout in assembler.cc).
+ */
+
+// R-type: opcode 0, registers s, t, d and a function code.
+// I-type: an opcode, registers s, t and a 16-bit immediate.
+enum InstrFormat { R_TYPE, I_TYPE };
+
+/* How the operands written after a mnemonic map onto its encoding fields.
+ */
+enum OperandLayout {
+  REG_D,     // mfhi $d
+  REG_S,     // jr $s
+  REG_S_T,   // mult $s, $t
+  REG_D_S_T, // add $d, $s, $t
+  MEMORY,    // lw $t, i($s)
+  BRANCH     // beq $s, $t, i
+};
+
+struct OpcodeDescriptor {
+  std::string_view mnemonic;
+  InstrFormat format;
+  uint32_t opcode; // bits 31-26
+  uint32_t funct;  // bits 5-0, R-type only
+  OperandLayout layout;
+};
+
+inline constexpr OpcodeDescriptor kOpcodes[] = {
+    {"add", R_TYPE, 0, 32, REG_D_S_T},  {"sub", R_TYPE, 0, 34, REG_D_S_T},
+    {"slt", R_TYPE, 0, 42, REG_D_S_T},  {"sltu", R_TYPE, 0, 43, REG_D_S_T},
+    {"mult", R_TYPE, 0, 24, REG_S_T},   {"multu", R_TYPE, 0, 25, REG_S_T},
+    {"div", R_TYPE, 0, 26, REG_S_T},    {"divu", R_TYPE, 0, 27, REG_S_T},
+    {"mfhi", R_TYPE, 0, 16, REG_D},     {"mflo", R_TYPE, 0, 18, REG_D},
+    {"lis", R_TYPE, 0, 20, REG_D},      {"jr", R_TYPE, 0, 8, REG_S},
+    {"jalr", R_TYPE, 0, 9, REG_S},      {"lw", I_TYPE, 35, 0, MEMORY},
+    {"sw", I_TYPE, 43, 0, MEMORY},      {"beq", I_TYPE, 4, 0, BRANCH},
+    {"bne", I_TYPE, 5, 0, BRANCH},
+};
+
+inline constexpr size_t kOpcodeCount = sizeof(kOpcodes) / sizeof(kOpcodes[0]);
+
+/* A perfect hash over the mnemonics in kOpcodes: every mnemonic lands in
+ * its own slot of a 32-entry table. Only called on identifiers of at least
+ * two characters. If a new row collides, the static_assert below fails
+ * and the constants need to be searched again.
+ */
+constexpr uint32_t mnemonicHash(std::string_view mnemonic) {
+  return (static_cast<unsigned char>(mnemonic[0]) +
+          static_cast<unsigned char>(mnemonic[1]) +
+          26u * static_cast<unsigned char>(mnemonic.back()) +
+          static_cast<uint32_t>(mnemonic.size())) & 31u;
+}
+
+struct OpcodeSlots {
+  int8_t slot[32];
+  bool collisionFree;
+};
+
+constexpr OpcodeSlots buildOpcodeSlots() {
+  OpcodeSlots slots{};
+  slots.collisionFree = true;
+  for (int8_t &s : slots.slot) {
+    s = -1;
+  }
+  for (size_t i = 0; i < kOpcodeCount; ++i) {
+    int8_t &s = slots.slot[mnemonicHash(kOpcodes[i].mnemonic)];
+    if (s != -1) {
+      slots.collisionFree = false;
+    }
+    s = static_cast<int8_t>(i);
+  }
+  return slots;
+}
+
+inline constexpr OpcodeSlots kOpcodeSlots = buildOpcodeSlots();
+static_assert(kOpcodeSlots.collisionFree,
+              "mnemonicHash is no longer perfect over kOpcodes");
+
+/* Returns the descriptor for a mnemonic, or nullptr if it is not one.
+ */
+inline const OpcodeDescriptor *findOpcode(std::string_view mnemonic) {
+  if (mnemonic.size() < 2) {
+    return nullptr;
+  }
+  int8_t s = kOpcodeSlots.slot[mnemonicHash(mnemonic)];
+  if (s < 0 || kOpcodes[s].mnemonic != mnemonic) {
+    return nullptr;
+  }
+  return &kOpcodes[s];
+}
+
+/* Generic encoders, one per format. Fields are not range checked; the
+ * immediate of an I-type instruction is truncated to 16 bits.
+ */
+constexpr uint32_t encodeR(uint32_t s, uint32_t t, uint32_t d,
+                           uint32_t funct) {
+  return (s << 21) | (t << 16) | (d << 11) | funct;
+}
+
+constexpr uint32_t encodeI(uint32_t opcode, uint32_t s, uint32_t t,
+                           uint32_t i) {
+  return (opcode << 26) | (s << 21) | (t << 16) | (i & 0xffff);
+}
+
+#endif
@@ -1,16 +1,13 @@
-#include <sstream>
-#include <iomanip>
-#include <cctype>
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include <utility>
-#include <set>
-#include <array>
 #include "scanner.h"
 
 /*
  * C++ Starter code for CS241 A3
- * All code requires C++14, so if you're getting compile errors make sure to
- * use -std=c++14.
+ * All code requires C++17, so if you're getting compile errors make sure to
+ * use -std=c++17.
  *
  * This file contains helpers for asm.cc and you don't need to modify it.
  * Read the scanner.h file for a description of the helper functions.
@@ -20,11 +17,55 @@
  * to write the assembler.
  */
 
-Token::Token(Token::Kind kind, std::string lexeme):
-  kind(kind), lexeme(std::move(lexeme)) {}
+/* Parses the digits of a decimal or hexadecimal literal, saturating to the
+ * int64_t range as described for toNumber in scanner.h.
+ */
+static int64_t parseDigits(std::string_view digits, uint64_t base,
+                           bool negative) {
+  const uint64_t limit = negative
+      ? static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1
+      : static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  uint64_t magnitude = 0;
+
+  for (char c : digits) {
+    uint64_t digit = c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+    if (magnitude > (limit - digit) / base) {
+      return negative ? std::numeric_limits<int64_t>::min()
+                      : std::numeric_limits<int64_t>::max();
+    }
+    magnitude = magnitude * base + digit;
+  }
+
+  if (negative && magnitude != 0) {
+    return -static_cast<int64_t>(magnitude - 1) - 1;
+  }
+  return static_cast<int64_t>(magnitude);
+}
+
+/* Computes the value returned by toNumber for a lexeme of the given kind.
+ * The scanner only produces INT, HEXINT and REG lexemes that are
+ * well-formed, so no further validation is needed here.
+ */
+static int64_t parseValue(Token::Kind kind, std::string_view lexeme) {
+  switch (kind) {
+    case Token::INT:
+      if (!lexeme.empty() && lexeme[0] == '-') {
+        return parseDigits(lexeme.substr(1), 10, true);
+      }
+      return parseDigits(lexeme, 10, false);
+    case Token::HEXINT: return parseDigits(lexeme.substr(2), 16, false);
+    case Token::REG:    return parseDigits(lexeme.substr(1), 10, false);
+    default:            return 0;
+  }
+}
+
+Token::Token(Token::Kind kind, std::string_view lexeme, uint32_t symbol):
+  kind(kind), symbol(symbol), lexeme(lexeme),
+  value(parseValue(kind, lexeme)) {}
 
   Token:: Kind Token::getKind() const { return kind; }
-const std::string &Token::getLexeme() const { return lexeme; }
+std::string_view Token::getLexeme() const { return lexeme; }
+uint32_t Token::getSymbol() const { return symbol; }
 
 std::ostream &operator<<(std::ostream &out, const Token &tok) {
   out << "Token(";
@@ -48,25 +89,7 @@ std::ostream &operator<<(std::ostream &out, const Token &tok) {
   return out;
 }
 
-int64_t Token::toNumber() const {
-  std::istringstream iss;
-  int64_t result;
-
-  if (kind == INT) {
-    iss.str(lexeme);
-  } else if (kind == HEXINT) {
-    iss.str(lexeme.substr(2));
-    iss >> std::hex;
-  } else if (kind == REG) {
-    iss.str(lexeme.substr(1));
-  } else {
-    // This should never happen if the user calls this function correctly
-    return 0;
-  }
-
-  iss >> result;
-  return result;
-}
+int64_t Token::toNumber() const { return value; }
 
 ScanningFailure::ScanningFailure(std::string message):
   message(std::move(message)) {}
@@ -108,17 +131,61 @@ class AsmDFA {
     };
 
   private:
-    /* A set of all accepting states for the DFA.
-     * Currently non-accepting states are not actually present anywhere
-     * in memory, but a list can be found in the constructor.
+    /* The accepting states of the DFA, one bit per state.
+     * Non-accepting states are DOT, MINUS, ZEROX, DOLLARS, START and FAIL.
      */
-    std::set<State> acceptingStates;
+    static constexpr uint32_t acceptingStates =
+        (1u << ID) | (1u << LABEL) | (1u << DOTID) | (1u << HEXINT) |
+        (1u << INT) | (1u << ZERO) | (1u << COMMA) | (1u << REG) |
+        (1u << LPAREN) | (1u << RPAREN) | (1u << WHITESPACE) | (1u << COMMENT);
 
     /*
-     * The transition function for the DFA, stored as a map.
+     * The transition function for the DFA, stored as a flat table indexed by
+     * state and input byte. Bytes outside of ASCII always fail.
      */
+    struct TransitionTable {
+      State next[LARGEST_STATE + 1][256];
+    };
 
-    std::array<std::array<State, 128>, LARGEST_STATE + 1> transitionFunction;
+    /*
+     * Built by buildTransitionFunction() during compilation, so scanning
+     * does not need to construct anything at startup.
+     */
+    static const TransitionTable transitionFunction;
+
+    static constexpr TransitionTable buildTransitionFunction();
+
+    // Register a transition on all chars in chars
+    static constexpr void registerTransition(TransitionTable &table,
+        State oldState, const char *chars, State newState) {
+      for (; *chars; ++chars) {
+        table.next[oldState][static_cast<unsigned char>(*chars)] = newState;
+      }
+    }
+
+    // Register a transition on all chars matching test
+    static constexpr void registerTransition(TransitionTable &table,
+        State oldState, bool (*test)(int), State newState) {
+      for (int c = 0; c < 128; ++c) {
+        if (test(c)) {
+          table.next[oldState][c] = newState;
+        }
+      }
+    }
+
+    // Constant-expression versions of the <cctype> tests in the "C" locale.
+    static constexpr bool isDigit(int c) { return c >= '0' && c <= '9'; }
+    static constexpr bool isAlpha(int c) {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+    static constexpr bool isAlnum(int c) { return isAlpha(c) || isDigit(c); }
+    static constexpr bool isXDigit(int c) {
+      return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+    }
+    static constexpr bool isSpace(int c) {
+      return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+    static constexpr bool notNewline(int c) { return c != '\n'; }
 
     /*
      * Converts a state to a kind to allow construction of Tokens from States.
@@ -145,109 +212,44 @@ class AsmDFA {
 
   public:
     /* Tokenizes an input string according to the Simplified Maximal Munch
-     * scanning algorithm.
+     * scanning algorithm, appending the tokens to result. Lexemes are views
+     * into input, so nothing is copied per token.
      */
-    std::vector<Token> simplifiedMaximalMunch(const std::string &input) const {
-      std::vector<Token> result;
-
+    void simplifiedMaximalMunch(std::string_view input,
+                                std::vector<Token> &result) const {
       State state = start();
-      std::string munchedInput;
+      size_t munchStart = 0;
 
-      // We can't use a range-based for loop effectively here
-      // since the iterator doesn't always increment.
-      for (std::string::const_iterator inputPosn = input.begin();
-           inputPosn != input.end();) {
+      // The position doesn't always increment, since a failed transition
+      // ends the current token and is retried from the start state.
+      for (size_t inputPosn = 0; inputPosn != input.size();) {
 
         State oldState = state;
-        state = transition(state, *inputPosn);
+        state = transition(state, input[inputPosn]);
 
         if (!failed(state)) {
-          munchedInput += *inputPosn;
           oldState = state;
 
           ++inputPosn;
         }
 
-        if (inputPosn == input.end() || failed(state)) {
+        if (inputPosn == input.size() || failed(state)) {
           if (accept(oldState)) {
-            result.push_back(Token(stateToKind(oldState), munchedInput));
+            result.push_back(Token(stateToKind(oldState),
+                input.substr(munchStart, inputPosn - munchStart)));
 
-            munchedInput = "";
+            munchStart = inputPosn;
             state = start();
           } else {
+            size_t munchedLength = inputPosn - munchStart;
             if (failed(state)) {
-              munchedInput += *inputPosn;
+              ++munchedLength;
             }
             throw ScanningFailure("ERROR: Simplified maximal munch failed on input: "
-                                 + munchedInput);
+                                 + std::string(input.substr(munchStart, munchedLength)));
           }
         }
       }
-
-      return result;
-    }
-
-    /* Initializes the accepting states for the DFA.
-     */
-    AsmDFA() {
-      acceptingStates = {ID, LABEL, DOTID, HEXINT,
-                           INT, ZERO, COMMA, REG,
-                           LPAREN, RPAREN, WHITESPACE, COMMENT};
-      //Non-accepting states are DOT, MINUS, ZEROX, DOLLARS, START
-
-      // Initialize transitions for the DFA
-      for (size_t i = 0; i < transitionFunction.size(); ++i) {
-        for (size_t j = 0; j < transitionFunction[0].size(); ++j) {
-          transitionFunction[i][j] = FAIL;
-        }
-      }
-
-      registerTransition(START, isalpha, ID);
-      registerTransition(START, ".", DOT);
-      registerTransition(START, "0", ZERO);
-      registerTransition(START, "123456789", INT);
-      registerTransition(START, "-", MINUS);
-      registerTransition(START, ";", COMMENT);
-      registerTransition(START, isspace, WHITESPACE);
-      registerTransition(START, "$", DOLLARS);
-      registerTransition(START, ",", COMMA);
-      registerTransition(START, "(", LPAREN);
-      registerTransition(START, ")", RPAREN);
-      registerTransition(ID, isalnum, ID);
-      registerTransition(ID, ":", LABEL);
-      registerTransition(DOT, isalpha, DOTID);
-      registerTransition(DOTID, isalpha, DOTID);
-      registerTransition(ZERO, "x", ZEROX);
-      registerTransition(ZERO, isdigit, INT);
-      registerTransition(ZEROX, isxdigit, HEXINT);
-      registerTransition(HEXINT, isxdigit, HEXINT);
-      registerTransition(MINUS, isdigit, INT);
-      registerTransition(INT, isdigit, INT);
-      registerTransition(COMMENT, [](int c) -> int { return c != '\n'; },
-          COMMENT);
-      registerTransition(WHITESPACE, isspace, WHITESPACE);
-      registerTransition(DOLLARS, isdigit, REG);
-      registerTransition(REG, isdigit, REG);
-    }
-
-    // Register a transition on all chars in chars
-    void registerTransition(State oldState, const std::string &chars,
-        State newState) {
-      for (char c : chars) {
-        transitionFunction[oldState][c] = newState;
-      }
-    }
-
-    // Register a transition on all chars matching test
-    // For some reason the cctype functions all use ints, hence the function
-    // argument type.
-    void registerTransition(State oldState, int (*test)(int), State newState) {
-
-      for (int c = 0; c < 128; ++c) {
-        if (test(c)) {
-          transitionFunction[oldState][c] = newState;
-        }
-      }
     }
 
     /* Returns the state corresponding to following a transition
@@ -255,7 +257,7 @@ class AsmDFA {
      * or a special fail state if the transition does not exist.
      */
     State transition(State state, char nextChar) const {
-      return transitionFunction[state][nextChar];
+      return transitionFunction.next[state][static_cast<unsigned char>(nextChar)];
     }
 
     /* Checks whether the state returned by transition
@@ -267,7 +269,7 @@ class AsmDFA {
      * is an accepting state.
      */
     bool accept(State state) const {
-      return acceptingStates.count(state) > 0;
+      return (acceptingStates >> state) & 1u;
     }
 
     /* Returns the starting state of the DFA
@@ -275,33 +277,147 @@ class AsmDFA {
     State start() const { return START; }
 };
 
-std::vector<Token> scan(const std::string &input) {
-  static AsmDFA theDFA;
+constexpr AsmDFA::TransitionTable AsmDFA::buildTransitionFunction() {
+  TransitionTable table{};
+  for (size_t i = 0; i <= LARGEST_STATE; ++i) {
+    for (size_t j = 0; j < 256; ++j) {
+      table.next[i][j] = FAIL;
+    }
+  }
+
+  registerTransition(table, START, isAlpha, ID);
+  registerTransition(table, START, ".", DOT);
+  registerTransition(table, START, "0", ZERO);
+  registerTransition(table, START, "123456789", INT);
+  registerTransition(table, START, "-", MINUS);
+  registerTransition(table, START, ";", COMMENT);
+  registerTransition(table, START, isSpace, WHITESPACE);
+  registerTransition(table, START, "$", DOLLARS);
+  registerTransition(table, START, ",", COMMA);
+  registerTransition(table, START, "(", LPAREN);
+  registerTransition(table, START, ")", RPAREN);
+  registerTransition(table, ID, isAlnum, ID);
+  registerTransition(table, ID, ":", LABEL);
+  registerTransition(table, DOT, isAlpha, DOTID);
+  registerTransition(table, DOTID, isAlpha, DOTID);
+  registerTransition(table, ZERO, "x", ZEROX);
+  registerTransition(table, ZERO, isDigit, INT);
+  registerTransition(table, ZEROX, isXDigit, HEXINT);
+  registerTransition(table, HEXINT, isXDigit, HEXINT);
+  registerTransition(table, MINUS, isDigit, INT);
+  registerTransition(table, INT, isDigit, INT);
+  registerTransition(table, COMMENT, notNewline, COMMENT);
+  registerTransition(table, WHITESPACE, isSpace, WHITESPACE);
+  registerTransition(table, DOLLARS, isDigit, REG);
+  registerTransition(table, REG, isDigit, REG);
+  return table;
+}
+
+constexpr AsmDFA::TransitionTable AsmDFA::transitionFunction =
+    AsmDFA::buildTransitionFunction();
 
-  std::vector<Token> tokens = theDFA.simplifiedMaximalMunch(input);
+// Total number of bytes fed through the DFA by scan(), for instrumentation.
+// Each thread counts its own lines and adds them to the total in one go, so
+// threads scanning in parallel do not contend for it line by line.
+static std::atomic<uint64_t> scannedBytes{0};
+static thread_local uint64_t unpublishedBytes = 0;
+
+void publishScannedBytes() {
+  if (unpublishedBytes != 0) {
+    scannedBytes.fetch_add(unpublishedBytes, std::memory_order_relaxed);
+    unpublishedBytes = 0;
+  }
+}
+
+uint64_t scannedByteCount() {
+  publishScannedBytes();
+  return scannedBytes.load(std::memory_order_relaxed);
+}
+
+/*
+ * Scans input into the thread's scratch vector and filters it: WORD tokens
+ * become .word, .import or .export (or fail), names are interned, and
+ * WHITESPACE and COMMENT tokens are removed. Returns the scratch vector,
+ * whose first kept entries are the line's tokens.
+ */
+static std::vector<Token> &scanTokens(std::string_view input,
+                                      SymbolTable *symbols, size_t &kept) {
+  static const AsmDFA theDFA;
+  // Reused between calls so that munching a line does not grow a fresh
+  // vector token by token.
+  static thread_local std::vector<Token> tokens;
+
+  tokens.clear();
+  unpublishedBytes += input.size();
+  theDFA.simplifiedMaximalMunch(input, tokens);
 
   // We need to:
   // * Throw exceptions for WORD tokens whose lexemes aren't recognized (.word/.import/.export).
   // * Remove WHITESPACE and COMMENT tokens entirely.
 
-  std::vector<Token> newTokens;
+  kept = 0;
 
-  for (auto &token : tokens) {
+  for (const Token &token : tokens) {
     if (token.getKind() == Token::WORD) {
-      const std::string &lex = token.getLexeme();
+      std::string_view lex = token.getLexeme();
       if (lex == ".word") {
-        newTokens.push_back(token);
+        tokens[kept++] = token;
       } else if (lex == ".import") {
-        newTokens.push_back(Token(Token::IMPORT, lex));
+        tokens[kept++] = Token(Token::IMPORT, lex);
       } else if (lex == ".export") {
-        newTokens.push_back(Token(Token::EXPORT, lex));
+        tokens[kept++] = Token(Token::EXPORT, lex);
       } else {
-        throw ScanningFailure("ERROR: DOTID token unrecognized: " + token.getLexeme());
+        throw ScanningFailure("ERROR: DOTID token unrecognized: " + std::string(lex));
       }
+    } else if (symbols && token.getKind() == Token::ID) {
+      tokens[kept++] = Token(Token::ID, token.getLexeme(),
+                             symbols->intern(token.getLexeme()));
+    } else if (symbols && token.getKind() == Token::LABEL) {
+      std::string_view lex = token.getLexeme();
+      tokens[kept++] = Token(Token::LABEL, lex,
+                             symbols->intern(lex.substr(0, lex.size() - 1)));
     } else if (token.getKind() != Token::WHITESPACE && token.getKind() != Token::Kind::COMMENT) {
-      newTokens.push_back(token);
+      tokens[kept++] = token;
     }
   }
+  return tokens;
+}
+
+std::vector<Token> scan(std::string_view input, SymbolTable *symbols) {
+  size_t kept;
+  std::vector<Token> &tokens = scanTokens(input, symbols, kept);
+  // Only the final result is allocated.
+  return std::vector<Token>(tokens.begin(), tokens.begin() + kept);
+}
+
+void scan(std::string_view input, TokenArena &arena, SymbolTable *symbols) {
+  size_t kept;
+  std::vector<Token> &tokens = scanTokens(input, symbols, kept);
+  for (size_t i = 0; i < kept; i++) {
+    arena.push(tokens[i]);
+  }
+  arena.endLine();
+}
+
+void TokenArena::push(const Token &token) {
+  const Token::Kind kind = token.getKind();
+  kinds.push_back(static_cast<uint8_t>(kind));
+  values.push_back(kind == Token::ID || kind == Token::LABEL
+                       ? int64_t(token.getSymbol())
+                       : token.toNumber());
+  lexemes.push_back(token.getLexeme());
+}
+
+void TokenArena::popLine() {
+  starts.pop_back();
+  kinds.resize(starts.back());
+  values.resize(starts.back());
+  lexemes.resize(starts.back());
+}
 
-  return newTokens;
+void TokenArena::clear() {
+  kinds.clear();
+  values.clear();
+  lexemes.clear();
+  starts.resize(1);
 }
@@ -1,15 +1,17 @@
 #ifndef CS241_SCANNER_H
 #define CS241_SCANNER_H
 #include <string>
+#include <string_view>
 #include <vector>
 #include <set>
 #include <cstdint>
 #include <ostream>
+#include "symbols.h"
 
 /*
  * C++ Starter code for CS241 A3
- * All code requires C++14, so if you're getting compile errors make sure to
- * use -std=c++14.
+ * All code requires C++17, so if you're getting compile errors make sure to
+ * use -std=c++17.
  *
  * This file contains helpers for asm.cc and should not need to be modified by
  * you. However, its comments contain important information and you should
@@ -30,15 +32,45 @@ class Token;
  * INT: a signed or unsigned 32-bit integer written in decimal.
  * HEXINT: an unsigned 32-bit integer written in hexadecimal.
  * REG: a register between $0 and $31.
+ *
+ * The lexemes of the returned tokens point into input rather than owning a
+ * copy, so input must outlive the tokens.
+ *
+ * If symbols is given, the name of every ID and LABEL token (without the
+ * colon of a label) is interned in it, and the token carries its id.
  */
 
-std::vector<Token> scan(const std::string &input);
+std::vector<Token> scan(std::string_view input, SymbolTable *symbols = nullptr);
+
+class TokenArena;
+
+/* Scans a single line like the above and appends its tokens to tokens as
+ * one more line, so that scanning a whole program does not allocate per
+ * line. If the line cannot be scanned, throws ScanningFailure without
+ * adding anything.
+ */
+void scan(std::string_view input, TokenArena &tokens,
+          SymbolTable *symbols = nullptr);
+
+/* Returns the total number of input bytes scan() has run through the DFA
+ * in this process. Used to check that no part of a source is scanned twice.
+ * Bytes scanned on other threads are only included once those threads have
+ * called publishScannedBytes().
+ */
+uint64_t scannedByteCount();
+
+// Adds the bytes the calling thread has scanned since it last published to
+// the count scannedByteCount() returns. Worker threads call this once they
+// finish a piece of work.
+void publishScannedBytes();
 
 /* A scanned token produced by the scanner.
  * The "kind" tells us what kind of token it is
  * while the "lexeme" tells us exactly what text
  * the programmer typed. For example, the token
  * "abc" might have kind "ID" and lexeme "abc".
+ * The lexeme is a view into the scanned source
+ * and is only valid while that source is alive.
  *
  * While you can create tokens with any kind and
  * lexeme, the list of kinds produced by the
@@ -65,16 +97,28 @@ class Token {
 
   private:
     Kind kind;
-    std::string lexeme;
+    // The interned id of an ID or LABEL token's name, or SymbolTable::NONE.
+    uint32_t symbol;
+    std::string_view lexeme;
+    // The numeric value of an INT, HEXINT or REG token, parsed once when
+    // the token is created; 0 for every other kind.
+    int64_t value;
 
   public:
-    Token(Kind kind, std::string lexeme);
+    Token(Kind kind, std::string_view lexeme,
+          uint32_t symbol = SymbolTable::NONE);
 
     Kind getKind() const;
-    const std::string &getLexeme() const;
+    std::string_view getLexeme() const;
+    uint32_t getSymbol() const;
+    // Renumbers the token's name, e.g. when moving it from the symbol
+    // table it was scanned with to another one.
+    void setSymbol(uint32_t id) { symbol = id; }
 
     /* Converts a token to the corresponding number.
      * Only works on tokens of type INT, HEXINT, or REG.
+     * The value is computed when the token is constructed, so this is
+     * just a field read.
      */
     int64_t toNumber() const;
     /* Further notes about the toNumber function:
@@ -105,6 +149,77 @@ class Token {
 
 };
 
+/* The tokens of one line of a TokenArena. Indices count from the line's
+ * first token, as they do in the vector scan() returns.
+ */
+class TokenLine {
+    const uint8_t *kinds;
+    const int64_t *values;
+    const std::string_view *lexemes;
+    uint32_t count;
+
+  public:
+    TokenLine(const uint8_t *kinds, const int64_t *values,
+              const std::string_view *lexemes, uint32_t count)
+        : kinds(kinds), values(values), lexemes(lexemes), count(count) {}
+
+    uint32_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    Token::Kind kind(uint32_t i) const {
+      return static_cast<Token::Kind>(kinds[i]);
+    }
+    // The value of an INT, HEXINT or REG token, as Token::toNumber().
+    int64_t number(uint32_t i) const { return values[i]; }
+    // The interned id of an ID or LABEL token, or SymbolTable::NONE.
+    uint32_t symbol(uint32_t i) const {
+      return static_cast<uint32_t>(values[i]);
+    }
+    std::string_view lexeme(uint32_t i) const { return lexemes[i]; }
+};
+
+/* The scanned tokens of a whole program, one line after another, held as
+ * parallel arrays instead of a vector of Tokens per line: the kind of
+ * every token, its value (a number, or the symbol id of a name), its
+ * lexeme, and the index of each line's first token. The passes read the
+ * kinds and values of consecutive lines from a few contiguous arrays, and
+ * a program of any length takes a handful of allocations, which clear()
+ * keeps for the next program.
+ */
+class TokenArena {
+    std::vector<uint8_t> kinds;
+    std::vector<int64_t> values;
+    std::vector<std::string_view> lexemes;
+    // The first token of each line, then the number of tokens.
+    std::vector<size_t> starts = std::vector<size_t>(1, 0);
+
+  public:
+    size_t lines() const { return starts.size() - 1; }
+    size_t tokens() const { return kinds.size(); }
+
+    TokenLine line(size_t n) const {
+      const size_t first = starts[n];
+      return TokenLine(kinds.data() + first, values.data() + first,
+                       lexemes.data() + first,
+                       static_cast<uint32_t>(starts[n + 1] - first));
+    }
+    // The kind and symbol id of token t, counting from the first line.
+    Token::Kind kind(size_t t) const {
+      return static_cast<Token::Kind>(kinds[t]);
+    }
+    uint32_t symbol(size_t t) const { return static_cast<uint32_t>(values[t]); }
+    // Renumbers the name of token t, an ID or LABEL.
+    void setSymbol(size_t t, uint32_t id) { values[t] = id; }
+
+    // Adds a token to the line being added, which endLine() ends.
+    void push(const Token &token);
+    void endLine() { starts.push_back(kinds.size()); }
+    // Removes the last line.
+    void popLine();
+
+    // Forgets every line, keeping the allocated storage for reuse.
+    void clear();
+};
+
 /* Prints a string representation of a token.
  * Mainly useful for debugging.
  */
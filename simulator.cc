@@ -0,0 +1,569 @@
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <iterator>
+#include <unistd.h>
+#include <utility>
+#include "simulator.h"
+#include "wordio.h"
+
+namespace {
+
+enum OpKind : uint8_t {
+  OP_ADD,
+  OP_SUB,
+  OP_SLT,
+  OP_SLTU,
+  OP_MULT,
+  OP_MULTU,
+  OP_DIV,
+  OP_DIVU,
+  OP_MFHI,
+  OP_MFLO,
+  OP_LIS,
+  OP_JR,
+  OP_JALR,
+  OP_LW,
+  OP_SW,
+  OP_BEQ,
+  OP_BNE,
+  OP_BEQ_OUT, // a beq or bne whose target is outside the program
+  OP_BNE_OUT,
+  OP_INVALID, // a word that is not an instruction
+  OP_END,     // past the end of the program
+  OP_KINDS
+};
+
+// Writes to $0 go to this register instead, so $0 always reads as zero.
+const uint8_t kSpare = 32;
+
+// Memory-mapped input and output sit above this address.
+const uint32_t kDeviceStart = 0xffff0000;
+
+// Room left below SIM_STACK_TOP for the stack, where new never allocates.
+const uint32_t kStackSize = 1 << 20;
+
+std::string hex(uint32_t value) {
+  char text[16];
+  std::snprintf(text, sizeof(text), "0x%08x", value);
+  return text;
+}
+
+/* Decodes one word of the program, which is followed by next. Words that
+ * are not instructions the assembler can produce, including ones with
+ * non-zero bits in fields the instruction does not use, become OP_INVALID.
+ * Branch targets are left as offsets; the caller turns them into indices.
+ */
+Simulator::Op decodeWord(uint32_t word, uint32_t next) {
+  const uint32_t opcode = word >> 26;
+  const uint8_t s = (word >> 21) & 31;
+  const uint8_t t = (word >> 16) & 31;
+  const uint8_t d = (word >> 11) & 31;
+  const uint32_t shamt = (word >> 6) & 31;
+  const uint32_t funct = word & 63;
+  const uint32_t imm = static_cast<uint32_t>(static_cast<int16_t>(word));
+  auto dest = [](uint8_t r) { return r ? r : kSpare; };
+  Simulator::Op invalid{OP_INVALID, kSpare, 0, 0, 0};
+
+  switch (opcode) {
+  case 35:
+    return {OP_LW, dest(t), s, t, imm};
+  case 43:
+    return {OP_SW, kSpare, s, t, imm};
+  case 4:
+    return {OP_BEQ, kSpare, s, t, imm};
+  case 5:
+    return {OP_BNE, kSpare, s, t, imm};
+  case 0:
+    break;
+  default:
+    return invalid;
+  }
+  if (shamt != 0) {
+    return invalid;
+  }
+  switch (funct) {
+  case 32:
+    return {OP_ADD, dest(d), s, t, 0};
+  case 34:
+    return {OP_SUB, dest(d), s, t, 0};
+  case 42:
+    return {OP_SLT, dest(d), s, t, 0};
+  case 43:
+    return {OP_SLTU, dest(d), s, t, 0};
+  case 24:
+  case 25:
+  case 26:
+  case 27: {
+    static const uint8_t kinds[] = {OP_MULT, OP_MULTU, OP_DIV, OP_DIVU};
+    return d ? invalid : Simulator::Op{kinds[funct - 24], kSpare, s, t, 0};
+  }
+  case 16:
+  case 18:
+  case 20:
+    if (s || t) {
+      return invalid;
+    }
+    return {static_cast<uint8_t>(funct == 16   ? OP_MFHI
+                                 : funct == 18 ? OP_MFLO
+                                               : OP_LIS),
+            dest(d), 0, 0, funct == 20 ? next : 0};
+  case 8:
+  case 9:
+    if (t || d) {
+      return invalid;
+    }
+    return {static_cast<uint8_t>(funct == 8 ? OP_JR : OP_JALR), kSpare, s, 0,
+            0};
+  default:
+    return invalid;
+  }
+}
+
+bool isSystemRoutine(uint32_t address) {
+  return address == SIM_EXIT || address == SIM_PRINT || address == SIM_INIT ||
+         address == SIM_NEW || address == SIM_DELETE;
+}
+
+} // namespace
+
+uint32_t systemRoutine(const std::string &name) {
+  if (name == "exit")
+    return SIM_EXIT;
+  if (name == "print")
+    return SIM_PRINT;
+  if (name == "init")
+    return SIM_INIT;
+  if (name == "new")
+    return SIM_NEW;
+  if (name == "delete")
+    return SIM_DELETE;
+  return 0;
+}
+
+PagedMemory::PagedMemory() : tables(1u << (32 - kPageBits - kTableBits)) {}
+
+uint32_t *PagedMemory::allocate(uint32_t address) {
+  std::unique_ptr<Page[]> &table = tables[address >> (kPageBits + kTableBits)];
+  if (!table) {
+    table.reset(new Page[1u << kTableBits]);
+  }
+  Page &page = table[(address >> kPageBits) & ((1u << kTableBits) - 1)];
+  page.reset(new uint32_t[kPageWords]());
+  return page.get();
+}
+
+size_t PagedMemory::pages() const {
+  size_t count = 0;
+  for (const std::unique_ptr<Page[]> &table : tables) {
+    if (!table) {
+      continue;
+    }
+    for (uint32_t i = 0; i < (1u << kTableBits); i++) {
+      count += table[i] != nullptr;
+    }
+  }
+  return count;
+}
+
+Simulator::Simulator() { load({}, 0); }
+
+void Simulator::load(const std::vector<uint32_t> &code, uint32_t address) {
+  memory = PagedMemory();
+  base = address;
+  const size_t n = code.size();
+  for (size_t i = 0; i < n; i++) {
+    memory.write(base + i * 4, code[i]);
+  }
+  ops.resize(n + 2);
+  for (size_t i = 0; i < n; i++) {
+    decode(i, code[i], i + 1 < n ? code[i + 1] : 0);
+  }
+  ops[n] = ops[n + 1] = Op{OP_END, kSpare, 0, 0, 0};
+
+  std::fill(std::begin(regs), std::end(regs), 0);
+  regs[30] = SIM_STACK_TOP;
+  regs[31] = SIM_EXIT;
+  hi = lo = 0;
+  executed = 0;
+  heapStart = heapTop = (base + n * 4 + 4095) & ~4095u;
+  heapEnd = std::max(heapStart, SIM_STACK_TOP - kStackSize);
+  allocated.clear();
+  freeBlocks.clear();
+}
+
+// Decodes word, the word at index followed by next, into its op.
+void Simulator::decode(size_t index, uint32_t word, uint32_t next) {
+  const size_t n = ops.size() - 2;
+  Op op = decodeWord(word, next);
+  if (op.kind == OP_BEQ || op.kind == OP_BNE) {
+    const int64_t target = static_cast<int64_t>(index) + 1 +
+                           static_cast<int32_t>(op.imm);
+    if (target < 0 || target > static_cast<int64_t>(n)) {
+      op.kind = op.kind == OP_BEQ ? OP_BEQ_OUT : OP_BNE_OUT;
+    }
+    op.imm = static_cast<uint32_t>(target);
+  }
+  ops[index] = op;
+}
+
+void Simulator::setReg(unsigned r, uint32_t value) {
+  if (r != 0 && r < 32) {
+    regs[r] = value;
+  }
+}
+
+void Simulator::run(bool profile) {
+  if (profile) {
+    counts.assign(ops.size() - 2, 0);
+    execute<true>();
+  } else {
+    execute<false>();
+  }
+}
+
+/*
+ * The interpreter loop. Every handler ends by dispatching the next op
+ * itself, through a table of label addresses, so each instruction costs
+ * one indirect jump.
+ */
+template <bool Profile> void Simulator::execute() {
+  static const void *const handlers[OP_KINDS] = {
+      &&add,  &&sub, &&slt,     &&sltu,    &&mult,    &&multu, &&div,
+      &&divu, &&mfhi, &&mflo,   &&lis,     &&jr,      &&jalr,  &&lw,
+      &&sw,   &&beq, &&bne,     &&beq_out, &&bne_out, &&invalid, &&end};
+  const Op *const code = ops.data();
+  const size_t n = ops.size() - 2;
+  const Op *pc = code;
+  uint32_t *const r = regs;
+  uint64_t *const count = counts.data();
+  const uint64_t budget = stepLimit > executed ? stepLimit - executed : 0;
+  uint64_t remaining = budget;
+  uint32_t target = 0;
+  std::string error;
+
+#define DISPATCH()                                                             \
+  do {                                                                         \
+    if (remaining == 0)                                                        \
+      goto limit;                                                              \
+    remaining--;                                                               \
+    if (Profile)                                                               \
+      count[pc - code]++;                                                      \
+    goto *handlers[pc->kind];                                                  \
+  } while (0)
+#define NEXT(k)                                                                \
+  do {                                                                         \
+    pc += k;                                                                   \
+    DISPATCH();                                                                \
+  } while (0)
+#define JUMP(address)                                                          \
+  do {                                                                         \
+    target = (address);                                                        \
+    const uint32_t offset = target - base;                                     \
+    if ((offset & 3) == 0 && offset / 4 < n) {                                 \
+      pc = code + offset / 4;                                                  \
+      DISPATCH();                                                              \
+    }                                                                          \
+    goto far;                                                                  \
+  } while (0)
+#define FAIL(message)                                                          \
+  do {                                                                         \
+    error = (message);                                                         \
+    goto failed;                                                               \
+  } while (0)
+
+  DISPATCH();
+
+add:
+  r[pc->d] = r[pc->s] + r[pc->t];
+  NEXT(1);
+sub:
+  r[pc->d] = r[pc->s] - r[pc->t];
+  NEXT(1);
+slt:
+  r[pc->d] = static_cast<int32_t>(r[pc->s]) < static_cast<int32_t>(r[pc->t]);
+  NEXT(1);
+sltu:
+  r[pc->d] = r[pc->s] < r[pc->t];
+  NEXT(1);
+mult: {
+  const int64_t product = static_cast<int64_t>(static_cast<int32_t>(r[pc->s])) *
+                          static_cast<int32_t>(r[pc->t]);
+  lo = static_cast<uint32_t>(product);
+  hi = static_cast<uint32_t>(static_cast<uint64_t>(product) >> 32);
+  NEXT(1);
+}
+multu: {
+  const uint64_t product = static_cast<uint64_t>(r[pc->s]) * r[pc->t];
+  lo = static_cast<uint32_t>(product);
+  hi = static_cast<uint32_t>(product >> 32);
+  NEXT(1);
+}
+div: {
+  const int32_t dividend = static_cast<int32_t>(r[pc->s]);
+  const int32_t divisor = static_cast<int32_t>(r[pc->t]);
+  if (divisor == 0) {
+    FAIL("ERROR: Division by zero");
+  }
+  if (dividend == INT32_MIN && divisor == -1) {
+    lo = static_cast<uint32_t>(dividend);
+    hi = 0;
+  } else {
+    lo = static_cast<uint32_t>(dividend / divisor);
+    hi = static_cast<uint32_t>(dividend % divisor);
+  }
+  NEXT(1);
+}
+divu:
+  if (r[pc->t] == 0) {
+    FAIL("ERROR: Division by zero");
+  }
+  lo = r[pc->s] / r[pc->t];
+  hi = r[pc->s] % r[pc->t];
+  NEXT(1);
+mfhi:
+  r[pc->d] = hi;
+  NEXT(1);
+mflo:
+  r[pc->d] = lo;
+  NEXT(1);
+lis:
+  r[pc->d] = pc->imm;
+  NEXT(2);
+jr:
+  JUMP(r[pc->s]);
+jalr: {
+  const uint32_t address = r[pc->s];
+  r[31] = base + static_cast<uint32_t>(pc - code + 1) * 4;
+  JUMP(address);
+}
+lw: {
+  const uint32_t address = r[pc->s] + pc->imm;
+  if (address & 3) {
+    FAIL("ERROR: Unaligned load from " + hex(address));
+  }
+  if (address >= kDeviceStart) {
+    if (address != SIM_INPUT) {
+      FAIL("ERROR: Load from device address " + hex(address));
+    }
+    r[pc->d] = readInput();
+  } else {
+    r[pc->d] = memory.read(address);
+  }
+  NEXT(1);
+}
+sw: {
+  const uint32_t address = r[pc->s] + pc->imm;
+  if (address & 3) {
+    FAIL("ERROR: Unaligned store to " + hex(address));
+  }
+  if (address >= kDeviceStart) {
+    if (address != SIM_OUTPUT) {
+      FAIL("ERROR: Store to device address " + hex(address));
+    }
+    writeOutput(static_cast<char>(r[pc->t]));
+    NEXT(1);
+  }
+  memory.write(address, r[pc->t]);
+  // A store into the program changes the word and the lis before it.
+  const uint32_t offset = address - base;
+  if (offset / 4 < n) {
+    const size_t index = offset / 4;
+    decode(index, r[pc->t], memory.read(address + 4));
+    if (index != 0) {
+      decode(index - 1, memory.read(address - 4), r[pc->t]);
+    }
+  }
+  NEXT(1);
+}
+beq:
+  if (r[pc->s] == r[pc->t]) {
+    pc = code + pc->imm;
+    DISPATCH();
+  }
+  NEXT(1);
+bne:
+  if (r[pc->s] != r[pc->t]) {
+    pc = code + pc->imm;
+    DISPATCH();
+  }
+  NEXT(1);
+beq_out:
+  if (r[pc->s] == r[pc->t]) {
+    FAIL("ERROR: Branch outside the program");
+  }
+  NEXT(1);
+bne_out:
+  if (r[pc->s] != r[pc->t]) {
+    FAIL("ERROR: Branch outside the program");
+  }
+  NEXT(1);
+invalid:
+  FAIL("ERROR: Invalid instruction " + hex(memory.read(
+                                           base + (pc - code) * 4)));
+end:
+  FAIL("ERROR: Ran past the end of the program");
+
+far:
+  // A jump out of the program: system routines return to $31, which may
+  // itself be a routine.
+  for (;;) {
+    const uint32_t offset = target - base;
+    if ((offset & 3) == 0 && offset / 4 < n) {
+      pc = code + offset / 4;
+      DISPATCH();
+    }
+    try {
+      if (!isSystemRoutine(target)) {
+        FAIL("ERROR: Jump to " + hex(target) + ", outside the program");
+      }
+      if (!systemCall(target)) {
+        break;
+      }
+    } catch (SimulationFailure &f) {
+      FAIL(f.what());
+    }
+    target = r[31];
+  }
+  executed += budget - remaining;
+  flush();
+  return;
+
+limit:
+  error = "ERROR: Stopped after " + std::to_string(stepLimit) +
+          " instructions";
+failed:
+  executed += budget - remaining;
+  flush();
+  fail(error, pc - code);
+
+#undef DISPATCH
+#undef NEXT
+#undef JUMP
+#undef FAIL
+}
+
+bool Simulator::systemCall(uint32_t address) {
+  switch (address) {
+  case SIM_EXIT:
+    return false;
+  case SIM_PRINT: {
+    char text[16];
+    int length = std::snprintf(text, sizeof(text), "%d\n",
+                               static_cast<int32_t>(regs[1]));
+    for (int i = 0; i < length; i++) {
+      writeOutput(text[i]);
+    }
+    break;
+  }
+  case SIM_INIT:
+    allocated.clear();
+    freeBlocks.clear();
+    heapTop = heapStart;
+    break;
+  case SIM_NEW:
+    regs[3] = allocate(regs[1]);
+    break;
+  case SIM_DELETE:
+    release(regs[1]);
+    break;
+  }
+  return true;
+}
+
+// First fit from the free blocks, then from the untouched top of the heap.
+uint32_t Simulator::allocate(uint32_t words) {
+  if (words == 0 || words > (heapEnd - heapStart) / 4) {
+    return 0;
+  }
+  for (auto block = freeBlocks.begin(); block != freeBlocks.end(); ++block) {
+    if (block->second < words) {
+      continue;
+    }
+    const uint32_t address = block->first;
+    const uint32_t left = block->second - words;
+    freeBlocks.erase(block);
+    if (left) {
+      freeBlocks.emplace(address + words * 4, left);
+    }
+    allocated.emplace(address, words);
+    return address;
+  }
+  if (words > (heapEnd - heapTop) / 4) {
+    return 0;
+  }
+  const uint32_t address = heapTop;
+  heapTop += words * 4;
+  allocated.emplace(address, words);
+  return address;
+}
+
+void Simulator::release(uint32_t address) {
+  if (address == 0) {
+    return;
+  }
+  auto block = allocated.find(address);
+  if (block == allocated.end()) {
+    throw SimulationFailure("ERROR: delete of " + hex(address) +
+                            ", which new did not return");
+  }
+  uint32_t words = block->second;
+  allocated.erase(block);
+  // Merge with the free blocks on either side.
+  auto next = freeBlocks.lower_bound(address);
+  if (next != freeBlocks.end() && next->first == address + words * 4) {
+    words += next->second;
+    next = freeBlocks.erase(next);
+  }
+  if (next != freeBlocks.begin()) {
+    auto previous = std::prev(next);
+    if (previous->first + previous->second * 4 == address) {
+      previous->second += words;
+      return;
+    }
+  }
+  freeBlocks.emplace(address, words);
+}
+
+uint32_t Simulator::readInput() {
+  if (inputPos == input.size()) {
+    if (inputDone) {
+      return UINT32_MAX;
+    }
+    input.resize(1 << 16);
+    ssize_t got;
+    do {
+      got = ::read(0, &input[0], input.size());
+    } while (got < 0 && errno == EINTR);
+    input.resize(got > 0 ? got : 0);
+    inputPos = 0;
+    if (got <= 0) {
+      inputDone = true;
+      return UINT32_MAX;
+    }
+  }
+  return static_cast<unsigned char>(input[inputPos++]);
+}
+
+void Simulator::writeOutput(char c) {
+  output.push_back(c);
+  if (output.size() >= (1 << 16)) {
+    flush();
+  }
+}
+
+void Simulator::flush() {
+  writeBytes(1, output.data(), output.size());
+  output.clear();
+}
+
+void Simulator::fail(const std::string &message, size_t index) const {
+  throw SimulationFailure(message + " at " +
+                          hex(base + static_cast<uint32_t>(index) * 4));
+}
+
+SimulationFailure::SimulationFailure(std::string message)
+    : message(std::move(message)) {}
+
+const std::string &SimulationFailure::what() const { return message; }
@@ -0,0 +1,185 @@
+#ifndef CS241_SIMULATOR_H
+#define CS241_SIMULATOR_H
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* A simulator for the MIPS programs the assembler produces.
+ *
+ * The code words are decoded once, when they are loaded, into an array of
+ * Ops holding each instruction's kind, registers and immediate already
+ * pulled apart, with branch targets turned into op indices. Running then
+ * just steps through that array, jumping straight from the end of one
+ * instruction to the code for the next (computed goto). A store into the
+ * program decodes the words it changes again, so self-modifying code still
+ * runs as written.
+ *
+ * System routines: the addresses systemmerl.py gives the imports exit,
+ * print, init, new and delete are routines built into the simulator; a jr
+ * or jalr to one of them runs the routine and returns to $31. $31 starts
+ * at the exit routine, so a program's final jr $31 ends the simulation,
+ * and $30 starts at the top of memory, SIM_STACK_TOP.
+ *   print   writes $1 as a signed decimal number and a newline
+ *   new     returns in $3 the address of $1 fresh words, or 0
+ *   delete  frees words that new returned at address $1
+ *   init    frees everything new returned
+ * A word stored to SIM_OUTPUT writes its low byte to the output, and a
+ * load from SIM_INPUT reads the next byte of input (-1 at its end).
+ */
+
+const uint32_t SIM_EXIT = 0x0ffffff0;
+const uint32_t SIM_PRINT = 0x0ffffff4;
+const uint32_t SIM_INIT = 0x0ffffff8;
+const uint32_t SIM_NEW = 0x0ffffffc;
+const uint32_t SIM_DELETE = 0x10000000;
+const uint32_t SIM_INPUT = 0xffff0004;
+const uint32_t SIM_OUTPUT = 0xffff000c;
+const uint32_t SIM_STACK_TOP = 0x01000000;
+
+// Returns the address of the system routine called name, or 0 if there is
+// none.
+uint32_t systemRoutine(const std::string &name);
+
+/* Memory of 32-bit words over the whole address space, allocated a page at
+ * a time when a page is first written. Pages that were never written read
+ * as zero.
+ */
+class PagedMemory {
+    static constexpr unsigned kPageBits = 12; // 4 KiB pages
+    static constexpr unsigned kTableBits = 10;
+    static constexpr uint32_t kPageWords = 1u << (kPageBits - 2);
+
+    using Page = std::unique_ptr<uint32_t[]>;
+    // The page of address a is tables[a >> 22][(a >> 12) & 1023].
+    std::vector<std::unique_ptr<Page[]>> tables;
+
+    uint32_t *allocate(uint32_t address);
+
+  public:
+    PagedMemory();
+
+    // The word at the word-aligned address.
+    uint32_t read(uint32_t address) const {
+      const Page *table = tables[address >> (kPageBits + kTableBits)].get();
+      if (!table) {
+        return 0;
+      }
+      const uint32_t *page =
+          table[(address >> kPageBits) & ((1u << kTableBits) - 1)].get();
+      return page ? page[(address >> 2) & (kPageWords - 1)] : 0;
+    }
+
+    void write(uint32_t address, uint32_t word) {
+      Page *table = tables[address >> (kPageBits + kTableBits)].get();
+      uint32_t *page =
+          table ? table[(address >> kPageBits) & ((1u << kTableBits) - 1)].get()
+                : nullptr;
+      if (!page) {
+        page = allocate(address);
+      }
+      page[(address >> 2) & (kPageWords - 1)] = word;
+    }
+
+    // Pages allocated so far.
+    size_t pages() const;
+};
+
+class Simulator {
+  public:
+    // One decoded instruction.
+    struct Op {
+      uint8_t kind;
+      uint8_t d; // the register written; writes to $0 go to a spare one
+      uint8_t s;
+      uint8_t t;
+      // lis: the word loaded; lw, sw: the offset; beq, bne: the op index
+      // of the target.
+      uint32_t imm;
+    };
+
+  private:
+    PagedMemory memory;
+    // Registers $0 to $31, then the spare that writes to $0 go to.
+    uint32_t regs[33] = {};
+    uint32_t hi = 0, lo = 0;
+
+    // The program: the words at [base, base + 4 * n) decoded, followed by
+    // two ops that stop the simulation.
+    uint32_t base = 0;
+    std::vector<Op> ops;
+    std::vector<uint64_t> counts;
+    uint64_t executed = 0;
+    uint64_t stepLimit = UINT64_MAX;
+
+    // new and delete: blocks handed out and free blocks, by address, with
+    // their sizes in words.
+    uint32_t heapStart = 0, heapEnd = 0, heapTop = 0;
+    std::unordered_map<uint32_t, uint32_t> allocated;
+    std::map<uint32_t, uint32_t> freeBlocks;
+
+    std::string output;
+    std::string input;
+    size_t inputPos = 0;
+    bool inputDone = false;
+
+    void decode(size_t index, uint32_t word, uint32_t next);
+    template <bool Profile> void execute();
+    // What the program reads from SIM_INPUT, and writes to SIM_OUTPUT.
+    uint32_t readInput();
+    void writeOutput(char c);
+    // Runs the system routine at address. Returns false for exit.
+    bool systemCall(uint32_t address);
+    uint32_t allocate(uint32_t words);
+    void release(uint32_t address);
+    [[noreturn]] void fail(const std::string &message, size_t index) const;
+
+  public:
+    Simulator();
+
+    /* Loads the code words so that the first is at address base, and
+     * starts the program there. base must be a multiple of 4.
+     */
+    void load(const std::vector<uint32_t> &code, uint32_t base);
+
+    uint32_t reg(unsigned r) const { return regs[r]; }
+    void setReg(unsigned r, uint32_t value);
+
+    // Stops the program with an error once it has run this many
+    // instructions.
+    void setStepLimit(uint64_t steps) { stepLimit = steps; }
+
+    /* Runs the program until it exits. With profile set, counts how many
+     * times each instruction runs. Throws SimulationFailure if the program
+     * does something it cannot, such as run an invalid word, divide by
+     * zero or jump outside the program. Output goes to standard output as
+     * it is produced, and is complete once run() returns or throws.
+     */
+    void run(bool profile = false);
+
+    uint64_t steps() const { return executed; }
+    uint32_t codeBase() const { return base; }
+    // After a profiled run: the count for the word at codeBase() + 4 * i.
+    const std::vector<uint64_t> &instructionCounts() const { return counts; }
+    size_t memoryPages() const { return memory.pages(); }
+
+    // Writes out any buffered output.
+    void flush();
+};
+
+/* An exception class thrown when a simulated program fails.
+ */
+class SimulationFailure {
+    std::string message;
+
+  public:
+    SimulationFailure(std::string message);
+
+    // Returns the message associated with the exception.
+    const std::string &what() const;
+};
+
+#endif
@@ -0,0 +1,80 @@
+#include <cerrno>
+#include <cstring>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "sourcefile.h"
+
+SourceFile::~SourceFile() {
+  if (mapping) {
+    munmap(const_cast<char *>(mapping), mappingLength);
+  }
+}
+
+void SourceFile::map(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw SourceFailure("ERROR: Cannot open input file: " + path + ": "
+                        + std::strerror(errno));
+  }
+  struct stat info;
+  if (fstat(fd, &info) < 0) {
+    int err = errno;
+    close(fd);
+    throw SourceFailure("ERROR: Cannot stat input file: " + path + ": "
+                        + std::strerror(err));
+  }
+  // mmap rejects zero-length mappings, and an empty source needs none.
+  if (info.st_size == 0) {
+    close(fd);
+    contents = std::string_view();
+    return;
+  }
+
+  void *addr = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  int err = errno;
+  close(fd);
+  if (addr == MAP_FAILED) {
+    throw SourceFailure("ERROR: Cannot map input file: " + path + ": "
+                        + std::strerror(err));
+  }
+  madvise(addr, info.st_size, MADV_SEQUENTIAL);
+
+  mapping = static_cast<const char *>(addr);
+  mappingLength = info.st_size;
+  contents = std::string_view(mapping, mappingLength);
+}
+
+void SourceFile::read(int fd) {
+  const size_t chunk = 1 << 16;
+  buffer.clear();
+  for (;;) {
+    size_t used = buffer.size();
+    buffer.resize(used + chunk);
+    ssize_t got = ::read(fd, &buffer[used], chunk);
+    if (got < 0 && errno == EINTR) {
+      buffer.resize(used);
+      continue;
+    }
+    if (got < 0) {
+      int err = errno;
+      buffer.resize(used);
+      throw SourceFailure(std::string("ERROR: Cannot read input: ")
+                          + std::strerror(err));
+    }
+    buffer.resize(used + got);
+    if (got == 0) {
+      break;
+    }
+  }
+  contents = buffer;
+}
+
+std::string_view SourceFile::text() const { return contents; }
+
+SourceFailure::SourceFailure(std::string message):
+  message(std::move(message)) {}
+
+const std::string &SourceFailure::what() const { return message; }
@@ -0,0 +1,65 @@
+#ifndef CS241_SOURCEFILE_H
+#define CS241_SOURCEFILE_H
+#include <string>
+#include <string_view>
+
+/* An assembly source held in memory as one contiguous buffer.
+ *
+ * A file named on the command line is mapped read-only, so even very large
+ * generated sources are never copied; the scanner reads straight out of the
+ * mapping. Standard input may be a pipe, so it is read into an owned buffer
+ * instead. Either way text() stays valid until the SourceFile is destroyed,
+ * which means tokens scanned from it can refer into it.
+ */
+class SourceFile {
+    const char *mapping = nullptr;
+    size_t mappingLength = 0;
+    std::string buffer;
+    std::string_view contents;
+
+  public:
+    SourceFile() = default;
+    ~SourceFile();
+    SourceFile(const SourceFile &) = delete;
+    SourceFile &operator=(const SourceFile &) = delete;
+
+    // Maps the file at path read-only.
+    // Throws SourceFailure if it cannot be opened or mapped.
+    void map(const std::string &path);
+
+    // Reads everything from the file descriptor fd until end of file.
+    // Throws SourceFailure on a read error.
+    void read(int fd);
+
+    std::string_view text() const;
+};
+
+/* Calls f on each line of text, without the trailing newline.
+ * Lines are views into text, the same lines std::getline would produce.
+ */
+template <typename F>
+void forEachLine(std::string_view text, F &&f) {
+  size_t start = 0;
+  while (start < text.size()) {
+    size_t end = text.find('\n', start);
+    if (end == std::string_view::npos) {
+      end = text.size();
+    }
+    f(text.substr(start, end - start));
+    start = end + 1;
+  }
+}
+
+/* An exception class thrown when a source cannot be read.
+ */
+class SourceFailure {
+    std::string message;
+
+  public:
+    SourceFailure(std::string message);
+
+    // Returns the message associated with the exception.
+    const std::string &what() const;
+};
+
+#endif
@@ -0,0 +1,401 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "assembler.h"
+#include "wordio.h"
+
+/*
+ * Streaming assembly.
+ *
+ * One pass over the source does the work of both passes: each line is checked
+ * and encoded as soon as it is read, with the labels defined so far. A label
+ * used before it is defined leaves a placeholder word and a fixup chained
+ * to the label; defining the label walks its chain and fills the words in.
+ * Output is buffered and written in large blocks, so only names, waiting
+ * fixups and the last block stay in memory.
+ */
+
+namespace {
+
+// The source is read this many bytes at a time.
+constexpr size_t kReadBytes = 1 << 20;
+// Output is written once this many words are buffered, keeping back the
+// last kKeepWords, twice the reach of a branch, so that branch fixups are
+// nearly always filled in before their words are written.
+constexpr size_t kBufferWords = 1 << 20;
+constexpr size_t kKeepWords = 1 << 16;
+// Names are copied into blocks of this many bytes.
+constexpr size_t kNameBlock = 1 << 16;
+constexpr uint32_t NO_FIXUP = UINT32_MAX;
+
+/* Owned copies of the names the symbol table holds views of. The source
+ * they were scanned from is only kept a block at a time.
+ */
+class NameArena {
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char *next = nullptr; // free space in the newest small block
+    size_t left = 0;
+
+  public:
+    std::string_view copy(std::string_view name) {
+      char *to;
+      if (name.size() > kNameBlock / 4) {
+        // A long name gets a block of its own.
+        blocks.emplace_back(new char[name.size()]);
+        to = blocks.back().get();
+      } else {
+        if (name.size() > left) {
+          blocks.emplace_back(new char[kNameBlock]);
+          next = blocks.back().get();
+          left = kNameBlock;
+        }
+        to = next;
+        next += name.size();
+        left -= name.size();
+      }
+      std::memcpy(to, name.data(), name.size());
+      return std::string_view(to, name.size());
+    }
+};
+
+/* The output file, written in order. Words from index written on are
+ * still in buffer, in host byte order, and can be changed there; earlier
+ * ones are changed in the file.
+ */
+class StreamOutput {
+    int fd;
+    std::vector<uint32_t> buffer;
+    uint64_t written = 0;
+
+    bool writeOut(size_t count) {
+      swapWords(buffer.data(), buffer.data(), count);
+      if (!writeBytes(fd, buffer.data(), count * 4)) {
+        return false;
+      }
+      buffer.erase(buffer.begin(), buffer.begin() + count);
+      written += count;
+      return true;
+    }
+
+  public:
+    size_t late = 0; // words changed after they were written
+
+    explicit StreamOutput(int fd) : fd(fd) { buffer.reserve(kBufferWords); }
+
+    uint64_t size() const { return written + buffer.size(); }
+    void push(uint32_t word) { buffer.push_back(word); }
+
+    // Writes out all but the last kKeepWords words once the buffer is full.
+    bool spill() {
+      return buffer.size() < kBufferWords ||
+             writeOut(buffer.size() - kKeepWords);
+    }
+    bool finish() { return writeOut(buffer.size()); }
+
+    // Sets word index of the file. Returns false (with errno set) if it
+    // had been written and cannot be written again.
+    bool set(uint64_t index, uint32_t word) {
+      if (index >= written) {
+        buffer[index - written] = word;
+        return true;
+      }
+      late++;
+      uint32_t big;
+      swapWords(&word, &big, 1);
+      return pwrite(fd, &big, 4, static_cast<off_t>(index * 4)) == 4;
+    }
+};
+
+// A word waiting for a label to be defined.
+struct Fixup {
+  uint32_t pc;     // the address of the word
+  uint32_t word;   // a branch's encoding, with an offset of 0
+  uint32_t next;   // the next fixup on the same label, or NO_FIXUP
+  bool branch;     // a beq or bne, rather than a .word
+};
+
+} // namespace
+
+bool Assembler::assembleStream(int in, int out, const AsmOptions &options,
+                               StreamStats &stats, std::string &message) {
+  reset();
+  stats = StreamStats{};
+  NameArena names;
+  StreamOutput output(out);
+  // Fixups are kept in a pool with a free list, and chained per label
+  // from waiting, which is indexed by symbol id.
+  std::vector<Fixup> fixups;
+  std::vector<uint32_t> waiting;
+  uint32_t freeFixup = NO_FIXUP;
+  size_t pending = 0;
+  // Set by the first label or instruction, which fixes the format.
+  bool started = false;
+  uint32_t pc_start = 0, pc = 0;
+  uint64_t header = 0;
+  // For encode(), which reports errors and branches through a chunk.
+  EncodeChunk chunk;
+  // The tokens of the line being assembled.
+  TokenArena tokens;
+
+  auto failWith = [&](std::string text) {
+    message = std::move(text);
+    // A pipe cannot be truncated and keeps what it was given, but a file
+    // left holding part of a program should not go unnoticed.
+    if (ftruncate(out, 0) != 0) {
+      int error = errno;
+      struct stat st;
+      if (fstat(out, &st) == 0 && S_ISREG(st.st_mode)) {
+        message += std::string(" (cannot truncate output file: ") +
+                   std::strerror(error) + ")";
+      }
+    }
+    reset();
+    return false;
+  };
+  auto writeFailed = [&]() {
+    if (errno == ESPIPE) {
+      return failWith("ERROR: Cannot go back to fill in words already "
+                      "written to a pipe; write to a file instead");
+    }
+    return failWith(std::string("ERROR: Cannot write output file: ") +
+                    std::strerror(errno));
+  };
+  auto intern = [&](std::string_view name) {
+    uint32_t id = symbols.find(name);
+    if (id == SymbolTable::NONE) {
+      id = symbols.intern(names.copy(name));
+      symbolTable.emplace_back();
+      waiting.push_back(NO_FIXUP);
+    }
+    return id;
+  };
+  auto start = [&]() {
+    if (!started) {
+      started = true;
+      // A MERL module's code follows its three word header, which is
+      // filled in at the end.
+      if (merl_module) {
+        pc_start = MERL_CODE_START;
+        header = 3;
+        for (uint64_t i = 0; i < header; i++) {
+          output.push(0);
+        }
+      }
+      pc = pc_start;
+    }
+  };
+  auto addFixup = [&](uint32_t symbol, uint32_t at, uint32_t encoding,
+                      bool branch) {
+    uint32_t f = freeFixup;
+    if (f == NO_FIXUP) {
+      f = static_cast<uint32_t>(fixups.size());
+      fixups.emplace_back();
+    } else {
+      freeFixup = fixups[f].next;
+    }
+    fixups[f] = Fixup{at, encoding, waiting[symbol], branch};
+    waiting[symbol] = f;
+    pending++;
+    stats.peakFixups = std::max(stats.peakFixups, pending);
+  };
+  // Fills in every word waiting for a label that has just been defined.
+  auto resolve = [&](uint32_t symbol) {
+    const uint32_t address = symbolTable[symbol].address;
+    for (uint32_t f = waiting[symbol]; f != NO_FIXUP;) {
+      Fixup &fixup = fixups[f];
+      // As branchOffset() computes it: in words from the next instruction.
+      const uint32_t value =
+          fixup.branch
+              ? encodeI(0, 0, 0, (address - (fixup.pc + 4)) / 4) | fixup.word
+              : address;
+      if (!output.set(header + (fixup.pc - pc_start) / 4, value)) {
+        return false;
+      }
+      const uint32_t next = fixup.next;
+      fixup.next = freeFixup;
+      freeFixup = f;
+      f = next;
+      pending--;
+      stats.fixups++;
+    }
+    waiting[symbol] = NO_FIXUP;
+    return true;
+  };
+
+  // Does what the two passes do for one line. Returns false after calling
+  // failWith().
+  auto assembleLine = [&](std::string_view text) {
+    stats.lines++;
+    tokens.clear();
+    scan(text, tokens);
+    const TokenLine line = tokens.line(0);
+    for (uint32_t t = 0; t < line.size(); t++) {
+      if (line.kind(t) == Token::ID) {
+        tokens.setSymbol(t, intern(line.lexeme(t)));
+      } else if (line.kind(t) == Token::LABEL) {
+        std::string_view label = line.lexeme(t);
+        tokens.setSymbol(t, intern(label.substr(0, label.size() - 1)));
+      }
+    }
+    // .import and .export, as recordDirective() recognizes them.
+    if (line.size() >= 2 && line.kind(1) == Token::ID &&
+        (line.kind(0) == Token::IMPORT || line.kind(0) == Token::EXPORT)) {
+      if (started) {
+        return failWith("ERROR: .import and .export must come before any "
+                        "label or instruction when streaming");
+      }
+      SymbolInfo &info = symbolTable[line.symbol(1)];
+      if (line.kind(0) == Token::IMPORT) {
+        info.imported = true;
+        info.defined = true;
+        info.address = 0;
+      } else {
+        info.exported = true;
+      }
+      merl_module = true;
+      return true;
+    }
+    uint32_t ind = 0;
+    while (ind < line.size() && line.kind(ind) == Token::LABEL) {
+      start();
+      const uint32_t symbol = line.symbol(ind);
+      SymbolInfo &label = symbolTable[symbol];
+      if (label.defined) {
+        return failWith("ERROR: Duplicate Labels");
+      }
+      label.defined = true;
+      label.address = pc;
+      if (!resolve(symbol)) {
+        return writeFailed();
+      }
+      ind++;
+    }
+    if (ind == line.size()) {
+      return true;
+    }
+    start();
+    const OpcodeDescriptor *op = instruction(ind, line);
+    if (!op && !word(ind, line)) {
+      return failWith("ERROR: Invalid instruction or parameters");
+    }
+    pc += 4;
+    uint32_t encoding = 0;
+    if (!op) {
+      if (line.kind(ind + 1) == Token::ID) {
+        const uint32_t symbol = line.symbol(ind + 1);
+        if (symbolTable[symbol].defined) {
+          encoding = symbolTable[symbol].address;
+        } else {
+          addFixup(symbol, pc - 4, 0, false);
+        }
+        // Only a module's records need these.
+        if (merl_module) {
+          word_references.push_back({symbol, pc - 4});
+        }
+      } else {
+        encoding = line.number(ind + 1);
+      }
+    } else if (op->layout == BRANCH && line.kind(ind + 5) == Token::ID &&
+               !symbolTable[line.symbol(ind + 5)].defined) {
+      encoding = encodeI(op->opcode, line.number(ind + 1),
+                         line.number(ind + 3), 0);
+      addFixup(line.symbol(ind + 5), pc - 4, encoding, true);
+    } else {
+      if (!encode(*op, ind, line, pc, encoding, chunk)) {
+        return failWith(std::move(chunk.error_message));
+      }
+      chunk.branch_references.clear();
+    }
+    output.push(encoding);
+    return output.spill() || writeFailed();
+  };
+
+  // Lines are taken from the buffer as they complete; the part line at its
+  // end moves to the front before the next read.
+  std::string buffer(kReadBytes, '\0');
+  size_t filled = 0;
+  try {
+    for (;;) {
+      const ssize_t n = read(in, &buffer[filled], buffer.size() - filled);
+      if (n < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return failWith(std::string("ERROR: Cannot read input: ") +
+                        std::strerror(errno));
+      }
+      if (n == 0) {
+        break;
+      }
+      filled += n;
+      const char *const text = buffer.data();
+      size_t from = 0;
+      while (const char *end = static_cast<const char *>(
+                 std::memchr(text + from, '\n', filled - from))) {
+        if (!assembleLine(std::string_view(text + from, end - (text + from)))) {
+          return false;
+        }
+        from = end - text + 1;
+      }
+      std::memmove(&buffer[0], text + from, filled - from);
+      filled -= from;
+      if (filled == buffer.size()) {
+        // A line longer than the buffer.
+        buffer.resize(buffer.size() * 2);
+      }
+    }
+    if (filled && !assembleLine(std::string_view(buffer.data(), filled))) {
+      return false;
+    }
+  } catch (ScanningFailure &f) {
+    return failWith(f.what());
+  }
+
+  if (pending) {
+    // The first word in the program that waits for an undefined label.
+    uint32_t first = NO_FIXUP, firstSymbol = 0;
+    for (uint32_t symbol = 0; symbol < waiting.size(); symbol++) {
+      for (uint32_t f = waiting[symbol]; f != NO_FIXUP; f = fixups[f].next) {
+        if (first == NO_FIXUP || fixups[f].pc < fixups[first].pc) {
+          first = f;
+          firstSymbol = symbol;
+        }
+      }
+    }
+    const std::string name(symbols.name(firstSymbol));
+    return failWith(fixups[first].branch
+                        ? "ERROR: " + name + " is an invalid token"
+                        : "ERROR: Invalid Lablel:" + name);
+  }
+
+  start();
+  stats.symbols = symbols.size();
+  stats.merl_module = merl_module;
+  if (merl_module && options.merl_records) {
+    const size_t code_words = (pc - pc_start) / 4;
+    AsmReturn result;
+    moveResults(result);
+    get_entries_binary(result, result.entries_binary, options.merl_format);
+    for (uint32_t entry : result.entries_binary) {
+      output.push(entry);
+    }
+    const std::array<uint32_t, 3> words =
+        merlHeader(code_words, result.entries_binary.size(),
+                   options.merl_format);
+    for (size_t i = 0; i < words.size(); i++) {
+      if (!output.set(i, words[i])) {
+        return writeFailed();
+      }
+    }
+  }
+  stats.words = output.size();
+  stats.latePatches = output.late;
+  if (!output.finish()) {
+    return writeFailed();
+  }
+  reset();
+  return true;
+}
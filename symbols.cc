@@ -0,0 +1,84 @@
+#include <algorithm>
+#include "symbols.h"
+
+// 32-bit FNV-1a.
+uint32_t SymbolTable::hashName(std::string_view name) {
+  uint32_t hash = 2166136261u;
+  for (char c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+void SymbolTable::grow() {
+  std::vector<Slot> old(std::max<size_t>(slots.size() * 2, 64),
+                        Slot{0, NONE});
+  old.swap(slots);
+  const size_t mask = slots.size() - 1;
+  for (const Slot &slot : old) {
+    if (slot.id == NONE) {
+      continue;
+    }
+    size_t i = slot.hash & mask;
+    while (slots[i].id != NONE) {
+      i = (i + 1) & mask;
+    }
+    slots[i] = slot;
+  }
+}
+
+uint32_t SymbolTable::intern(std::string_view name) {
+  // Keep the load factor at or below one half.
+  if ((names.size() + 1) * 2 > slots.size()) {
+    grow();
+  }
+  const uint32_t hash = hashName(name);
+  const size_t mask = slots.size() - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    Slot &slot = slots[i];
+    if (slot.id == NONE) {
+      slot = Slot{hash, static_cast<uint32_t>(names.size())};
+      names.push_back(name);
+      return slot.id;
+    }
+    if (slot.hash == hash && names[slot.id] == name) {
+      return slot.id;
+    }
+  }
+}
+
+uint32_t SymbolTable::find(std::string_view name) const {
+  if (slots.empty()) {
+    return NONE;
+  }
+  const uint32_t hash = hashName(name);
+  const size_t mask = slots.size() - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    const Slot &slot = slots[i];
+    if (slot.id == NONE) {
+      return NONE;
+    }
+    if (slot.hash == hash && names[slot.id] == name) {
+      return slot.id;
+    }
+  }
+}
+
+// Empties only the slots of the interned names, so clearing a table that
+// grew for one large source costs nothing extra after small ones. Slots
+// emptied on the way are stepped over, as each name is known to be there.
+void SymbolTable::clear() {
+  if (names.size() * 4 >= slots.size()) {
+    std::fill(slots.begin(), slots.end(), Slot{0, NONE});
+  } else {
+    const size_t mask = slots.size() - 1;
+    for (uint32_t id = 0; id < names.size(); id++) {
+      size_t i = hashName(names[id]) & mask;
+      while (slots[i].id != id) {
+        i = (i + 1) & mask;
+      }
+      slots[i] = Slot{0, NONE};
+    }
+  }
+  names.clear();
+}
@@ -0,0 +1,46 @@
+#ifndef CS241_SYMBOLS_H
+#define CS241_SYMBOLS_H
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/* Interns symbol names as dense integer ids.
+ *
+ * Ids are handed out in order of first appearance, starting at 0, so data
+ * about symbols can live in plain vectors indexed by id. Lookups go through
+ * a flat open-addressing hash table with linear probing.
+ *
+ * Names are not copied: they are views into the scanned source, which must
+ * outlive the table.
+ */
+class SymbolTable {
+  public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+  private:
+    struct Slot {
+      uint32_t hash;
+      uint32_t id; // NONE if the slot is empty
+    };
+
+    std::vector<Slot> slots; // size is zero or a power of two
+    std::vector<std::string_view> names;
+
+    static uint32_t hashName(std::string_view name);
+    void grow();
+
+  public:
+    // Returns the id of name, adding it if it has not been seen before.
+    uint32_t intern(std::string_view name);
+
+    // Returns the id of name, or NONE if it has not been interned.
+    uint32_t find(std::string_view name) const;
+
+    std::string_view name(uint32_t id) const { return names[id]; }
+    uint32_t size() const { return static_cast<uint32_t>(names.size()); }
+
+    // Forgets every name, keeping the allocated storage for reuse.
+    void clear();
+};
+
+#endif
@@ -0,0 +1 @@
+beq $1, $2, 0x10000
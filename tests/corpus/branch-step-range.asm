@@ -0,0 +1 @@
+beq $1, $2, 40000
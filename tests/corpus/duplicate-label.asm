@@ -0,0 +1 @@
+a: a: add $1,$2,$3
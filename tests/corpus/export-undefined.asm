@@ -0,0 +1,2 @@
+.export nothere
+add $1,$2,$3
@@ -0,0 +1 @@
+mult $1, $2, $3
@@ -0,0 +1,2 @@
+foo: add $1,$2,$3
+.import foo
@@ -0,0 +1,2 @@
+.import
+.word 1
@@ -0,0 +1,10 @@
+x:
+y: z:
+.word x
+.word z
+beq $0,$0,x
+bne $0, $0, -32768
+beq $0,$0,0xffff
+.word 0x0
+.word 00
+.word -0
@@ -0,0 +1,3 @@
+lw $1, 0x10000($2)
+sw $1, -70000($2)
+add $32,$1,$2
@@ -0,0 +1 @@
+jr
@@ -0,0 +1,2007 @@
+.import ext0
+.import ext1
+.import ext2
+.import ext3
+.import ext4
+.export L0
+L0: slt $7, $31, $28
+.word 1240057366
+.word 4006204038
+slt $1, $1, $1
+add $24, $13, $27
+; comment only
+.word L0
+beq $14, $29, L243 ; fwd
+add $26, $6, $11
+lis $3	;tab
+sltu $21, $27, $12
+
+.word ext4
+add $30, $15, $25
+div $23, $5
+; comment only
+L1: divu $23, $31
+.word L1
+
+.word 0x8c5fe8f8
+
+lw $24, 89($13)
+add $30, $23, $12
+.word 0x5b569643
+L2: ; comment only
+
+
+L3: mflo $11
+; comment only
+lw $4, -79($28)
+L4: lw $17, -72($22)
+multu $16, $10
+beq $18, $29, L179 ; fwd
+.word L0
+bne $12, $16, -37
+jalr $27
+add $14, $1, $25
+L5: lis $3	;tab
+.word L5
+jalr $28
+beq $1, $25, L172 ; fwd
+bne $3, $19, L3
+lw $4, 0xeacc($10)
+lw $0, 43($13)
+
+lis $3	;tab
+add $24, $12, $22
+L6: 
+.word 0x7e0ab2ed
+.word L5
+.word 1716605109
+
+bne $13, $17, L6
+bne $15, $4, L1
+L7: multu $17, $21
+sw $21, 0x1d29($15)
+
+lis $3	;tab
+mult $20, $2
+.word 0xd418f7af
+L8: 
+.word 2476699920
+bne $7, $29, L0
+add $0, $5, $26
+L9: add $12, $15, $26
+.word ext1
+lis $3	;tab
+.word 3772172134
+beq $1, $0, L9
+.word 0x101e75eb
+.word L4
+
+; comment only
+.word L4
+lis $12
+slt $5, $28, $5
+beq $21, $14, L99 ; fwd
+add $20, $11, $20
+
+lw $21, -75($15)
+jr $4
+sltu $4, $1, $0
+bne $30, $9, L5
+L10: beq $11, $11, L198 ; fwd
+L11: div $19, $6
+
+mflo $2
+
+; comment only
+lis $3	;tab
+mflo $19
+mult $15, $16
+beq $28, $27, L140 ; fwd
+.word L7
+L12: beq $16, $31, L10
+
+L13: lis $3	;tab
+multu $8, $16
+sw $25, -56($14)
+div $28, $14
+.word L3
+bne $14, $3, L11
+lis $19
+; comment only
+lis $3	;tab
+.word L1
+
+
+div $27, $13
+lis $3	;tab
+add $31, $25, $22
+mult $5, $16
+lw $8, 98($28)
+jr $27
+bne $8, $31, L13
+.word 0xa9172a05
+lis $3	;tab
+jalr $28
+add $15, $16, $13
+multu $17, $19
+sw $10, 0x5b61($26)
+jalr $24
+sub $7, $0, $18
+lis $3	;tab
+mult $23, $19
+beq $22, $20, L0 ; fwd
+L14: lis $3	;tab
+sw $21, 0xaef4($7)
+.word 0x8e903fd9
+lis $3	;tab
+lis $3	;tab
+.word L13
+lis $3	;tab
+lw $28, 58($23)
+beq $24, $27, L248 ; fwd
+
+lis $3	;tab
+lis $3	;tab
+L15: lis $3	;tab
+beq $18, $1, L104 ; fwd
+divu $17, $11
+
+L16: sw $19, 0x764a($31)
+; comment only
+L17: ; comment only
+L18: 
+beq $28, $1, L5
+.word 3332016672
+bne $4, $4, L16
+.word L17
+div $17, $22
+jr $25
+sw $14, -34($1)
+
+.word 3214467310
+divu $9, $16
+multu $8, $28
+.word 0xb7d9365c
+L19: jr $20
+sub $2, $3, $1
+mfhi $31
+lis $3	;tab
+
+beq $17, $7, L156 ; fwd
+sub $25, $14, $31
+multu $15, $18
+
+.word L10
+sub $5, $2, $0
+.word L12
+lw $25, -60($1)
+L20: mult $24, $16
+L21: .word L0
+L22: add $8, $2, $17
+.word -1756479669
+beq $12, $28, L99 ; fwd
+sw $15, -38($22)
+lis $3	;tab
+; comment only
+bne $12, $27, L22
+
+slt $11, $6, $9
+L23: jr $2
+L24: sltu $30, $23, $6
+add $8, $2, $28
+.word 0x451e07ea
+slt $2, $24, $3
+beq $16, $24, L21
+.word 0x3495d62a
+.word 0x1accd407
+; comment only
+
+; comment only
+L25: lw $12, 0x63a5($6)
+mult $2, $19
+beq $20, $26, L76 ; fwd
+sw $0, 34($20)
+bne $4, $28, L14
+lis $3	;tab
+sltu $3, $8, $3
+
+lw $21, 0xfd98($25)
+
+; comment only
+add $9, $16, $14
+sub $26, $3, $6
+beq $17, $6, L52 ; fwd
+beq $5, $4, L203 ; fwd
+beq $11, $27, L5 ; fwd
+.word L7
+
+jr $28
+; comment only
+jr $4
+sw $12, 0xbf2d($31)
+L26: 
+
+add $22, $29, $0
+lw $7, 0x8332($18)
+; comment only
+; comment only
+beq $19, $28, L77 ; fwd
+L27: .word L4
+div $0, $27
+
+L28: .word -420310291
+add $24, $17, $29
+bne $21, $24, L3
+divu $9, $1
+sw $8, 0xc941($26)
+; comment only
+.word 0x6efa083b
+.word L22
+sub $13, $9, $14
+slt $9, $30, $6
+lis $3	;tab
+add $5, $27, $3
+; comment only
+add $6, $26, $7
+beq $17, $11, L122 ; fwd
+lis $3	;tab
+mfhi $24
+L29: .word L21
+.word 2646374316
+L30: 
+mflo $16
+; comment only
+.word L13
+
+.word L0
+lis $3	;tab
+lis $3	;tab
+; comment only
+lw $14, 0x4649($15)
+div $12, $26
+
+add $9, $26, $17
+lis $3	;tab
+.word ext1
+.word L21
+divu $9, $3
+; comment only
+beq $13, $20, L159 ; fwd
+beq $8, $8, L14
+L31: ; comment only
+add $11, $7, $14
+; comment only
+sw $20, -99($19)
+mfhi $14
+beq $21, $17, L153 ; fwd
+.word -2048163483
+L32: mult $22, $4
+L33: slt $20, $15, $17
+beq $5, $8, L15
+L34: bne $0, $20, L8
+sw $5, 0x939e($26)
+.word 3440677716
+jr $17
+sw $16, 0x2046($6)
+sltu $23, $1, $19
+multu $4, $9
+jr $21
+lw $9, 0xd548($25)
+L35: 
+L36: lw $0, 0x21f0($6)
+.word 0xeefb98a9
+.word L6
+add $0, $2, $7
+; comment only
+bne $22, $30, L15
+L37: beq $7, $2, L27
+bne $3, $27, L22
+bne $15, $9, L7
+divu $21, $7
+add $30, $13, $24
+divu $14, $6
+beq $29, $30, L12
+.word 0x924925d4
+mult $24, $26
+L38: add $4, $11, $29
+beq $18, $9, L39 ; fwd
+slt $1, $29, $25
+lis $3	;tab
+jalr $25
+; comment only
+.word 0xa98a6ddc
+sltu $10, $11, $24
+; comment only
+mfhi $12
+lis $3	;tab
+; comment only
+L39: .word 0xa4d5daf8
+L40: sltu $30, $2, $15
+add $19, $29, $17
+multu $20, $28
+.word 0xb2e9ed25
+.word L23
+sw $11, 99($23)
+div $16, $16
+sw $0, -62($16)
+sltu $12, $27, $15
+; comment only
+lis $3	;tab
+beq $4, $9, L201 ; fwd
+add $25, $24, $26
+
+beq $4, $15, L217 ; fwd
+lw $25, -9($14)
+div $31, $18
+L41: lw $29, -95($23)
+lw $3, -20($6)
+L42: .word 3203612679
+lis $3	;tab
+.word 74927169
+jalr $24
+; comment only
+lw $10, 71($26)
+beq $26, $25, L69 ; fwd
+beq $8, $11, L143 ; fwd
+L43: add $31, $13, $25
+; comment only
+beq $6, $4, L2
+.word L11
+jalr $24
+mflo $23
+
+slt $3, $29, $2
+multu $18, $30
+L44: ; comment only
+L45: 
+.word 0x64f62cde
+add $30, $1, $27
+lis $3	;tab
+div $4, $23
+; comment only
+
+add $0, $6, $21
+beq $23, $4, L40
+L46: ; comment only
+; comment only
+; comment only
+L47: div $23, $13
+L48: 
+L49: slt $20, $26, $23
+sw $2, 82($16)
+.word 216411837
+sw $5, 0x484d($15)
+sw $3, 0x831c($13)
+sltu $20, $21, $18
+mult $28, $23
+add $1, $20, $26
+; comment only
+L50: 
+beq $27, $11, L249 ; fwd
+mfhi $8
+; comment only
+L51: sw $12, 0x5c7e($21)
+
+mfhi $0
+add $10, $16, $2
+L52: sltu $11, $2, $12
+lw $31, 0x5f12($25)
+sub $11, $12, $19
+
+.word L1
+sltu $27, $21, $21
+L53: .word 0xdae958f8
+div $19, $25
+sw $19, -97($29)
+beq $28, $13, L21
+beq $9, $24, L220 ; fwd
+beq $7, $22, L223 ; fwd
+add $16, $3, $19
+bne $19, $3, L5
+beq $4, $8, L199 ; fwd
+.word 461438685
+; comment only
+beq $23, $19, L75 ; fwd
+; comment only
+sub $26, $14, $2
+beq $14, $15, L182 ; fwd
+jalr $9
+sw $0, 0xb458($28)
+beq $9, $1, L94 ; fwd
+bne $20, $7, L18
+beq $17, $27, L2 ; fwd
+sltu $31, $7, $14
+lis $3	;tab
+sw $23, -41($10)
+L54: add $4, $13, $0
+.word 1514067890
+L55: bne $1, $0, L30
+sw $14, 0x35f3($3)
+; comment only
+add $21, $20, $26
+L56: 
+beq $5, $11, L55 ; fwd
+lw $3, -20($4)
+multu $2, $18
+add $5, $28, $12
+beq $11, $7, L14 ; fwd
+lis $3	;tab
+sltu $14, $18, $16
+mfhi $16
+bne $22, $29, L42
+.word 0xd4881f67
+
+mfhi $27
+; comment only
+bne $26, $29, L20
+.word L1
+lw $19, 45($10)
+beq $9, $8, L41 ; fwd
+L57: 
+bne $10, $17, L4
+; comment only
+.word L54
+beq $11, $30, L2
+lis $23
+bne $21, $7, L24
+L58: lw $3, 0xd676($20)
+lis $3
+lw $12, -76($14)
+lw $10, 0x134d($27)
+.word L32
+; comment only
+jr $4
+mflo $8
+add $10, $31, $23
+beq $15, $13, L41
+
+
+beq $1, $13, L80 ; fwd
+; comment only
+L59: add $23, $31, $22
+L60: sltu $20, $19, $20
+
+L61: bne $4, $16, L41
+L62: div $14, $20
+sw $31, 6($18)
+lw $7, 10($17)
+beq $31, $18, L155 ; fwd
+div $9, $22
+L63: beq $25, $28, L61
+mfhi $15
+L64: sub $30, $30, $20
+divu $25, $0
+lis $3	;tab
+lis $3	;tab
+
+add $23, $22, $28
+beq $19, $5, L113 ; fwd
+beq $10, $8, L5
+
+divu $30, $0
+
+L65: beq $10, $13, L102 ; fwd
+slt $16, $8, $10
+div $14, $27
+; comment only
+div $13, $18
+beq $0, $21, L30 ; fwd
+lis $3	;tab
+lis $3	;tab
+.word L56
+mfhi $5
+sltu $24, $8, $28
+.word ext3
+add $12, $28, $31
+beq $17, $11, L7
+sltu $14, $28, $20
+lis $3	;tab
+L66: add $29, $17, $26
+; comment only
+L67: .word 3982325273
+multu $14, $13
+beq $9, $6, L178 ; fwd
+L68: add $29, $9, $23
+sw $0, 0x7cb3($19)
+sw $20, 92($6)
+.word L58
+L69: sltu $20, $20, $31
+; comment only
+bne $29, $20, L50
+mflo $15
+
+add $20, $3, $21
+add $22, $23, $23
+beq $26, $13, L201 ; fwd
+lw $20, 0xfed6($11)
+L70: beq $22, $14, L59 ; fwd
+L71: 
+lis $6
+beq $26, $9, L22
+divu $27, $20
+beq $17, $13, L49 ; fwd
+; comment only
+mult $28, $8
+bne $8, $1, L22
+lis $3	;tab
+.word L11
+L72: .word L18
+lis $3	;tab
+L73: lis $3	;tab
+slt $30, $1, $29
+lis $3	;tab
+lis $3	;tab
+add $19, $2, $17
+mfhi $6
+slt $21, $6, $28
+
+beq $30, $17, L36 ; fwd
+beq $22, $24, L105 ; fwd
+; comment only
+mfhi $9
+add $15, $25, $29
+.word L12
+L74: ; comment only
+L75: .word 0xbf5b44e7
+L76: ; comment only
+add $22, $7, $15
+slt $9, $1, $23
+L77: lw $30, 0x6da($4)
+
+.word L77
+divu $26, $15
+; comment only
+lis $3	;tab
+sub $13, $23, $6
+L78: sub $7, $5, $0
+mfhi $19
+add $27, $19, $25
+beq $1, $17, L232 ; fwd
+.word L34
+bne $28, $3, L22
+.word L37
+div $25, $26
+; comment only
+.word L39
+L79: divu $7, $23
+sw $8, -73($29)
+.word L72
+; comment only
+lis $3	;tab
+; comment only
+lw $29, 0x310($1)
+sub $20, $28, $5
+; comment only
+beq $2, $12, L43 ; fwd
+L80: sub $7, $19, $12
+multu $13, $5
+lis $3	;tab
+.word 3293467686
+L81: 
+add $27, $18, $30
+sub $13, $2, $27
+.word 3671264157
+mfhi $23
+L82: .word L27
+divu $6, $30
+
+L83: sw $18, -47($24)
+.word 4110547168
+.word L37
+.word 3010358097
+
+L84: .word L82
+beq $27, $25, L141 ; fwd
+add $25, $9, $27
+L85: sw $27, 63($17)
+.word 3282985291
+; comment only
+beq $1, $6, L197 ; fwd
+lw $18, -65($26)
+.word 0xf872d5c5
+jalr $1
+add $26, $5, $15
+.word L37
+beq $4, $4, L39
+sltu $30, $22, $20
+div $15, $20
+mflo $19
+sw $19, 0x13a($16)
+mflo $15
+slt $25, $12, $8
+; comment only
+
+L86: .word -1241135667
+sltu $19, $14, $18
+beq $28, $21, L21 ; fwd
+L87: mfhi $29
+; comment only
+
+.word L69
+L88: add $15, $19, $13
+sw $16, 0x4402($3)
+L89: add $28, $2, $13
+L90: .word L14
+sub $1, $12, $8
+beq $1, $28, L186 ; fwd
+L91: jr $11
+add $14, $8, $4
+L92: div $5, $16
+add $17, $22, $16
+.word 0x8884dcee
+L93: .word L50
+L94: 
+add $3, $20, $9
+.word 2322953465
+L95: .word 197235593
+sw $19, 0x5db($12)
+lis $3	;tab
+multu $5, $13
+add $25, $18, $0
+sub $27, $30, $11
+jalr $29
+sltu $25, $14, $4
+L96: ; comment only
+; comment only
+.word 0x716d389a
+
+
+div $4, $1
+
+.word L80
+jr $22
+beq $17, $21, L21
+sw $15, 0xbff8($1)
+lw $18, -34($20)
+beq $11, $14, L75 ; fwd
+divu $23, $25
+.word L85
+sltu $31, $5, $2
+L97: lw $17, 0x2d23($21)
+L98: beq $14, $22, L91
+L99: .word L25
+multu $5, $25
+L100: beq $29, $10, L54
+sw $12, 0x9af0($26)
+.word -979816226
+lis $3	;tab
+divu $10, $11
+.word 0xb52774fb
+lw $22, 38($16)
+L101: beq $4, $16, L181 ; fwd
+div $16, $31
+L102: .word L28
+.word 0x11730f21
+beq $29, $1, L14 ; fwd
+; comment only
+lis $3	;tab
+bne $7, $21, L48
+.word 0xb9c6cd6e
+.word 4019364955
+bne $24, $4, L101
+
+multu $7, $13
+lis $3	;tab
+
+beq $10, $13, L76 ; fwd
+lis $3	;tab
+L103: .word -318934189
+L104: mflo $13
+.word L75
+
+.word L10
+add $8, $30, $11
+L105: sub $11, $17, $12
+.word 0xae6be8c8
+lis $3	;tab
+mfhi $20
+L106: 
+L107: lis $3	;tab
+add $18, $22, $1
+.word L74
+L108: ; comment only
+lis $3	;tab
+lis $3	;tab
+lis $3	;tab
+L109: beq $28, $6, L108 ; fwd
+sltu $1, $0, $26
+beq $25, $2, L103
+lis $3	;tab
+beq $10, $30, L185 ; fwd
+
+beq $2, $25, L138 ; fwd
+.word 0x52f14880
+; comment only
+beq $8, $5, L154 ; fwd
+
+.word 0x4a695073
+slt $0, $7, $6
+divu $15, $15
+L110: sub $6, $2, $7
+L111: .word 2776877484
+.word 1380144130
+
+; comment only
+
+beq $3, $0, L12
+add $3, $17, $19
+
+sw $24, -70($19)
+mult $23, $28
+L112: .word 0x1d249fb5
+lis $9
+
+L113: lis $3	;tab
+beq $26, $21, L79
+lw $18, 0x83e1($12)
+mflo $24
+add $31, $8, $27
+sltu $17, $6, $14
+L114: .word -1536710845
+sw $20, 0xbf37($9)
+L115: sw $1, -13($12)
+mfhi $27
+lis $3	;tab
+mfhi $0
+bne $26, $21, L88
+.word 3332289066
+bne $1, $6, L6
+jalr $28
+.word 0x12b3adb
+
+.word L63
+L116: beq $10, $31, L55 ; fwd
+; comment only
+sw $8, 0xd2be($30)
+L117: bne $13, $17, L64
+
+sw $10, 0x435c($9)
+beq $28, $31, L184 ; fwd
+.word 0x9534e4ce
+L118: lis $3	;tab
+.word 1267822690
+
+.word 0x156b7e23
+L119: .word L21
+lis $3	;tab
+beq $13, $27, L74 ; fwd
+add $2, $31, $24
+; comment only
+beq $7, $24, L73 ; fwd
+add $14, $21, $26
+.word L26
+beq $5, $21, L203 ; fwd
+beq $11, $15, L132 ; fwd
+.word L102
+beq $25, $13, L65 ; fwd
+lw $16, 99($16)
+lis $3	;tab
+slt $3, $30, $11
+; comment only
+add $25, $0, $19
+L120: .word -687691913
+L121: lis $3	;tab
+beq $24, $1, L56 ; fwd
+beq $1, $0, L135 ; fwd
+
+mult $25, $26
+mfhi $28
+bne $12, $16, L85
+lw $17, 0x9411($14)
+jalr $1
+L122: lw $20, -44($14)
+lw $16, -4($9)
+.word 0xd9e3f8a9
+beq $18, $17, L79
+
+.word 0x429d52a8
+lw $17, -14($31)
+.word 3966997367
+L123: lis $3	;tab
+bne $27, $24, L111
+.word 0xb0053e78
+multu $6, $22
+.word L48
+.word L122
+; comment only
+mflo $7
+; comment only
+L124: bne $13, $3, L86
+L125: sltu $10, $26, $17
+mult $12, $10
+jr $31
+slt $15, $13, $4
+mflo $9
+sltu $23, $5, $22
+divu $27, $14
+; comment only
+.word 0x5e233373
+.word 3575829325
+
+beq $29, $23, L90 ; fwd
+jalr $30
+
+
+sltu $5, $14, $27
+beq $19, $31, L183 ; fwd
+L126: mfhi $19
+
+add $29, $20, $26
+sub $3, $24, $10
+add $31, $31, $23
+.word 0xaa84e1a2
+; comment only
+; comment only
+beq $12, $20, L9 ; fwd
+divu $11, $28
+L127: sw $5, 31($24)
+beq $2, $26, L123
+multu $12, $21
+sw $15, 94($18)
+L128: 
+add $20, $5, $11
+slt $8, $2, $8
+beq $22, $28, L191 ; fwd
+.word 0xcdb7c116
+lw $22, -5($6)
+.word 3464721468
+beq $2, $3, L46
+beq $17, $17, L63
+add $8, $26, $22
+.word L98
+L129: lis $3	;tab
+mflo $27
+add $0, $9, $30
+div $4, $15
+; comment only
+divu $8, $21
+mult $8, $2
+sw $0, -63($4)
+lis $3	;tab
+.word 0x2238872a
+.word L74
+div $0, $19
+add $31, $3, $0
+L130: .word L62
+L131: .word 1953410118
+mult $21, $22
+L132: ; comment only
+bne $5, $27, L42
+slt $11, $31, $5
+.word 0xa2474cdb
+bne $27, $4, L105
+lis $3	;tab
+lis $3	;tab
+L133: beq $14, $19, L35
+lis $3	;tab
+add $10, $19, $3
+slt $7, $11, $28
+jr $27
+L134: .word L128
+.word 1729660266
+lis $3	;tab
+.word -56765201
+mfhi $22
+lis $3	;tab
+beq $26, $26, L42 ; fwd
+add $14, $3, $9
+sub $9, $17, $14
+lis $3	;tab
+L135: sw $22, 52($3)
+.word L80
+sw $19, 0x7b83($7)
+beq $0, $6, L108 ; fwd
+L136: sltu $0, $15, $30
+lis $13
+sw $29, 78($29)
+lis $3	;tab
+L137: sw $13, 0x4b96($11)
+beq $25, $24, L216 ; fwd
+.word L63
+add $18, $17, $30
+beq $7, $13, L99
+add $11, $24, $27
+mult $10, $2
+jalr $29
+sw $30, 0x561($27)
+beq $22, $27, L182 ; fwd
+lis $13
+
+sw $18, 0xde37($4)
+L138: bne $18, $14, L81
+div $15, $26
+beq $27, $25, L57 ; fwd
+L139: sub $29, $24, $14
+.word 0x2659d491
+beq $19, $26, L141 ; fwd
+L140: lis $3	;tab
+sub $31, $27, $7
+bne $19, $2, L115
+L141: lw $16, 91($18)
+beq $2, $8, L82
+.word L74
+L142: lw $1, 0x8a0f($1)
+; comment only
+.word 0x91cacc83
+L143: lis $2
+.word L81
+add $8, $30, $30
+beq $6, $26, L115 ; fwd
+lw $3, 0x2765($12)
+L144: beq $21, $6, L81
+div $5, $13
+lw $31, 0x7614($24)
+beq $30, $11, L214 ; fwd
+mult $11, $19
+beq $9, $13, L219 ; fwd
+lis $3	;tab
+.word L21
+; comment only
+.word 0x6fa7c7d3
+beq $12, $24, L9 ; fwd
+lw $28, 0x27b6($28)
+beq $3, $22, L181 ; fwd
+div $31, $21
+
+lis $3	;tab
+beq $25, $4, L18 ; fwd
+L145: add $4, $5, $8
+add $13, $27, $21
+beq $22, $12, L211 ; fwd
+divu $5, $22
+L146: .word L128
+add $3, $9, $26
+
+mfhi $10
+; comment only
+L147: lis $3	;tab
+
+lw $28, 0xb3b($10)
+add $20, $1, $9
+lis $31
+sub $18, $1, $15
+beq $11, $15, L151 ; fwd
+sub $12, $23, $10
+sub $19, $14, $24
+lw $19, -65($19)
+jr $25
+sub $25, $30, $0
+lis $3	;tab
+beq $13, $30, L51
+; comment only
+divu $12, $23
+add $15, $7, $23
+L148: add $13, $27, $21
+.word L117
+
+beq $28, $23, L10 ; fwd
+beq $16, $8, L211 ; fwd
+lis $3	;tab
+L149: .word 1453156477
+beq $14, $12, L240 ; fwd
+.word -1310209895
+beq $15, $17, L78 ; fwd
+beq $7, $0, L89 ; fwd
+divu $31, $29
+beq $7, $14, L153 ; fwd
+sub $10, $12, $27
+L150: .word 3869266490
+; comment only
+
+lis $3	;tab
+bne $0, $7, L69
+L151: ; comment only
+add $31, $20, $27
+
+; comment only
+; comment only
+L152: lw $20, -49($10)
+
+lis $3	;tab
+L153: lw $17, 46($29)
+add $9, $19, $8
+L154: add $29, $31, $2
+lis $3	;tab
+sw $29, 0xa7a1($26)
+L155: lw $18, -34($8)
+lis $6
+lis $3	;tab
+mult $31, $4
+beq $9, $29, L103 ; fwd
+beq $18, $31, L249 ; fwd
+; comment only
+L156: beq $5, $13, L155 ; fwd
+lis $3	;tab
+; comment only
+L157: multu $27, $2
+L158: beq $19, $16, L185 ; fwd
+sw $25, 0x7033($20)
+
+multu $30, $16
+lis $3	;tab
+
+add $18, $31, $22
+.word L121
+multu $21, $4
+
+beq $26, $26, L56
+beq $30, $22, L20 ; fwd
+.word L117
+.word 0x87bbfdce
+L159: lis $3	;tab
+slt $9, $30, $28
+; comment only
+.word L15
+.word 0xbd8077c8
+.word 0x9355471b
+lis $27
+.word L71
+L160: beq $18, $13, L27
+lis $3	;tab
+sw $7, 0xe657($18)
+beq $31, $3, L113
+add $29, $15, $8
+jr $10
+beq $13, $3, L70
+.word L120
+.word 0xf13a94ee
+beq $24, $31, L51
+L161: sw $31, 0x5190($5)
+lw $8, 6($24)
+L162: lis $3	;tab
+mult $7, $6
+L163: beq $23, $26, L19
+beq $28, $19, L190 ; fwd
+.word L159
+divu $30, $24
+bne $9, $16, L24
+mult $0, $20
+divu $28, $1
+
+beq $25, $3, L7 ; fwd
+L164: ; comment only
+.word 1906065857
+multu $9, $15
+mfhi $13
+.word L120
+; comment only
+L165: .word 0xb5ebd4f9
+add $20, $6, $15
+divu $23, $16
+lis $3	;tab
+lis $3	;tab
+sltu $22, $25, $28
+beq $28, $31, L96 ; fwd
+add $31, $20, $14
+L166: beq $11, $30, L37
+lis $3	;tab
+div $30, $23
+add $18, $28, $29
+mfhi $19
+mflo $11
+lw $25, 0xcc09($11)
+.word 775655096
+; comment only
+divu $8, $18
+div $21, $16
+multu $16, $13
+add $3, $2, $29
+; comment only
+beq $7, $4, L154 ; fwd
+L167: mflo $1
+divu $20, $3
+; comment only
+lw $3, 0x1d1a($31)
+beq $19, $9, L107
+add $0, $23, $11
+L168: mult $2, $1
+add $18, $30, $31
+sub $11, $22, $5
+div $12, $29
+beq $15, $14, L22
+; comment only
+sltu $23, $15, $18
+beq $19, $7, L230 ; fwd
+.word -1238012656
+.word 0x4d2c6ae0
+sub $23, $29, $30
+.word 1661833374
+beq $2, $25, L27
+lis $30
+
+L169: lis $3	;tab
+.word L130
+sw $9, 0x1e6d($14)
+mfhi $26
+mult $24, $1
+.word 3632279194
+jr $30
+lis $3	;tab
+; comment only
+add $16, $1, $24
+.word -1526163858
+lis $3	;tab
+add $31, $5, $5
+bne $21, $22, L64
+.word 2737513587
+
+L170: beq $6, $13, L131
+; comment only
+bne $27, $14, L97
+L171: .word L91
+beq $29, $26, L67
+L172: .word L67
+lis $3	;tab
+; comment only
+lis $29
+.word L2
+L173: lis $3	;tab
+lis $3	;tab
+L174: sw $14, 0x2f36($22)
+lis $3	;tab
+L175: beq $11, $24, L136 ; fwd
+beq $26, $19, L130 ; fwd
+sub $6, $17, $19
+jr $12
+slt $25, $18, $18
+.word L105
+jr $7
+beq $2, $5, L113
+L176: add $28, $8, $5
+sub $9, $31, $8
+.word -89075538
+; comment only
+
+jalr $9
+.word 0xc7531b1c
+.word 0x106623d1
+add $6, $19, $14
+.word 2203851322
+slt $28, $19, $2
+L177: .word L94
+L178: sub $17, $0, $31
+
+div $25, $28
+
+
+bne $5, $1, L57
+beq $22, $27, L142 ; fwd
+sub $1, $14, $21
+jalr $10
+; comment only
+sw $21, 0x6c79($13)
+L179: 
+multu $24, $0
+sw $13, 4($15)
+beq $12, $26, L146 ; fwd
+mult $13, $6
+L180: divu $23, $11
+beq $10, $10, L228 ; fwd
+divu $5, $28
+sw $22, 13($14)
+lw $27, 0xb692($15)
+.word L51
+beq $20, $2, L59 ; fwd
+divu $7, $4
+.word 54058154
+add $25, $13, $13
+lis $3	;tab
+
+
+beq $24, $18, L94
+divu $15, $12
+L181: mfhi $16
+lis $3	;tab
+beq $16, $2, L239 ; fwd
+.word 1812679969
+mflo $9
+beq $18, $28, L108 ; fwd
+bne $16, $14, L84
+L182: mfhi $8
+divu $25, $16
+.word 3503713652
+.word 0x8d479e23
+sub $24, $7, $24
+
+jr $30
+mult $22, $3
+.word L127
+lis $3	;tab
+add $21, $12, $30
+divu $26, $3
+add $19, $26, $4
+add $24, $18, $9
+div $14, $19
+.word L54
+lis $3	;tab
+L183: 
+bne $2, $25, L126
+lw $2, 0x7b66($22)
+
+; comment only
+; comment only
+L184: .word 0x3d6a4fd9
+.word L161
+add $31, $31, $8
+L185: .word 0x60b37275
+lis $3	;tab
+L186: beq $30, $21, L92 ; fwd
+sub $20, $10, $8
+L187: .word L156
+lis $3	;tab
+L188: add $0, $30, $29
+.word -1104326685
+mfhi $6
+beq $18, $31, L193 ; fwd
+lw $29, 0x47f9($19)
+; comment only
+add $19, $12, $16
+lis $3	;tab
+; comment only
+add $20, $29, $7
+L189: bne $2, $8, L166
+bne $25, $11, L119
+multu $30, $10
+; comment only
+lw $29, 0x96d4($31)
+lis $3	;tab
+L190: ; comment only
+.word L153
+mfhi $19
+beq $29, $16, L145 ; fwd
+bne $2, $11, L127
+beq $23, $16, L185 ; fwd
+mfhi $16
+; comment only
+sw $30, 80($5)
+; comment only
+; comment only
+
+bne $4, $14, L43
+L191: lis $3	;tab
+
+beq $12, $29, L170 ; fwd
+mult $12, $3
+L192: .word 1220642700
+mult $27, $2
+.word 0x99d2012c
+sltu $20, $31, $0
+.word 0x6041399a
+jr $31
+beq $3, $26, L150
+lis $3	;tab
+L193: mflo $31
+beq $23, $23, L20
+.word 0x243977eb
+add $5, $8, $8
+mflo $28
+beq $19, $11, L146
+beq $7, $2, L191 ; fwd
+L194: beq $18, $13, L14 ; fwd
+
+; comment only
+lis $3	;tab
+sw $28, 19($21)
+L195: lw $2, -40($11)
+.word 1674093396
+jr $9
+lis $3	;tab
+slt $28, $22, $1
+.word L15
+lw $30, 0xbfc8($5)
+sw $8, 39($20)
+L196: ; comment only
+multu $1, $0
+L197: ; comment only
+.word L175
+beq $4, $29, L116 ; fwd
+beq $1, $17, L91 ; fwd
+beq $11, $11, L1
+jalr $14
+.word L89
+beq $31, $6, L184 ; fwd
+; comment only
+; comment only
+slt $5, $7, $20
+
+sw $18, 0x819c($29)
+sw $4, 0xfcf3($2)
+.word 0xb79b819d
+
+mflo $24
+slt $8, $16, $2
+lis $5
+.word 0x7c74334f
+sltu $29, $2, $27
+
+lw $8, -4($1)
+add $28, $0, $22
+.word L47
+jr $13
+.word 0x715fd11d
+beq $5, $4, L135 ; fwd
+
+mfhi $31
+L198: ; comment only
+sltu $20, $24, $14
+.word L28
+slt $16, $19, $1
+beq $24, $15, L110 ; fwd
+
+.word L104
+; comment only
+sltu $7, $24, $7
+.word 0x581ce44a
+.word L191
+beq $10, $25, L10 ; fwd
+beq $25, $24, L115 ; fwd
+L199: beq $15, $8, L18 ; fwd
+mfhi $29
+beq $25, $27, L6 ; fwd
+add $2, $31, $26
+L200: 
+jalr $24
+sltu $2, $26, $9
+div $2, $19
+add $20, $18, $2
+divu $31, $16
+add $26, $2, $18
+add $22, $12, $21
+mult $2, $6
+sw $31, 0x92d8($1)
+; comment only
+lis $3	;tab
+; comment only
+slt $24, $14, $0
+
+bne $24, $13, L45
+L201: sltu $19, $11, $22
+; comment only
+
+beq $15, $16, L18 ; fwd
+; comment only
+beq $14, $16, L198 ; fwd
+beq $8, $3, L118 ; fwd
+
+lis $3	;tab
+L202: .word L191
+L203: ; comment only
+beq $31, $20, L78 ; fwd
+bne $5, $27, L179
+beq $4, $23, L169
+lw $22, 0x333($6)
+add $11, $29, $6
+sltu $8, $25, $11
+
+L204: sw $11, -5($7)
+sltu $25, $10, $11
+lw $3, 54($13)
+L205: beq $28, $12, L157 ; fwd
+div $23, $24
+L206: 
+beq $27, $28, L42
+L207: sw $14, -79($8)
+jalr $23
+add $12, $28, $2
+divu $8, $31
+mflo $3
+; comment only
+.word -1090632370
+L208: add $21, $19, $11
+.word 0x3f6f67e6
+jr $6
+lis $3	;tab
+.word 0x8d36682d
+L209: beq $12, $11, L162 ; fwd
+lis $3	;tab
+add $4, $24, $1
+; comment only
+beq $13, $30, L143 ; fwd
+L210: add $24, $25, $25
+L211: add $18, $22, $14
+.word L120
+; comment only
+bne $27, $15, L40
+sw $23, 0xa85f($27)
+.word L57
+L212: ; comment only
+
+add $6, $5, $25
+.word 0xae15acd1
+.word 1339812983
+sw $5, -59($3)
+beq $11, $18, L59
+beq $0, $26, L73 ; fwd
+
+L213: beq $7, $21, L51
+lis $3	;tab
+lis $3	;tab
+mflo $21
+mflo $27
+L214: 
+lis $3	;tab
+add $19, $24, $24
+bne $8, $16, L112
+.word L98
+.word L142
+sw $18, 0xc8fe($12)
+lis $3	;tab
+L215: 
+; comment only
+slt $13, $16, $15
+L216: 
+beq $28, $16, L14
+add $15, $2, $22
+sub $11, $12, $12
+beq $2, $0, L173 ; fwd
+beq $3, $15, L133 ; fwd
+mfhi $20
+add $24, $19, $22
+L217: .word L98
+.word L185
+.word 2409471679
+L218: divu $12, $24
+
+multu $3, $10
+lis $3	;tab
+lis $3	;tab
+L219: add $25, $4, $25
+L220: multu $25, $21
+beq $24, $20, L8 ; fwd
+lis $22
+beq $27, $19, L111 ; fwd
+; comment only
+lis $3	;tab
+; comment only
+beq $0, $0, L111 ; fwd
+jr $6
+L221: div $29, $11
+
+lis $3	;tab
+sw $7, 65($30)
+L222: ; comment only
+; comment only
+slt $17, $3, $20
+div $29, $3
+L223: ; comment only
+
+L224: beq $5, $27, L110 ; fwd
+slt $22, $10, $31
+beq $26, $18, L192 ; fwd
+mflo $12
+L225: lw $28, 14($13)
+; comment only
+sub $5, $10, $10
+jr $16
+beq $9, $14, L239 ; fwd
+lis $3	;tab
+add $14, $10, $18
+L226: jalr $1
+add $2, $11, $1
+.word L161
+L227: bne $14, $31, L142
+sltu $18, $1, $18
+add $18, $3, $5
+sltu $28, $17, $2
+L228: sw $22, 0xc495($31)
+sub $26, $24, $30
+
+.word 0xa1f915f8
+jalr $8
+L229: divu $22, $22
+beq $6, $16, L218 ; fwd
+bne $1, $16, L67
+lis $3	;tab
+lis $3	;tab
+sw $9, 0xd3f0($24)
+jalr $11
+sub $6, $12, $14
+L230: lis $3	;tab
+lis $3	;tab
+.word L55
+
+lis $3	;tab
+add $12, $22, $4
+
+bne $18, $10, L79
+beq $14, $7, L96
+L231: sw $22, -87($5)
+bne $15, $19, L73
+; comment only
+mult $9, $14
+.word 0xa4158d73
+add $29, $26, $0
+slt $11, $4, $7
+.word L169
+div $6, $8
+.word L140
+add $3, $7, $11
+beq $5, $25, L15 ; fwd
+mult $19, $0
+.word L157
+lis $3	;tab
+lis $3	;tab
+L232: 
+
+multu $22, $3
+lis $3	;tab
+beq $31, $28, L23 ; fwd
+L233: lis $3	;tab
+divu $17, $3
+L234: ; comment only
+L235: jalr $18
+
+add $6, $30, $9
+lw $5, 73($14)
+
+beq $4, $17, L215
+lis $3	;tab
+bne $10, $0, L42
+
+bne $31, $30, L104
+L236: sub $14, $20, $13
+L237: 
+lis $3	;tab
+L238: beq $26, $24, L13
+lis $3	;tab
+sw $4, -74($22)
+multu $26, $30
+mfhi $10
+beq $11, $5, L247 ; fwd
+lis $3	;tab
+
+L239: jr $16
+L240: .word 1863093562
+sub $13, $13, $1
+beq $31, $28, L84 ; fwd
+jr $5
+bne $5, $29, L142
+lis $22
+add $12, $15, $27
+beq $28, $29, L230 ; fwd
+lis $3	;tab
+lis $3	;tab
+add $13, $21, $4
+lis $3	;tab
+mfhi $19
+L241: lw $27, -8($19)
+L242: .word L61
+; comment only
+L243: lis $5
+.word 0x57908b29
+beq $8, $19, L215
+L244: .word L101
+mult $5, $31
+beq $3, $25, L39 ; fwd
+lis $3	;tab
+mult $25, $12
+bne $11, $26, L70
+lis $3	;tab
+
+lis $3	;tab
+; comment only
+lw $13, 95($17)
+L245: beq $5, $3, L163 ; fwd
+.word L124
+.word 0xae51331d
+sw $2, -61($13)
+multu $8, $1
+add $25, $23, $23
+div $20, $21
+bne $10, $5, L6
+sub $24, $26, $7
+.word 2336107025
+L246: add $18, $26, $4
+
+
+lw $13, 0x2919($3)
+.word 835265653
+add $9, $14, $0
+; comment only
+
+jalr $27
+.word L85
+beq $13, $15, L21 ; fwd
+mflo $19
+L247: lis $3	;tab
+lis $3	;tab
+L248: sw $15, -64($27)
+L249: ; comment only
+; comment only
+mult $2, $17
+add $30, $26, $12
+
+slt $21, $16, $10
+lis $3	;tab
+
+sw $31, 0x52fb($7)
+add $4, $4, $19
+
+.word 608236210
+lis $3	;tab
+divu $26, $14
+; comment only
+sw $21, 67($2)
+sltu $6, $28, $7
+lis $3	;tab
+.word L70
+slt $24, $7, $10
+; comment only
+lis $3	;tab
+; comment only
+.word L220
+slt $21, $7, $20
+sub $15, $31, $15
+.word L11
+mult $0, $27
+beq $21, $19, L141 ; fwd
+
+lis $3	;tab
+lis $9
+beq $4, $12, L199 ; fwd
+add $11, $22, $27
+beq $16, $13, L41 ; fwd
+jr $11
+multu $29, $9
+
+
+
+sw $10, 0xf427($18)
+mflo $10
+lw $9, 0x694($3)
+bne $9, $27, L40
+; comment only
+beq $4, $16, L12
+; comment only
+lw $30, 0xd45($26)
+
+sub $0, $2, $1
+add $13, $23, $13
+.word L180
+add $14, $19, $12
+; comment only
+multu $12, $23
+; comment only
+mflo $6
+beq $29, $31, L122
+sub $29, $20, $22
+bne $9, $7, L224
+beq $20, $10, L165 ; fwd
+slt $1, $28, $0
+beq $8, $18, L202 ; fwd
+sw $3, 21($9)
+add $31, $26, $2
+mfhi $24
+beq $1, $19, L243 ; fwd
+add $1, $15, $24
+sw $0, 0x9d97($13)
+lis $3	;tab
+.word L196
+add $8, $17, $2
+slt $6, $3, $31
+
+.word L28
+lis $3	;tab
+.word L46
+add $6, $29, $4
+div $29, $10
+lis $3	;tab
+.word L65
+lis $3	;tab
+sw $11, 69($11)
+mfhi $24
+sub $18, $6, $16
+beq $14, $11, L195 ; fwd
+beq $23, $6, L115 ; fwd
+slt $4, $28, $27
+sltu $7, $29, $30
+sw $29, 0x6101($6)
+.word 3581014947
+.word L222
+add $5, $24, $21
+add $1, $0, $28
+lis $3	;tab
+; comment only
+divu $19, $26
+sltu $13, $27, $20
+.word L165
+.word 2280060320
+.word 2812776579
+.word L87
+lis $3	;tab
+lis $3	;tab
+; comment only
+beq $6, $10, L152 ; fwd
+lis $3	;tab
+beq $31, $1, L239 ; fwd
+lw $6, -32($26)
+sw $18, -18($13)
+
+
+; comment only
+sltu $10, $16, $7
+mfhi $8
+; comment only
+beq $29, $7, L138 ; fwd
+; comment only
+mflo $26
+.word 0xcc2510a0
+lis $3	;tab
+multu $23, $15
+beq $2, $26, L217 ; fwd
+beq $10, $20, L150 ; fwd
+mflo $30
+sw $30, -43($4)
+
+jr $8
+.word -1425505977
+
+.word L185
+add $31, $16, $18
+sw $30, -70($19)
+beq $24, $27, L241 ; fwd
+mflo $9
+sltu $18, $13, $6
+bne $8, $14, L40
+lis $3	;tab
+sub $12, $19, $15
+beq $4, $2, L240 ; fwd
+bne $13, $23, L180
+slt $29, $21, $18
+beq $5, $8, L236
+add $15, $13, $27
+lw $6, -4($12)
+sub $10, $20, $13
+lis $3	;tab
+beq $16, $22, L81
+add $29, $12, $7
+.word L99
+.word 0x56d9fc4b
+.word L186
+add $29, $22, $30
+beq $28, $25, L178
+
+beq $30, $31, L181 ; fwd
+beq $18, $3, L128 ; fwd
+.word L23
+beq $19, $10, L115 ; fwd
+lis $10
+; comment only
+sw $0, 0x909b($0)
+sw $16, 0xe896($2)
+
+; comment only
+lis $3	;tab
+add $12, $30, $13
+.word 0x8311e7e9
+
+divu $25, $31
+; comment only
+mflo $26
+
+.word L183
+.word 0xb0bab062
+mfhi $2
+.word L13
+beq $11, $20, L10 ; fwd
+beq $16, $13, L48 ; fwd
+.word 0x92e4148f
+add $9, $0, $3
+
+; comment only
+mflo $20
+multu $25, $0
+add $21, $1, $13
+sltu $30, $29, $4
+div $1, $26
+lw $11, 0x1926($19)
+jalr $7
+add $17, $13, $13
+jalr $12
+.word L102
+
+.word L95
+slt $16, $30, $3
+add $21, $30, $0
+jalr $8
+add $25, $6, $14
+add $19, $23, $6
+slt $17, $9, $15
+; comment only
+lis $3	;tab
+
+divu $3, $26
+.word L3
+bne $19, $31, L112
+bne $1, $10, L61
+sub $20, $25, $19
+; comment only
+bne $31, $9, L106
+mfhi $5
+mult $1, $5
+.word L211
+
+sub $22, $11, $11
+lis $3	;tab
+.word 0xae6308
+.word 998403917
+
+jr $20
+jalr $6
+sw $13, 0xaf9a($9)
+lw $10, 0xb239($12)
+add $25, $22, $30
+; comment only
+.word 3098083099
+divu $13, $31
+sw $7, 29($22)
+multu $27, $19
+.word 0x3ecd2e49
+add $2, $12, $23
+.word 0x68e8384e
+lis $3	;tab
+.word 0xb215b99e
+lis $3	;tab
+beq $23, $23, L128 ; fwd
+.word 0xc200d2c8
+add $13, $22, $11
+; comment only
+
+lis $3	;tab
+sw $11, 0x5e5b($1)
+multu $22, $30
+beq $28, $12, L31 ; fwd
+beq $27, $14, L107
+lw $12, 15($0)
+; comment only
+
+mflo $2
+
+.word L52
+mfhi $1
+lis $3	;tab
+sw $6, 0x5ee3($27)
+beq $19, $5, L40
+
+
+
+jalr $18
+
+beq $30, $18, L174 ; fwd
+lw $16, -59($27)
+lis $3	;tab
+sw $25, -41($26)
+div $15, $13
+div $4, $4
+lis $3	;tab
+mfhi $19
+add $8, $25, $25
+beq $3, $7, L154 ; fwd
+add $8, $29, $25
+lw $10, 20($16)
+; comment only
+.word 1317722274
+beq $8, $2, L33 ; fwd
+beq $9, $0, L132 ; fwd
+lw $2, 0xdfbc($11)
+lis $11
+lis $3	;tab
+mflo $31
+beq $15, $8, L53 ; fwd
+add $21, $15, $25
+.word L218
+lis $3	;tab
+mult $2, $5
+add $18, $31, $3
+sltu $19, $23, $22
+mflo $16
+mflo $21
+sw $23, -91($11)
+.word 0x32aabc6
+.word 0xaff39ce4
+
+
+add $16, $4, $3
+.word 3895020582
+lw $5, 0x790($2)
+.word L103
+jalr $30
+lw $13, -43($21)
+lis $21
+add $24, $18, $1
+beq $29, $1, L246 ; fwd
+.word -2079611209
+add $25, $28, $9
+sub $12, $26, $22
+beq $14, $12, L154
+sw $20, 0x4384($22)
+beq $14, $4, L116 ; fwd
+lis $0
+; comment only
+
+beq $22, $19, L50
+beq $22, $20, L228 ; fwd
+; comment only
+; comment only
+sw $5, 0x30cb($12)
+lis $30
+.word L212
+add $19, $8, $24
+slt $8, $20, $20
+.word 0x907b9040
+mflo $24
+lis $3	;tab
+
+beq $19, $29, L216
+lis $3	;tab
+beq $9, $30, L209
+add $2, $25, $27
+lis $3	;tab
+sub $27, $23, $27
+.word L108
+slt $11, $13, $11
+sltu $27, $23, $14
+divu $22, $23
+multu $14, $16
+; comment only
+mfhi $5
+jalr $27
+.word L82
+mfhi $27
+slt $11, $30, $15
+beq $18, $10, L197
+lis $3	;tab
+sltu $1, $6, $16
+; comment only
+lw $18, 0xe7bc($14)
+lis $3	;tab
+add $26, $4, $21
+.word L115
+; comment only
+beq $14, $27, L70 ; fwd
+.word 1423198770
+slt $22, $22, $25
+.word L235
+mflo $9
+mfhi $0
+
+lis $3	;tab
+divu $21, $16
+lw $13, 98($16)
+lis $3	;tab
+mfhi $19
+; comment only
+.word 0x5b4e3fa3
+; comment only
+lis $13
+; comment only
+lis $3	;tab
+beq $8, $25, L210
+lw $1, 82($26)
+beq $29, $29, L75
+; comment only
+.word 0xc02d0449
+.word L5
+div $4, $23
+add $3, $24, $20
+mflo $27
+lis $21
+add $14, $13, $16
+.word 0x787069d2
+
+.word L4
+.word L116
+; comment only
+.word 0x9892e7c6
+multu $29, $22
+
+; comment only
+add $13, $7, $23
+lis $3	;tab
+add $28, $4, $20
+beq $6, $5, L132 ; fwd
+beq $5, $21, L89
+lis $15
+; comment only
+.word 0x3b12639
+.word L249
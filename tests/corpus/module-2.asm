@@ -0,0 +1,2007 @@
+.import ext0
+.import ext1
+.import ext2
+.import ext3
+.import ext4
+.export L0
+add $5, $5, $23
+lis $3	;tab
+sw $13, 55($27)
+lis $3	;tab
+; comment only
+; comment only
+; comment only
+add $1, $23, $29
+.word 3966878886
+L0: beq $8, $23, 0xacaa
+.word ext3
+bne $28, $10, 0x665d
+beq $15, $31, L71 ; fwd
+; comment only
+bne $29, $22, 0xb9d3
+.word ext1
+div $30, $19
+lis $3	;tab
+; comment only
+beq $26, $19, L187 ; fwd
+; comment only
+beq $4, $21, L185 ; fwd
+L1: mfhi $3
+add $17, $14, $6
+div $15, $13
+add $27, $2, $3
+multu $1, $5
+L2: sub $2, $1, $23
+multu $0, $24
+mflo $2
+L3: 
+lis $3	;tab
+L4: bne $1, $19, 0x8d2f
+add $16, $25, $9
+mfhi $20
+add $28, $8, $25
+beq $21, $16, L3
+lis $3	;tab
+mult $16, $2
+L5: mult $29, $14
+lis $3	;tab
+mflo $28
+L6: sltu $14, $23, $16
+lw $9, 0x627f($10)
+L7: lis $3	;tab
+L8: sub $1, $11, $14
+L9: add $29, $29, $19
+.word 0xf68ed036
+add $3, $26, $11
+beq $30, $23, L4 ; fwd
+sltu $23, $18, $23
+beq $26, $6, L26 ; fwd
+beq $1, $28, L15 ; fwd
+.word L3
+
+L10: lw $23, -22($14)
+mfhi $23
+.word L5
+slt $7, $7, $5
+bne $13, $6, L10
+add $31, $18, $22
+div $17, $30
+.word L7
+sw $14, 0x7d21($27)
+lis $3	;tab
+
+
+L11: beq $9, $26, L1
+beq $2, $8, L249 ; fwd
+lis $28
+lw $9, 0xfc97($6)
+jalr $16
+divu $15, $25
+beq $29, $28, 42
+lis $3	;tab
+; comment only
+L12: sw $16, 0xbb33($30)
+; comment only
+lis $3	;tab
+sltu $14, $12, $25
+.word -2097637141
+add $25, $13, $24
+slt $12, $17, $12
+
+L13: 
+.word L8
+.word L12
+L14: add $31, $4, $31
+bne $17, $29, L2
+beq $25, $16, L4
+L15: .word L14
+mult $18, $29
+beq $24, $28, L9
+divu $19, $4
+bne $21, $19, L12
+sltu $13, $25, $9
+beq $5, $19, L10 ; fwd
+.word L7
+add $7, $7, $24
+lis $22
+L16: .word L5
+sw $8, 83($17)
+sub $30, $12, $23
+multu $14, $17
+beq $24, $25, L206 ; fwd
+bne $20, $25, L9
+beq $4, $23, L78 ; fwd
+div $22, $28
+div $24, $8
+slt $10, $22, $4
+lis $3	;tab
+.word 0x52053d31
+.word L11
+.word L4
+bne $9, $26, L2
+mflo $2
+beq $9, $11, L14
+div $7, $21
+lis $3	;tab
+.word 0xddc2c2d
+beq $31, $25, L5
+; comment only
+slt $8, $7, $11
+L17: sw $0, 0x1b20($14)
+divu $5, $21
+beq $29, $3, L219 ; fwd
+mfhi $30
+L18: add $8, $3, $3
+add $21, $15, $8
+add $8, $7, $15
+L19: mfhi $13
+bne $10, $6, L6
+lis $21
+.word 0x1996cb53
+.word L7
+mult $1, $12
+.word 342664991
+lis $3	;tab
+; comment only
+L20: mflo $20
+L21: mfhi $8
+; comment only
+sltu $29, $18, $13
+bne $4, $26, 0xaaf2
+L22: lw $17, 0x36e2($21)
+lis $3	;tab
+; comment only
+jr $8
+.word L11
+
+jalr $30
+.word L10
+div $30, $14
+beq $8, $19, L222 ; fwd
+lw $0, 0x32aa($3)
+sw $28, 0x6b5a($1)
+
+L23: multu $24, $4
+.word L20
+L24: .word L4
+mflo $21
+lis $3	;tab
+.word 3155430205
+L25: 
+.word 0x74ae5dae
+.word -924161652
+sltu $0, $3, $24
+.word 0x45d490e1
+; comment only
+.word L2
+lis $3	;tab
+lw $1, 22($9)
+jalr $3
+beq $18, $6, L164 ; fwd
+sltu $8, $27, $8
+L26: ; comment only
+.word L17
+beq $23, $6, L11
+beq $17, $30, L229 ; fwd
+
+add $2, $21, $27
+add $22, $3, $4
+; comment only
+.word -306602304
+L27: lis $3	;tab
+beq $11, $18, L5 ; fwd
+add $15, $14, $25
+L28: beq $4, $15, L6
+L29: lis $3	;tab
+; comment only
+
+add $25, $27, $8
+divu $23, $3
+
+.word L19
+beq $28, $10, L126 ; fwd
+div $9, $1
+multu $26, $16
+.word L6
+lw $22, 92($25)
+add $27, $19, $1
+; comment only
+sw $15, 0xb64d($23)
+
+beq $15, $10, L117 ; fwd
+bne $7, $15, L24
+L30: 
+; comment only
+lis $3	;tab
+.word 0xbd37088b
+mflo $26
+lis $3	;tab
+divu $16, $20
+.word 3432498252
+sub $0, $23, $20
+lis $3	;tab
+lis $3	;tab
+beq $30, $25, L15
+sltu $1, $22, $1
+mult $0, $21
+beq $0, $30, L163 ; fwd
+mflo $20
+sw $31, 0xc33e($5)
+
+bne $11, $15, L14
+.word L25
+
+mult $25, $30
+beq $11, $12, L186 ; fwd
+divu $0, $8
+lis $3	;tab
+
+L31: beq $12, $11, L69 ; fwd
+add $0, $23, $7
+
+.word -1624779020
+L32: .word L17
+L33: .word L4
+; comment only
+sw $1, 40($4)
+multu $19, $29
+add $21, $29, $3
+jalr $22
+lis $3	;tab
+mflo $14
+L34: slt $6, $23, $4
+lis $3	;tab
+beq $27, $12, L1
+beq $4, $3, L31
+beq $22, $30, L169 ; fwd
+sltu $9, $7, $0
+div $9, $19
+beq $8, $5, L238 ; fwd
+lis $3	;tab
+lis $5
+beq $27, $13, L105 ; fwd
+add $21, $27, $31
+beq $7, $2, L24
+L35: lis $3	;tab
+lw $5, 31($12)
+
+sltu $20, $8, $15
+.word L29
+L36: mfhi $22
+L37: add $7, $16, $22
+bne $14, $2, L8
+divu $9, $6
+.word -156652601
+add $12, $27, $0
+.word 1368303743
+sw $14, 0xf256($19)
+.word L24
+.word 0xce3284e9
+.word L27
+beq $0, $16, L37
+sltu $30, $17, $10
+beq $14, $13, L32
+; comment only
+mult $19, $29
+L38: ; comment only
+L39: beq $14, $2, L2
+; comment only
+mflo $25
+jalr $14
+sw $16, 0x68a($3)
+L40: .word L35
+lw $29, 0x2f2b($3)
+sw $16, 0x80a0($3)
+add $26, $14, $11
+beq $30, $8, L108 ; fwd
+lw $11, 95($26)
+sltu $9, $1, $1
+beq $30, $27, L240 ; fwd
+
+beq $0, $4, L33
+; comment only
+L41: add $18, $16, $7
+L42: 
+L43: bne $6, $24, L42
+divu $0, $15
+divu $2, $17
+L44: 
+mflo $11
+add $10, $7, $12
+sw $5, 65($15)
+bne $11, $13, L18
+L45: jalr $19
+sw $2, 95($30)
+div $18, $27
+.word 1343498385
+L46: sltu $9, $30, $1
+jr $23
+divu $12, $6
+sw $8, 0x96ca($30)
+add $2, $0, $7
+add $28, $14, $13
+sub $1, $7, $24
+L47: 
+.word 1924393379
+L48: mflo $5
+sw $7, 97($19)
+
+L49: beq $1, $0, L171 ; fwd
+L50: beq $29, $29, L4 ; fwd
+
+L51: lis $4
+lis $3	;tab
+sub $12, $5, $27
+sw $7, -31($20)
+
+jr $28
+L52: .word 0xd016e0e9
+L53: .word L51
+; comment only
+add $25, $17, $7
+sw $15, 93($15)
+add $17, $8, $24
+
+beq $8, $2, L15 ; fwd
+add $16, $11, $10
+beq $27, $10, L18
+beq $13, $17, L14 ; fwd
+jr $31
+add $2, $19, $26
+
+; comment only
+.word -1724120223
+sltu $11, $1, $21
+add $17, $25, $20
+
+mult $15, $9
+bne $3, $13, L12
+add $31, $25, $9
+
+slt $10, $15, $6
+sw $31, 0xe98e($29)
+lis $0
+add $6, $26, $27
+.word L17
+add $16, $1, $1
+
+mflo $5
+; comment only
+beq $7, $21, L19
+beq $9, $16, L67 ; fwd
+; comment only
+; comment only
+
+
+.word L51
+.word 0x26587b33
+beq $5, $26, L102 ; fwd
+sw $1, 0x7f58($26)
+jalr $5
+L54: beq $16, $1, L74 ; fwd
+add $27, $19, $25
+beq $27, $17, L155 ; fwd
+lw $16, 0xddc2($0)
+mflo $20
+
+beq $21, $24, L150 ; fwd
+L55: add $6, $15, $26
+.word 0x464f4a93
+beq $26, $26, L87 ; fwd
+L56: .word L44
+.word L30
+
+.word 0xd3b60382
+.word L1
+sw $20, 0x92cd($3)
+L57: multu $21, $18
+mflo $4
+L58: sw $21, 29($12)
+sw $30, 0xa1e3($18)
+.word L1
+; comment only
+jalr $20
+sw $8, 0x5d81($2)
+beq $27, $21, L51
+div $15, $4
+L59: ; comment only
+.word L55
+add $4, $21, $10
+
+sw $20, -61($29)
+add $24, $10, $11
+slt $13, $21, $14
+L60: add $6, $17, $27
+L61: lis $3	;tab
+L62: lis $3	;tab
+.word 3203685254
+L63: ; comment only
+L64: lis $3	;tab
+bne $22, $17, L64
+
+add $9, $21, $15
+mflo $26
+lw $19, 0xf5($29)
+sw $6, 0xf0d2($23)
+L65: .word 2030246585
+L66: .word L5
+beq $11, $15, L189 ; fwd
+bne $16, $29, L53
+lis $3	;tab
+L67: ; comment only
+mflo $13
+L68: add $26, $4, $25
+.word L40
+add $1, $25, $26
+div $9, $6
+L69: mflo $12
+L70: add $15, $21, $2
+beq $9, $21, L9 ; fwd
+lw $8, 40($28)
+L71: ; comment only
+lis $3	;tab
+add $11, $15, $5
+.word L2
+sub $24, $21, $30
+L72: .word L65
+mult $30, $28
+bne $30, $28, L16
+sw $19, -83($27)
+beq $19, $1, L19
+beq $22, $9, L23 ; fwd
+sub $9, $15, $0
+lw $2, -2($19)
+.word L7
+jr $16
+beq $29, $21, L39
+mfhi $4
+.word L1
+beq $23, $23, L74 ; fwd
+; comment only
+L73: beq $22, $10, L69 ; fwd
+lw $1, 0x204c($24)
+sltu $22, $26, $20
+sw $31, 0x4e2c($18)
+L74: beq $30, $8, L46 ; fwd
+slt $16, $24, $1
+lis $3	;tab
+multu $0, $8
+.word L31
+; comment only
+lis $3	;tab
+beq $15, $4, L200 ; fwd
+
+multu $29, $13
+sw $4, -62($15)
+
+L75: add $21, $16, $24
+lis $3	;tab
+add $22, $22, $14
+add $22, $25, $1
+; comment only
+sltu $29, $1, $28
+.word L37
+
+divu $19, $3
+bne $18, $10, L17
+.word 0x7e8da727
+.word L15
+
+sw $6, 55($26)
+beq $2, $1, L249 ; fwd
+beq $13, $20, L51 ; fwd
+; comment only
+.word L47
+add $30, $15, $30
+jalr $28
+
+
+.word -1503994200
+beq $25, $20, L196 ; fwd
+L76: .word 565815646
+lis $3	;tab
+add $2, $21, $1
+sw $27, -44($31)
+multu $27, $30
+add $6, $4, $27
+bne $12, $27, L15
+mfhi $28
+L77: 
+
+sltu $22, $26, $30
+.word -958566383
+L78: ; comment only
+beq $27, $23, L43 ; fwd
+lis $25
+.word 0xd35ae379
+lis $5
+add $7, $8, $10
+.word L14
+beq $31, $19, L67
+sw $11, 0xbfa0($16)
+lis $3	;tab
+lis $3	;tab
+
+L79: beq $23, $19, L59
+beq $22, $17, L54 ; fwd
+
+div $28, $23
+L80: .word L17
+lis $3	;tab
+; comment only
+lis $2
+add $4, $8, $5
+L81: mflo $0
+beq $5, $30, L28
+lis $3	;tab
+jalr $26
+L82: lis $3	;tab
+sw $25, 11($11)
+.word 1086119122
+lis $3	;tab
+mfhi $26
+add $6, $15, $31
+mflo $23
+beq $18, $15, L36
+add $16, $30, $30
+beq $27, $10, L23 ; fwd
+L83: .word 0xca3d2515
+sltu $19, $25, $17
+L84: ; comment only
+L85: ; comment only
+div $9, $21
+sub $7, $17, $28
+mflo $25
+jr $20
+sw $16, 0x236($18)
+lw $16, 0xc66b($3)
+
+.word 0xb6da4b61
+slt $23, $7, $20
+mult $5, $27
+multu $26, $30
+; comment only
+L86: .word 3580645299
+.word 0x8c227bec
+beq $31, $15, L233 ; fwd
+beq $31, $0, L211 ; fwd
+mfhi $20
+lw $23, 0x700e($5)
+beq $11, $9, L26 ; fwd
+jalr $14
+beq $22, $12, L202 ; fwd
+add $11, $20, $23
+beq $26, $22, L155 ; fwd
+
+lis $27
+jalr $17
+
+; comment only
+; comment only
+jr $21
+sw $23, 0x72ad($20)
+add $16, $13, $25
+add $13, $2, $31
+div $29, $24
+.word L2
+beq $13, $10, L31
+lis $3	;tab
+L87: mult $9, $0
+.word L6
+lis $23
+add $16, $12, $30
+div $25, $14
+lis $3	;tab
+L88: div $14, $29
+lw $26, 0x375d($4)
+L89: sub $22, $25, $26
+add $29, $9, $31
+slt $11, $18, $14
+sub $15, $31, $17
+.word L47
+.word 0x74bdb237
+slt $29, $9, $9
+jr $12
+mflo $12
+; comment only
+
+; comment only
+.word L16
+L90: lis $2
+.word L41
+lis $3	;tab
+
+; comment only
+beq $28, $25, L57
+beq $30, $6, L0
+L91: bne $21, $16, L12
+
+sw $24, 0x9c60($29)
+beq $6, $22, L81 ; fwd
+sltu $5, $13, $21
+lw $29, -35($7)
+add $7, $28, $15
+beq $6, $22, L217 ; fwd
+; comment only
+slt $9, $20, $26
+jr $18
+.word -1732755000
+.word L26
+L92: add $19, $10, $21
+L93: .word L27
+lw $22, 0xacf8($25)
+.word 1737247626
+L94: lw $18, 0x794c($31)
+slt $22, $14, $22
+L95: divu $22, $30
+L96: lw $10, -27($8)
+L97: beq $5, $13, L1 ; fwd
+beq $22, $2, L79 ; fwd
+L98: sw $21, -46($10)
+add $31, $9, $30
+sw $31, 76($24)
+lis $3	;tab
+sw $0, -93($11)
+; comment only
+add $15, $3, $5
+.word L35
+lw $27, -76($7)
+add $18, $7, $17
+
+add $0, $16, $4
+beq $24, $16, L55 ; fwd
+L99: .word 2320150989
+slt $18, $9, $11
+sub $29, $31, $8
+lis $3	;tab
+L100: 
+
+lis $3	;tab
+mflo $14
+bne $19, $5, L12
+div $6, $20
+.word L38
+L101: beq $31, $7, L101
+beq $25, $25, L23 ; fwd
+
+.word 0xaba0ac67
+L102: lis $3	;tab
+; comment only
+div $23, $23
+beq $8, $5, L25
+add $26, $4, $17
+.word 0x574254f8
+.word L15
+beq $3, $2, L237 ; fwd
+div $12, $5
+add $6, $13, $9
+add $8, $26, $28
+.word 0x7e93c0c4
+jr $26
+L103: ; comment only
+
+L104: bne $17, $19, L9
+L105: mult $27, $12
+L106: .word L3
+; comment only
+slt $7, $1, $0
+slt $7, $17, $29
+; comment only
+div $0, $14
+sw $1, 76($4)
+.word -342207537
+L107: beq $30, $18, L185 ; fwd
+lis $3	;tab
+mfhi $5
+divu $23, $0
+; comment only
+
+.word L27
+L108: lis $3	;tab
+div $22, $29
+.word L46
+
+beq $30, $0, L103
+add $16, $13, $3
+add $19, $25, $6
+mflo $18
+L109: .word 0x1a8d1953
+lis $3	;tab
+add $14, $29, $1
+lis $3	;tab
+.word L87
+add $24, $11, $19
+.word L81
+lw $10, 0xbf2a($22)
+.word 0xcc5370e0
+L110: sub $0, $12, $6
+lw $12, -76($15)
+add $26, $21, $8
+.word L52
+.word 0x775a92c0
+.word L7
+jalr $16
+div $3, $4
+.word L54
+lw $19, 0xeb2d($24)
+lis $3	;tab
+; comment only
+
+add $15, $26, $27
+lw $18, 0x8175($15)
+L111: multu $19, $16
+bne $21, $4, L50
+.word L10
+multu $4, $30
+L112: beq $21, $3, L27
+L113: 
+; comment only
+L114: .word L38
+beq $19, $27, L4
+lis $3	;tab
+lis $3	;tab
+; comment only
+L115: beq $1, $10, L229 ; fwd
+beq $22, $26, L34 ; fwd
+mflo $0
+; comment only
+bne $23, $8, L66
+lw $23, 78($8)
+L116: jalr $16
+bne $28, $3, L58
+sltu $30, $31, $17
+; comment only
+multu $8, $11
+lis $3	;tab
+L117: sw $21, 0x716f($16)
+jr $17
+
+.word L106
+slt $20, $31, $5
+lis $31
+sub $16, $12, $7
+L118: add $30, $24, $29
+slt $26, $21, $2
+sw $14, -72($3)
+.word L92
+
+
+lis $3	;tab
+.word 0xfb2f0cb9
+beq $28, $23, L3 ; fwd
+lis $3	;tab
+; comment only
+L119: .word ext4
+add $7, $13, $7
+L120: beq $31, $1, L120 ; fwd
+.word 0xe77347a6
+jr $16
+jr $20
+lis $3	;tab
+L121: mfhi $31
+lis $25
+L122: .word L52
+
+beq $12, $7, L109
+mfhi $20
+beq $27, $19, L25
+add $29, $2, $28
+beq $26, $23, L115 ; fwd
+sltu $18, $4, $13
+beq $1, $12, L28
+L123: lis $3	;tab
+add $22, $21, $11
+L124: ; comment only
+beq $22, $10, L22 ; fwd
+divu $21, $18
+slt $7, $19, $4
+L125: lis $3	;tab
+
+multu $28, $7
+lis $3	;tab
+L126: jalr $18
+lw $31, 0xa096($27)
+lw $1, -57($12)
+.word L33
+.word 0xd7b6f2bb
+add $10, $19, $19
+lis $3	;tab
+jr $3
+.word 937076648
+sw $27, 79($23)
+L127: 
+jr $31
+beq $17, $15, L103 ; fwd
+beq $28, $31, L112
+.word L75
+L128: add $5, $2, $2
+L129: bne $0, $30, L18
+slt $31, $1, $2
+L130: beq $15, $10, L43
+bne $4, $24, L79
+L131: beq $23, $28, L11
+
+beq $9, $3, L85 ; fwd
+lis $3	;tab
+beq $16, $12, L238 ; fwd
+beq $30, $15, L216 ; fwd
+lw $30, 0xe83b($25)
+L132: ; comment only
+.word L93
+lis $3	;tab
+.word L44
+beq $3, $18, L53 ; fwd
+beq $26, $29, L114 ; fwd
+mult $5, $0
+div $13, $19
+sw $7, 0x72c2($31)
+slt $31, $12, $7
+L133: lis $30
+.word 2330936728
+lis $3	;tab
+div $16, $22
+mult $14, $2
+; comment only
+lis $3	;tab
+lw $28, 47($2)
+divu $3, $25
+.word L94
+.word 1140030808
+.word 0xc72527a0
+L134: .word L110
+.word L76
+lw $9, 0x26fb($19)
+mfhi $7
+sw $0, 2($18)
+.word 0x67de2fc4
+L135: beq $25, $6, L90 ; fwd
+; comment only
+; comment only
+; comment only
+L136: ; comment only
+lw $4, 85($21)
+.word L3
+slt $15, $30, $27
+beq $26, $7, L96 ; fwd
+bne $31, $15, L70
+L137: ; comment only
+; comment only
+beq $4, $16, L114
+multu $26, $1
+L138: sw $18, 0x5a51($6)
+.word 0x83ff1f0b
+sub $5, $8, $14
+bne $13, $9, L130
+bne $25, $30, L33
+sw $12, 0xae14($14)
+sltu $7, $22, $13
+beq $17, $7, L224 ; fwd
+lis $3	;tab
+lis $3	;tab
+jalr $29
+; comment only
+add $9, $4, $21
+L139: beq $8, $23, L53
+.word L48
+lis $3	;tab
+.word 3361269883
+add $15, $5, $3
+lis $3	;tab
+beq $18, $3, L209 ; fwd
+.word L74
+lis $3	;tab
+.word 0x9fb904b5
+add $8, $3, $30
+div $11, $14
+beq $5, $6, L41
+jalr $7
+lw $12, 0xf22($27)
+.word L16
+L140: beq $17, $6, L28 ; fwd
+divu $2, $22
+lis $3	;tab
+beq $12, $15, L23
+mflo $24
+beq $11, $4, L62 ; fwd
+.word 473397235
+L141: beq $19, $25, L122 ; fwd
+L142: sw $19, -24($26)
+div $12, $22
+; comment only
+
+add $31, $15, $3
+beq $14, $21, L184 ; fwd
+L143: jalr $25
+lis $1
+.word -1802962336
+div $24, $9
+add $25, $4, $6
+beq $21, $26, L101 ; fwd
+add $16, $18, $23
+bne $9, $16, L0
+
+div $24, $22
+
+lis $3	;tab
+lis $3	;tab
+beq $16, $12, L187 ; fwd
+L144: 
+beq $0, $17, L11
+lis $3	;tab
+beq $8, $9, L143
+mfhi $25
+.word -2132498298
+.word 0x3e63bf46
+L145: bne $24, $26, L118
+L146: jr $8
+add $7, $16, $27
+.word L44
+L147: lw $22, 42($6)
+lis $3	;tab
+beq $2, $12, L31 ; fwd
+
+
+; comment only
+; comment only
+multu $29, $0
+sw $20, 0x3a81($11)
+mflo $4
+bne $28, $26, L6
+multu $19, $6
+.word L107
+
+divu $21, $23
+slt $18, $16, $26
+jalr $18
+add $6, $31, $4
+add $10, $19, $7
+mflo $31
+sw $15, -51($14)
+sltu $15, $5, $17
+divu $31, $4
+.word L143
+mflo $28
+bne $25, $19, L113
+
+
+lis $3	;tab
+lis $3	;tab
+
+lis $3	;tab
+.word L109
+add $28, $3, $1
+beq $3, $21, L153 ; fwd
+; comment only
+mflo $20
+L148: lw $29, 0xcf82($5)
+jalr $6
+.word L135
+beq $12, $18, L90
+; comment only
+sw $12, 0x5ecf($14)
+slt $4, $22, $22
+lis $3	;tab
+; comment only
+add $4, $16, $8
+lw $15, 0($28)
+.word L12
+L149: lw $12, -93($22)
+L150: jr $12
+lw $2, 0x6fdc($9)
+lis $3	;tab
+beq $7, $20, L66
+divu $24, $20
+L151: 
+lis $3	;tab
+L152: sltu $25, $1, $31
+.word 0xeb24c14a
+sw $31, -93($1)
+; comment only
+L153: sltu $13, $1, $6
+add $27, $1, $19
+beq $27, $4, L90
+L154: beq $7, $13, L29
+slt $19, $19, $17
+beq $15, $31, L114
+L155: sw $20, 0x4348($27)
+bne $20, $19, L18
+lis $4
+L156: beq $29, $4, L10 ; fwd
+.word 3728142922
+.word L83
+L157: sw $16, -93($9)
+L158: ; comment only
+.word 0xe059e80f
+.word 0xada411f9
+sub $30, $22, $0
+add $31, $31, $27
+slt $19, $24, $10
+lw $8, 0xc044($30)
+beq $16, $17, L28 ; fwd
+add $16, $27, $31
+.word L36
+.word L100
+
+L159: add $7, $17, $2
+lis $3	;tab
+.word 3925251295
+.word L102
+lis $30
+lis $4
+add $4, $8, $18
+add $26, $4, $4
+lw $21, 0x784c($1)
+
+L160: lis $3	;tab
+jalr $20
+multu $2, $18
+L161: 
+beq $8, $0, L226 ; fwd
+div $3, $12
+lis $3	;tab
+
+div $24, $16
+.word -579153881
+
+beq $8, $9, L12
+beq $8, $30, L123
+multu $1, $22
+sltu $13, $19, $30
+.word 1283783648
+L162: beq $3, $1, L0
+lw $25, -17($12)
+add $27, $7, $22
+L163: .word L74
+.word L35
+.word 0xaa8e781d
+beq $5, $31, L12 ; fwd
+mflo $21
+L164: .word L39
+add $4, $4, $16
+add $29, $14, $6
+lis $1
+lis $3	;tab
+; comment only
+L165: .word 0x181a972a
+L166: .word L149
+
+
+sw $27, -7($7)
+mflo $24
+
+mult $24, $20
+L167: div $31, $9
+L168: beq $17, $30, L85
+L169: bne $18, $25, L18
+; comment only
+sub $23, $29, $22
+L170: sub $25, $13, $25
+L171: beq $26, $24, L28 ; fwd
+; comment only
+beq $21, $6, L0 ; fwd
+L172: beq $0, $17, L122 ; fwd
+jalr $21
+.word -1354140774
+L173: .word 0x958d4848
+L174: ; comment only
+div $27, $19
+L175: beq $3, $3, L221 ; fwd
+add $20, $27, $24
+beq $19, $12, L194 ; fwd
+L176: sub $4, $7, $17
+.word 0x9bb5d0
+add $23, $6, $0
+multu $19, $22
+lis $3	;tab
+lis $3	;tab
+.word -1728975693
+sw $18, 43($18)
+div $4, $13
+
+L177: lis $2
+L178: add $15, $25, $18
+lis $3
+L179: sltu $5, $15, $22
+.word 0x5ffd5eef
+L180: 
+
+add $16, $22, $3
+beq $21, $3, L126 ; fwd
+multu $25, $17
+
+L181: lis $3	;tab
+lis $29
+lis $3	;tab
+; comment only
+mult $1, $8
+L182: beq $28, $26, L15 ; fwd
+; comment only
+L183: 
+; comment only
+sub $27, $2, $31
+L184: lis $2
+lw $17, 0x2b1b($8)
+mflo $24
+; comment only
+beq $27, $4, L49 ; fwd
+.word 1217884004
+add $13, $1, $27
+.word 4179669083
+.word L64
+lis $3	;tab
+bne $29, $12, L83
+lis $3	;tab
+.word L159
+L185: add $20, $6, $26
+L186: divu $31, $3
+lis $12
+.word 0xfff842ae
+.word L45
+.word L160
+add $11, $31, $17
+sltu $31, $27, $29
+; comment only
+lw $29, 0x166a($24)
+.word 3548885831
+bne $29, $26, L152
+sub $16, $26, $23
+; comment only
+.word L76
+L187: beq $8, $24, 32
+beq $11, $26, L233 ; fwd
+lis $3	;tab
+; comment only
+div $29, $26
+L188: bne $16, $21, L180
+lw $29, 0x8db4($15)
+sltu $28, $31, $11
+sw $8, 0x3310($16)
+jr $15
+beq $27, $8, L92 ; fwd
+beq $27, $0, L52
+.word 0x3054d299
+; comment only
+lis $3	;tab
+lis $3	;tab
+; comment only
+beq $13, $22, L125 ; fwd
+
+jalr $6
+lw $24, -84($10)
+.word -189422333
+.word 1991223698
+sw $3, 0xa30d($21)
+mflo $13
+add $5, $6, $19
+sltu $7, $21, $29
+; comment only
+L189: add $7, $19, $26
+.word 0xc3075edf
+jr $0
+
+slt $21, $8, $5
+; comment only
+.word L145
+; comment only
+L190: beq $24, $13, L248 ; fwd
+multu $29, $2
+add $28, $11, $23
+L191: .word L119
+divu $9, $24
+lis $3	;tab
+L192: lis $3	;tab
+
+lis $24
+.word 0xbb0fe149
+add $26, $5, $4
+beq $27, $10, L67 ; fwd
+beq $3, $20, L203 ; fwd
+
+sw $5, 30($11)
+multu $16, $6
+sltu $18, $0, $18
+sltu $19, $15, $30
+sltu $18, $28, $0
+add $23, $17, $26
+lw $25, 0xf5cd($24)
+L193: div $1, $10
+.word 0x17fdf5c
+beq $19, $3, L239 ; fwd
+divu $29, $6
+beq $2, $9, L142
+lis $3	;tab
+L194: beq $20, $6, L54
+lw $4, 76($27)
+bne $2, $25, L126
+beq $4, $30, L118
+mfhi $0
+slt $11, $27, $26
+; comment only
+lis $3	;tab
+beq $30, $6, L175
+lw $13, 0xac90($12)
+add $23, $27, $16
+; comment only
+add $5, $20, $15
+lis $3	;tab
+L195: .word L51
+
+beq $10, $16, L70 ; fwd
+.word L190
+jr $17
+mflo $29
+sltu $2, $17, $22
+add $12, $13, $26
+beq $7, $23, L103 ; fwd
+add $11, $26, $13
+lis $3	;tab
+sub $0, $1, $6
+mfhi $25
+L196: lis $31
+add $15, $14, $28
+beq $5, $6, L11
+beq $31, $16, L12
+sw $29, 0xf459($11)
+add $5, $21, $28
+; comment only
+; comment only
+add $27, $8, $3
+div $1, $0
+sub $14, $4, $29
+L197: sw $3, -69($4)
+beq $29, $16, L121
+sltu $13, $17, $0
+; comment only
+sltu $12, $20, $17
+L198: beq $8, $31, L139
+.word L77
+mfhi $25
+lw $4, 0xfbae($29)
+L199: sw $2, 22($30)
+.word L181
+L200: add $12, $7, $4
+sw $18, 0x70d($7)
+
+beq $3, $4, L87 ; fwd
+L201: add $26, $16, $12
+multu $13, $18
+mult $23, $19
+L202: ; comment only
+bne $6, $2, L195
+L203: beq $5, $25, L181 ; fwd
+sltu $25, $28, $29
+L204: ; comment only
+add $7, $19, $10
+beq $21, $28, L145 ; fwd
+.word 1894994368
+multu $15, $11
+sw $1, 77($6)
+L205: jalr $28
+slt $20, $26, $13
+add $20, $15, $17
+lis $3	;tab
+.word L172
+beq $6, $27, L249 ; fwd
+jalr $13
+L206: beq $21, $24, L110 ; fwd
+
+sw $15, -83($12)
+.word 3649761964
+L207: 
+.word 1250019399
+.word L183
+lw $25, 0xe04f($26)
+bne $24, $15, L26
+; comment only
+.word L199
+
+L208: slt $5, $24, $19
+.word 1690167254
+; comment only
+add $27, $26, $22
+beq $29, $2, L246 ; fwd
+L209: ; comment only
+.word L184
+
+lw $17, 0x44b6($31)
+lw $22, 0x42b7($9)
+L210: mult $9, $28
+; comment only
+beq $25, $10, L82 ; fwd
+jr $31
+lis $3	;tab
+.word L136
+
+divu $31, $23
+beq $18, $2, L55 ; fwd
+mflo $31
+.word L102
+add $21, $2, $9
+
+.word 0x7b12b44b
+sltu $5, $26, $27
+beq $6, $8, L189
+mfhi $23
+; comment only
+.word L58
+lis $3	;tab
+
+beq $30, $22, L127 ; fwd
+; comment only
+add $12, $6, $24
+jalr $31
+mult $9, $29
+multu $1, $11
+lis $30
+.word L1
+lis $3	;tab
+L211: jr $27
+; comment only
+jalr $16
+L212: slt $28, $10, $15
+sw $31, 0xf75d($28)
+
+
+
+; comment only
+L213: lis $31
+sltu $21, $13, $1
+lis $3	;tab
+; comment only
+add $31, $14, $14
+divu $10, $15
+.word 0xa49ef71d
+
+add $28, $26, $31
+sw $5, 48($15)
+beq $2, $20, L49
+L214: lis $3	;tab
+lw $17, 0x3e55($12)
+lis $3	;tab
+jalr $27
+
+.word 0x198cbb84
+lis $3	;tab
+
+div $6, $0
+beq $5, $19, L89 ; fwd
+L215: lis $3	;tab
+sw $19, 24($20)
+add $29, $24, $23
+L216: 
+L217: sw $10, -21($31)
+multu $0, $11
+mult $5, $10
+multu $24, $11
+beq $19, $10, L119
+.word 2821630850
+add $8, $18, $3
+.word L163
+bne $5, $10, L16
+slt $17, $24, $3
+multu $1, $2
+add $13, $23, $3
+L218: ; comment only
+lw $20, 0x8385($6)
+lis $3	;tab
+L219: mflo $30
+beq $23, $24, L3 ; fwd
+beq $9, $22, L140
+
+L220: beq $30, $16, L133
+lw $26, 0x1297($29)
+; comment only
+lis $22
+; comment only
+div $26, $5
+lis $3	;tab
+jr $31
+add $19, $27, $2
+lis $26
+add $5, $20, $29
+L221: .word -1992235700
+sub $23, $9, $30
+; comment only
+lis $3	;tab
+beq $27, $12, L128
+L222: 
+sw $29, -95($29)
+L223: lis $3
+mult $27, $10
+beq $1, $20, L99
+bne $16, $4, L159
+.word L156
+; comment only
+jalr $31
+; comment only
+jalr $6
+div $15, $14
+lis $3	;tab
+.word L174
+lis $3	;tab
+
+; comment only
+sw $23, 89($0)
+lis $3	;tab
+.word 0x37fb9275
+L224: divu $20, $1
+.word L44
+bne $12, $19, L51
+.word 0x4abc63da
+
+add $30, $4, $22
+
+add $26, $3, $1
+lis $3	;tab
+L225: mult $25, $8
+.word L68
+sub $1, $18, $8
+L226: .word 0x80eb4a7a
+lw $13, 0x6b08($25)
+L227: .word L38
+; comment only
+L228: sub $13, $6, $31
+multu $22, $27
+slt $10, $26, $14
+add $1, $30, $6
+L229: add $17, $29, $22
+slt $7, $12, $20
+; comment only
+
+L230: ; comment only
+L231: .word L25
+beq $14, $30, L112
+jalr $2
+.word L47
+mfhi $31
+.word 0xaa98d0c8
+sw $17, 0x3e46($27)
+lis $27
+.word 0xc537c138
+beq $2, $16, L191 ; fwd
+.word 0x409b691a
+.word L160
+L232: .word 1574334011
+beq $29, $18, L28
+.word 2380434181
+divu $28, $9
+lis $3	;tab
+mflo $0
+.word 0x5f596c84
+add $18, $12, $12
+L233: sw $18, -28($24)
+
+
+mfhi $19
+L234: lw $9, 25($1)
+bne $21, $29, L209
+add $7, $4, $13
+slt $17, $31, $30
+beq $2, $20, L91 ; fwd
+mfhi $17
+; comment only
+lis $3	;tab
+beq $11, $17, L20 ; fwd
+mfhi $8
+.word L199
+; comment only
+multu $16, $12
+div $4, $24
+add $20, $30, $28
+L235: lw $23, 0x76a6($12)
+; comment only
+lw $17, -23($18)
+add $6, $15, $1
+mult $27, $14
+jalr $17
+L236: .word L135
+
+add $21, $30, $1
+; comment only
+slt $6, $8, $31
+
+.word L211
+add $25, $0, $2
+mult $1, $24
+beq $8, $13, L205 ; fwd
+lw $6, 0x39ca($16)
+L237: jalr $30
+
+mflo $1
+bne $28, $25, L84
+; comment only
+divu $25, $31
+divu $1, $26
+
+beq $25, $31, L24 ; fwd
+jalr $8
+lw $25, -50($20)
+add $13, $14, $28
+lis $19
+add $0, $15, $13
+.word 1445297578
+lis $3	;tab
+L238: lis $3	;tab
+lw $23, 0x5093($28)
+beq $22, $19, L103
+sub $13, $3, $2
+; comment only
+; comment only
+bne $25, $12, L76
+add $22, $9, $15
+multu $9, $31
+add $22, $12, $30
+beq $3, $24, L138 ; fwd
+; comment only
+div $14, $19
+add $12, $3, $12
+L239: 
+sub $22, $15, $16
+lw $28, 86($8)
+L240: beq $13, $7, L40 ; fwd
+.word 0xcf6f5974
+lis $3	;tab
+lis $3	;tab
+; comment only
+add $8, $22, $3
+lw $2, 0x7d0b($10)
+
+L241: lw $23, -97($0)
+lis $3	;tab
+beq $4, $0, L56
+L242: .word -572203815
+.word 0x20816695
+add $8, $16, $23
+bne $24, $26, L96
+sub $5, $0, $14
+mult $11, $1
+L243: bne $13, $5, L25
+lis $3	;tab
+beq $2, $20, L85
+beq $22, $0, L131 ; fwd
+
+L244: ; comment only
+add $12, $2, $14
+sub $11, $2, $23
+L245: 
+div $2, $14
+L246: ; comment only
+div $27, $17
+
+
+sub $1, $4, $17
+lw $26, -48($14)
+sw $23, 0x3dca($16)
+L247: sw $19, 87($17)
+.word L82
+bne $11, $4, L16
+lis $5
+div $7, $26
+sw $2, 0x40b2($25)
+sub $29, $10, $0
+
+L248: lis $3	;tab
+add $31, $4, $4
+L249: .word L149
+
+; comment only
+; comment only
+.word 0xe573285f
+
+bne $14, $21, L206
+sub $7, $19, $7
+lis $13
+add $24, $21, $4
+; comment only
+; comment only
+.word 869661384
+sw $17, 0xe3f9($31)
+bne $30, $23, L83
+.word 0xdc51f20f
+sw $23, 0x5306($26)
+mult $16, $20
+slt $25, $18, $6
+beq $6, $6, L210 ; fwd
+jr $14
+
+add $1, $28, $15
+lis $3	;tab
+add $9, $30, $31
+div $17, $26
+.word L152
+jr $21
+add $4, $31, $6
+lw $9, 0x4f81($27)
+lw $28, 0xf1f0($25)
+sub $13, $14, $13
+lis $3	;tab
+add $22, $5, $20
+bne $26, $5, L229
+lis $3	;tab
+add $16, $18, $0
+jr $19
+lis $7
+.word 0x3fab7eaa
+; comment only
+; comment only
+lis $3	;tab
+.word L151
+add $22, $30, $21
+.word L207
+.word 0x1ea39259
+.word 1190184641
+div $10, $11
+lis $3	;tab
+divu $11, $21
+divu $14, $12
+bne $16, $16, L129
+.word 0xfa6576af
+.word 0x143c7c65
+sltu $18, $22, $30
+beq $28, $2, L246
+.word 0x5c85979a
+add $28, $0, $21
+lis $3	;tab
+.word 0x7e69446
+add $23, $25, $21
+mflo $7
+sw $2, 1($31)
+
+beq $11, $4, L83 ; fwd
+add $6, $16, $3
+lis $3	;tab
+beq $9, $13, L85
+lis $3	;tab
+; comment only
+slt $18, $9, $25
+add $6, $21, $20
+beq $29, $10, L199 ; fwd
+lis $3	;tab
+
+beq $3, $15, L216 ; fwd
+lis $3	;tab
+beq $6, $9, L103 ; fwd
+mfhi $1
+bne $21, $21, L192
+lis $3	;tab
+jalr $5
+.word 0x42c24024
+sltu $21, $19, $10
+
+beq $28, $18, L52 ; fwd
+beq $13, $29, L35
+; comment only
+add $21, $3, $16
+multu $27, $23
+mult $30, $19
+div $6, $20
+lis $25
+beq $15, $25, L14 ; fwd
+add $18, $17, $12
+; comment only
+.word L108
+add $0, $27, $9
+lw $22, 0x9843($1)
+lis $3	;tab
+beq $29, $11, L75 ; fwd
+beq $1, $15, L227 ; fwd
+lis $3	;tab
+bne $22, $17, L18
+.word 724701079
+sw $6, 0xea91($27)
+sub $23, $13, $9
+.word 1744763103
+beq $0, $3, L28
+jalr $4
+.word L95
+.word 0x83372b47
+
+.word L60
+.word L106
+lis $6
+add $11, $8, $29
+beq $16, $4, L47 ; fwd
+sw $6, 0x28ae($9)
+.word 0x3e5f5b25
+multu $27, $0
+beq $31, $2, L81 ; fwd
+add $0, $29, $12
+.word L66
+mfhi $14
+; comment only
+.word 0x221205fa
+beq $2, $16, L219
+.word L120
+.word -1588875441
+.word 0x90eb8bb3
+
+
+beq $18, $30, L209
+
+beq $21, $4, L79 ; fwd
+add $9, $7, $15
+lw $16, 88($31)
+lis $3	;tab
+mfhi $5
+sub $7, $21, $25
+beq $25, $16, L28
+sub $3, $1, $13
+slt $29, $31, $2
+add $18, $19, $3
+.word 0xf52de3f5
+add $8, $9, $12
+
+beq $10, $8, L25 ; fwd
+
+lis $3	;tab
+multu $19, $9
+bne $11, $11, L94
+
+add $21, $22, $17
+lis $3	;tab
+lw $23, -59($19)
+.word 750648468
+
+beq $3, $26, L226
+mfhi $26
+slt $28, $22, $19
+divu $29, $14
+.word 0x3ebea1a1
+sltu $20, $8, $28
+.word -607446292
+beq $30, $30, L131
+multu $28, $12
+.word 1738122356
+jr $1
+lis $3	;tab
+bne $2, $7, L131
+sw $27, -26($0)
+slt $8, $4, $13
+.word L98
+
+add $1, $24, $7
+divu $23, $24
+lw $8, 27($2)
+.word L60
+multu $30, $31
+.word L16
+slt $16, $24, $14
+; comment only
+add $26, $13, $27
+.word L47
+sw $4, 0xb2a0($5)
+.word 0xedef7940
+sw $29, -72($26)
+beq $16, $21, L206 ; fwd
+add $12, $4, $19
+lis $3	;tab
+.word L29
+.word L190
+.word 0xbe6750c7
+beq $17, $8, L161
+beq $13, $6, L225 ; fwd
+; comment only
+add $31, $27, $14
+; comment only
+beq $25, $16, L196
+mfhi $11
+lis $3	;tab
+
+.word 0xd5f1ef8
+sltu $7, $21, $26
+add $19, $25, $29
+divu $19, $12
+lw $6, 46($15)
+lw $27, 93($23)
+lis $16
+slt $1, $10, $7
+sw $12, 0x552($8)
+; comment only
+; comment only
+
+sub $1, $19, $2
+
+slt $5, $28, $6
+bne $1, $29, L137
+jalr $30
+sltu $20, $3, $18
+mfhi $16
+.word L121
+; comment only
+slt $4, $14, $7
+beq $6, $20, L3
+sltu $9, $21, $8
+; comment only
+sub $12, $31, $12
+multu $31, $27
+beq $20, $11, L62 ; fwd
+add $11, $28, $19
+lis $3	;tab
+.word 0x56823c61
+sltu $19, $27, $22
+.word L51
+.word -1320932924
+beq $17, $18, L99 ; fwd
+.word L186
+beq $10, $10, L26 ; fwd
+lw $9, 0xc4fa($29)
+beq $20, $4, L204 ; fwd
+sw $24, 40($25)
+.word 0x3b754cf1
+add $2, $29, $19
+lis $3	;tab
+lw $27, 0x673c($13)
+lis $26
+.word L131
+beq $15, $14, L227
+lis $3	;tab
+; comment only
+lis $3	;tab
+; comment only
+lw $16, 0xf0fd($30)
+add $7, $9, $12
+lw $23, 0x4035($8)
+slt $13, $5, $27
+add $14, $25, $21
+
+; comment only
+
+lis $3	;tab
+lw $3, 0x396($21)
+
+div $30, $26
+lis $3	;tab
+multu $19, $10
+.word L216
+bne $8, $27, L212
+add $26, $2, $2
+beq $12, $3, L155
+
+sw $22, 60($14)
+lis $3	;tab
+; comment only
+mult $18, $9
+add $18, $6, $16
+lw $0, 37($11)
+beq $9, $5, L201
+sw $16, 0x84b3($5)
+add $13, $17, $20
+.word L207
+.word L111
+beq $10, $30, L63 ; fwd
+; comment only
+lis $15
+jr $13
+.word -243011452
+mfhi $5
+slt $22, $26, $30
+lw $23, -11($7)
+add $25, $17, $26
+.word L140
+add $17, $26, $22
+; comment only
+beq $26, $3, L36 ; fwd
+sub $31, $16, $18
+bne $16, $1, L124
+.word L30
+bne $29, $15, L206
+div $30, $22
+sw $16, 0x52aa($13)
+multu $29, $30
+divu $27, $25
+add $10, $13, $24
+sub $16, $4, $29
+beq $4, $21, L246
+bne $25, $19, L44
+mfhi $31
+add $9, $22, $24
+; comment only
+div $18, $26
+lis $3	;tab
+mult $0, $7
+beq $9, $30, L233 ; fwd
+sub $26, $3, $20
+.word L15
+; comment only
+.word -246661838
+jalr $19
+beq $4, $13, L101
+
+.word 4277288213
+.word L148
+beq $16, $29, L120 ; fwd
+.word L83
+add $10, $22, $28
+
+sltu $9, $19, $13
+add $2, $13, $16
+
+lis $3	;tab
+sub $12, $5, $5
+lw $3, 0x1108($9)
+.word L230
+; comment only
+add $6, $8, $7
+lis $3	;tab
+; comment only
+sw $14, 0xab43($25)
+div $4, $18
+.word -1034547066
+.word 495275854
+; comment only
+
+sw $27, -62($10)
+lis $21
+
+.word L102
+beq $24, $24, L88 ; fwd
+.word L67
+; comment only
+lw $12, 0xecd($14)
+.word L7
+.word 30353583
+add $10, $22, $3
+add $20, $20, $20
+; comment only
+add $30, $16, $17
+multu $14, $23
+; comment only
+add $31, $27, $25
+beq $28, $19, L9 ; fwd
+beq $28, $21, L29 ; fwd
+; comment only
+add $27, $2, $18
+bne $11, $3, L20
+bne $29, $14, L180
+divu $25, $4
+mfhi $18
+sw $11, 45($11)
+mflo $13
+sw $29, 0xf164($10)
+sub $10, $8, $7
+lis $3	;tab
+beq $15, $22, L26 ; fwd
+bne $13, $12, L111
+slt $17, $13, $11
+sub $13, $11, $9
+add $12, $26, $0
+.word -1379190006
+add $19, $16, $4
+lw $20, 0x6952($5)
+add $2, $28, $12
+.word L47
+.word 0x1d4629ca
+bne $16, $20, L56
+sltu $12, $13, $14
+beq $12, $12, L42
+beq $2, $18, L180
+slt $16, $6, $13
+sltu $22, $14, $0
+sub $21, $1, $16
+jalr $14
+.word L193
+multu $1, $20
+.word -357963223
+lis $3	;tab
+bne $16, $15, L28
+multu $10, $31
+lw $13, 0x3791($19)
+jalr $30
+beq $4, $2, L20
+add $8, $12, $22
+add $17, $24, $16
+.word L199
+lis $5
+; comment only
+; comment only
+sub $9, $5, $18
+lis $8
+sltu $7, $0, $28
+
+multu $18, $31
+.word 3064169740
+bne $20, $1, L9
+lis $3	;tab
+lis $3	;tab
+mfhi $0
+.word L249
@@ -0,0 +1,2007 @@
+.import ext0
+.import ext1
+.import ext2
+.import ext3
+.import ext4
+.export L0
+; comment only
+L0: 
+
+L1: add $30, $16, $14
+lis $3	;tab
+; comment only
+beq $9, $14, L162 ; fwd
+; comment only
+add $4, $10, $2
+add $17, $30, $24
+.word 0xef829c88
+L2: divu $13, $16
+.word 0xd55ec1a5
+.word 361858708
+
+div $6, $13
+
+sub $30, $30, $5
+slt $9, $1, $18
+.word 0xb813439
+lw $2, -21($6)
+add $12, $26, $18
+mult $21, $20
+divu $24, $29
+.word 0x81cc8265
+lis $3	;tab
+sw $16, 0x4d90($0)
+
+.word 0xa0996d52
+bne $31, $1, L0
+sw $19, 0x99f8($11)
+bne $16, $19, L0
+beq $8, $19, L128 ; fwd
+lw $20, 0xad95($6)
+L3: bne $14, $28, L2
+jalr $28
+sub $12, $20, $11
+beq $22, $8, 3
+sw $22, 0x6aba($26)
+add $26, $9, $12
+L4: 
+.word 0xf69f28d8
+sltu $18, $7, $15
+L5: lis $3	;tab
+jr $3
+L6: lis $3	;tab
+L7: ; comment only
+beq $1, $26, L13 ; fwd
+
+L8: div $30, $3
+mfhi $7
+lw $0, 0xa0ec($3)
+lis $27
+L9: beq $3, $8, L0
+L10: add $5, $31, $20
+slt $24, $24, $19
+lis $27
+L11: ; comment only
+L12: lis $3	;tab
+sltu $11, $2, $23
+beq $24, $2, L159 ; fwd
+add $23, $31, $20
+lis $3	;tab
+add $15, $13, $17
+slt $14, $27, $8
+bne $16, $7, L1
+lis $3	;tab
+; comment only
+beq $6, $20, L144 ; fwd
+
+.word L3
+add $5, $6, $24
+add $21, $7, $1
+beq $30, $18, L148 ; fwd
+sub $15, $6, $6
+add $20, $11, $4
+multu $29, $25
+
+bne $5, $24, 0x3c3a
+lis $3	;tab
+.word -69918231
+.word L11
+.word L11
+div $12, $9
+beq $18, $26, L9
+lw $19, 0x44a1($24)
+
+bne $9, $26, L11
+.word ext4
+beq $1, $30, L184 ; fwd
+L13: .word -1950575043
+beq $4, $13, L218 ; fwd
+lis $8
+lis $3	;tab
+add $16, $10, $2
+.word 2538145664
+L14: lw $22, 0x948e($0)
+L15: bne $24, $31, L15
+; comment only
+lw $27, 0x703c($6)
+lis $3	;tab
+bne $18, $16, L10
+; comment only
+beq $31, $22, L15 ; fwd
+beq $11, $9, L45 ; fwd
+beq $29, $7, L27 ; fwd
+div $26, $19
+.word L9
+lis $3	;tab
+L16: lis $3	;tab
+; comment only
+lis $3	;tab
+slt $17, $24, $3
+add $30, $17, $15
+; comment only
+bne $28, $4, L3
+
+L17: sltu $7, $11, $12
+beq $25, $8, L151 ; fwd
+.word 0x2dcba933
+lw $28, 0xf306($20)
+
+.word L9
+beq $30, $1, L153 ; fwd
+beq $0, $6, L197 ; fwd
+jr $11
+.word L6
+mfhi $28
+L18: lw $8, 19($3)
+L19: 
+slt $1, $21, $20
+beq $5, $2, L10
+mfhi $12
+jr $20
+L20: add $26, $4, $12
+.word 0xb303e1b2
+.word L0
+lis $3	;tab
+divu $2, $16
+bne $23, $25, L0
+sw $9, 17($10)
+divu $10, $1
+L21: 
+.word L1
+.word -223239435
+add $25, $31, $1
+mflo $6
+mflo $21
+beq $3, $18, L14
+sw $15, 43($21)
+bne $5, $3, L2
+add $6, $1, $5
+L22: ; comment only
+L23: add $12, $21, $12
+.word L15
+beq $2, $24, L78 ; fwd
+beq $25, $5, L242 ; fwd
+.word 2640003309
+lis $3	;tab
+; comment only
+div $26, $28
+lis $3	;tab
+lw $24, 24($10)
+add $29, $5, $6
+
+beq $3, $3, L115 ; fwd
+lis $3	;tab
+beq $4, $12, L3
+lw $28, -80($15)
+multu $0, $7
+mflo $26
+
+; comment only
+.word L19
+L24: sltu $1, $6, $12
+lw $6, 19($6)
+beq $22, $25, L154 ; fwd
+slt $28, $24, $13
+L25: add $29, $19, $4
+jr $4
+beq $23, $27, L200 ; fwd
+
+lis $3
+.word 0x403da74b
+mflo $29
+; comment only
+beq $26, $30, L13
+
+lw $11, -76($18)
+add $30, $2, $12
+sw $27, 0x5844($12)
+lw $6, 0x4ca1($28)
+L26: divu $18, $24
+beq $23, $10, L110 ; fwd
+.word L16
+lis $18
+.word L11
+lw $0, -97($1)
+add $0, $13, $29
+beq $31, $11, L8
+beq $6, $28, L7
+.word L23
+add $1, $27, $2
+beq $10, $15, L244 ; fwd
+L27: .word 0x8d468c30
+L28: add $1, $31, $3
+.word L16
+
+beq $18, $11, L4
+; comment only
+L29: bne $29, $17, L18
+div $8, $2
+jr $17
+L30: 
+slt $8, $17, $17
+L31: beq $4, $23, L8 ; fwd
+beq $28, $12, L79 ; fwd
+divu $25, $20
+L32: mfhi $20
+.word 0x919e6f9
+slt $14, $12, $5
+sltu $7, $0, $18
+lis $3	;tab
+L33: sw $29, -32($11)
+multu $9, $11
+.word L0
+L34: add $11, $11, $19
+multu $3, $9
+.word 1197356605
+lw $8, 0x252f($8)
+
+L35: mfhi $23
+.word L4
+.word L20
+lis $3	;tab
+lis $3	;tab
+.word L26
+; comment only
+divu $24, $12
+lw $19, 0x5120($12)
+L36: 
+.word -1383480133
+.word 796596336
+
+multu $20, $29
+bne $22, $22, L21
+sw $11, -69($21)
+lis $27
+.word L30
+divu $3, $4
+; comment only
+lw $15, -3($4)
+mfhi $31
+.word 3820738385
+; comment only
+.word L6
+div $14, $0
+
+L37: sub $20, $27, $18
+add $20, $28, $23
+jr $21
+sltu $24, $14, $30
+L38: sw $12, -70($5)
+bne $0, $31, L17
+L39: jalr $27
+beq $19, $27, L73 ; fwd
+L40: lis $3	;tab
+sub $28, $20, $4
+bne $27, $6, 34
+
+beq $25, $5, L33
+L41: ; comment only
+
+multu $30, $25
+.word L14
+sw $8, 0x8815($22)
+
+lis $3	;tab
+.word L27
+beq $12, $31, L223 ; fwd
+mult $29, $7
+; comment only
+lis $11
+bne $15, $24, L3
+bne $14, $11, L22
+lis $3	;tab
+lis $3	;tab
+L42: lis $28
+multu $30, $13
+beq $23, $14, L44 ; fwd
+; comment only
+; comment only
+div $28, $23
+L43: ; comment only
+.word L37
+; comment only
+beq $31, $14, L99 ; fwd
+.word L25
+.word L7
+beq $20, $6, L9
+.word L9
+.word L31
+L44: beq $5, $19, L43
+; comment only
+.word 0x2c51812
+beq $15, $18, L36
+lis $3	;tab
+L45: ; comment only
+lis $3	;tab
+; comment only
+jr $23
+L46: add $30, $12, $10
+mult $6, $7
+; comment only
+.word 0x7ac046bd
+lw $13, 0x7a0b($27)
+L47: beq $16, $12, L15
+bne $6, $6, 40
+L48: .word L7
+multu $2, $31
+; comment only
+L49: .word L32
+
+.word 0x8b4d55b8
+add $10, $27, $0
+multu $23, $16
+L50: ; comment only
+beq $7, $10, L47
+L51: .word 0x2641202c
+
+lw $5, 59($6)
+L52: sltu $25, $29, $28
+lis $3	;tab
+slt $26, $10, $0
+L53: ; comment only
+beq $2, $13, L51
+beq $20, $14, L112 ; fwd
+add $22, $13, $14
+.word -1735630375
+add $25, $1, $21
+.word L32
+
+lis $3	;tab
+
+lw $11, 15($18)
+
+divu $8, $19
+multu $23, $18
+L54: .word L30
+lis $3	;tab
+.word -2060093802
+L55: ; comment only
+add $3, $22, $18
+.word L19
+div $5, $25
+add $7, $12, $15
+L56: lis $3	;tab
+lis $3	;tab
+; comment only
+L57: mult $19, $0
+bne $5, $26, L21
+.word 0xf0214df0
+lis $3	;tab
+.word L13
+beq $16, $30, L244 ; fwd
+lis $3
+
+L58: .word -1110341886
+; comment only
+.word 0x57153c58
+bne $23, $25, L14
+L59: jalr $1
+lis $3	;tab
+
+.word L24
+; comment only
+jr $25
+L60: ; comment only
+add $12, $6, $8
+; comment only
+sub $13, $18, $8
+.word 0x285bc0e3
+beq $28, $1, L65 ; fwd
+
+bne $13, $7, L5
+.word 3194895713
+slt $19, $13, $13
+.word 2154623167
+lw $16, 0x3425($9)
+mflo $7
+lw $25, 0x940d($12)
+lis $22
+slt $25, $22, $15
+sltu $7, $1, $11
+beq $14, $20, L49
+; comment only
+L61: bne $1, $31, L56
+divu $0, $7
+bne $17, $24, L58
+bne $0, $21, 0x9079
+add $30, $4, $19
+; comment only
+L62: multu $16, $20
+L63: ; comment only
+L64: lis $0
+add $24, $10, $6
+; comment only
+lis $3	;tab
+add $29, $27, $5
+L65: sltu $5, $12, $6
+beq $21, $1, L204 ; fwd
+lis $3	;tab
+sltu $13, $20, $28
+
+beq $12, $0, L55
+L66: bne $26, $30, L38
+lw $14, 0x2a3a($28)
+jalr $20
+beq $18, $23, L49
+
+; comment only
+mfhi $22
+L67: lis $3	;tab
+add $29, $16, $31
+lis $3	;tab
+lis $3	;tab
+lw $4, 0xc865($25)
+lis $8
+
+multu $15, $29
+slt $23, $12, $6
+L68: .word L62
+beq $20, $18, L45 ; fwd
+
+sw $21, -39($2)
+; comment only
+L69: add $11, $2, $30
+sub $23, $15, $30
+beq $3, $0, L192 ; fwd
+beq $20, $9, L146 ; fwd
+lis $22
+divu $27, $25
+L70: .word 0x9e1d9be6
+beq $0, $11, L5
+.word 0xafd3f8b1
+L71: sw $11, 0xe856($26)
+jalr $22
+jr $23
+lw $14, -7($15)
+.word L24
+L72: .word L56
+divu $16, $24
+.word 0x1b20f50d
+bne $19, $24, L55
+beq $18, $20, L35
+jr $13
+jalr $14
+
+mfhi $7
+add $26, $2, $19
+beq $8, $16, L60
+beq $24, $16, L134 ; fwd
+beq $30, $5, L49 ; fwd
+add $31, $3, $26
+sltu $25, $20, $26
+bne $4, $29, L32
+lis $3	;tab
+L73: ; comment only
+L74: jalr $22
+beq $15, $20, L221 ; fwd
+sltu $0, $9, $12
+beq $6, $12, L90 ; fwd
+sub $25, $29, $1
+beq $24, $26, L13
+L75: lis $3	;tab
+L76: lis $3	;tab
+mflo $28
+lis $3	;tab
+.word L19
+L77: jr $17
+beq $3, $14, L159 ; fwd
+beq $22, $4, L163 ; fwd
+beq $1, $28, L28 ; fwd
+mfhi $11
+; comment only
+beq $27, $1, L56
+.word L15
+
+
+jalr $17
+L78: .word L3
+sub $26, $10, $5
+L79: .word L22
+
+bne $29, $18, L13
+beq $1, $22, L8
+sub $18, $30, $0
+.word -496584212
+beq $4, $20, L69
+.word -1480422527
+; comment only
+.word 3462760129
+
+beq $18, $9, L39 ; fwd
+beq $0, $15, L44 ; fwd
+.word L53
+.word 1043017318
+
+beq $5, $24, L33
+lw $14, 0xd678($10)
+
+.word L56
+lis $3	;tab
+sw $4, -65($2)
+L80: .word 85207804
+add $24, $26, $28
+L81: multu $23, $7
+bne $1, $19, L6
+
+beq $13, $24, L4
+add $5, $15, $20
+slt $25, $0, $24
+sw $8, 70($9)
+; comment only
+L82: sub $15, $1, $15
+bne $2, $26, L9
+.word L48
+beq $22, $23, L12
+divu $5, $21
+beq $5, $8, L38
+; comment only
+slt $4, $12, $6
+
+beq $11, $10, L73
+lis $3	;tab
+multu $21, $20
+mfhi $11
+add $15, $17, $19
+L83: .word L42
+bne $6, $21, L24
+sw $14, 0x725a($12)
+beq $30, $7, L23
+mult $21, $3
+lw $15, 0x5ea3($11)
+beq $8, $9, L80 ; fwd
+beq $19, $20, L10
+jalr $7
+sub $1, $31, $28
+bne $13, $18, L9
+sltu $27, $5, $9
+divu $15, $17
+.word 0x3d681103
+; comment only
+beq $16, $10, L231 ; fwd
+add $14, $5, $11
+L84: jalr $4
+.word L66
+mfhi $20
+beq $16, $22, L6 ; fwd
+jalr $28
+beq $1, $31, L118 ; fwd
+div $5, $22
+sw $28, -20($1)
+lw $6, 0x71d7($28)
+; comment only
+add $22, $27, $17
+beq $21, $9, L224 ; fwd
+jalr $23
+L85: add $1, $31, $27
+
+.word -529566809
+.word 0x3faee5a1
+lis $25
+beq $0, $1, L11
+beq $19, $27, L240 ; fwd
+L86: 
+beq $11, $8, L81
+jalr $12
+beq $31, $19, L231 ; fwd
+; comment only
+sw $22, 75($23)
+div $17, $12
+bne $29, $6, L1
+.word L77
+bne $29, $22, L32
+sub $5, $3, $18
+; comment only
+lis $3	;tab
+add $0, $13, $19
+.word L72
+
+.word 1427999327
+; comment only
+mflo $4
+sw $19, 68($30)
+.word 0xb34f33bc
+.word L33
+L87: jr $1
+divu $3, $7
+.word L42
+L88: lw $0, 0x45ce($17)
+beq $6, $22, L221 ; fwd
+
+slt $16, $4, $24
+beq $28, $5, L208 ; fwd
+sw $21, 0x5077($8)
+lw $29, 0x27c3($15)
+
+L89: 
+lis $12
+add $5, $25, $7
+add $13, $31, $26
+bne $15, $25, L52
+jr $30
+add $23, $23, $2
+bne $6, $13, L59
+
+bne $27, $27, L85
+divu $16, $25
+
+add $4, $28, $6
+L90: bne $16, $17, L12
+
+lis $3	;tab
+; comment only
+sw $1, -98($15)
+.word 0x9401f59b
+lis $3	;tab
+mflo $16
+L91: .word 0x2e7eaea8
+.word 1324452735
+
+
+
+sub $18, $21, $13
+beq $6, $30, L69 ; fwd
+sub $2, $10, $13
+; comment only
+beq $6, $1, L98 ; fwd
+sw $14, 0xa344($28)
+.word L65
+bne $25, $3, L72
+; comment only
+mult $17, $12
+lw $30, 0xfbc3($7)
+beq $10, $18, L157 ; fwd
+; comment only
+L92: sw $12, 0($30)
+sw $4, 0xff6f($18)
+.word L27
+sub $5, $5, $4
+; comment only
+sub $15, $11, $10
+div $19, $9
+add $2, $12, $22
+bne $24, $2, L3
+add $25, $25, $5
+beq $9, $8, L93 ; fwd
+
+divu $15, $24
+L93: add $17, $12, $28
+
+
+lis $3	;tab
+beq $29, $29, L196 ; fwd
+beq $12, $25, L85
+; comment only
+.word L89
+mflo $30
+mfhi $11
+sw $19, -26($18)
+lis $3	;tab
+bne $24, $20, L92
+beq $12, $22, L194 ; fwd
+div $3, $19
+L94: .word L14
+mflo $21
+mfhi $17
+
+add $24, $9, $2
+beq $19, $21, L87 ; fwd
+.word L64
+beq $14, $11, L66 ; fwd
+L95: .word L90
+beq $23, $27, L113 ; fwd
+.word 0x2ad31a2c
+sw $4, 0x9916($3)
+sub $18, $14, $9
+div $11, $18
+bne $4, $21, L89
+lis $3	;tab
+
+add $30, $26, $29
+sub $2, $26, $10
+beq $25, $18, L30 ; fwd
+; comment only
+
+beq $25, $26, L184 ; fwd
+multu $2, $18
+; comment only
+L96: ; comment only
+add $14, $9, $5
+.word 0xbb6903e5
+div $1, $14
+L97: .word L55
+L98: beq $9, $22, L148 ; fwd
+.word L95
+slt $15, $14, $17
+beq $13, $6, L2 ; fwd
+sub $20, $28, $6
+lis $9
+
+multu $3, $6
+lis $3	;tab
+slt $9, $14, $28
+L99: sltu $19, $27, $2
+L100: add $2, $15, $23
+L101: lw $7, 0xe253($7)
+jr $3
+lis $3	;tab
+slt $3, $11, $16
+beq $18, $30, L94 ; fwd
+beq $28, $1, L109 ; fwd
+
+
+
+lw $23, 0x21d1($12)
+.word L72
+; comment only
+.word 0x10140f4b
+
+add $15, $10, $12
+sub $18, $11, $1
+beq $15, $7, L138 ; fwd
+; comment only
+mflo $11
+beq $20, $16, L207 ; fwd
+L102: 
+sub $19, $15, $26
+lis $3	;tab
+sw $20, 0xf76d($7)
+.word 1437802993
+beq $7, $6, L138 ; fwd
+slt $31, $2, $27
+L103: divu $2, $11
+beq $5, $26, L10
+
+; comment only
+bne $23, $27, L0
+divu $28, $7
+div $4, $29
+.word L3
+; comment only
+lis $3	;tab
+sw $21, -79($28)
+L104: .word -667002344
+lis $3	;tab
+add $20, $29, $16
+beq $14, $16, L227 ; fwd
+add $7, $22, $9
+lw $11, 65($1)
+.word 0xaa6dfbf4
+beq $7, $2, L216 ; fwd
+L105: sw $28, -78($17)
+div $30, $13
+L106: .word L10
+lis $3	;tab
+.word L59
+L107: ; comment only
+.word L58
+bne $14, $23, L26
+add $22, $11, $19
+mfhi $0
+L108: bne $15, $19, L48
+div $0, $14
+
+lis $3	;tab
+.word L39
+.word 0x2bab3f51
+L109: ; comment only
+beq $3, $12, L208 ; fwd
+slt $11, $27, $15
+
+jalr $15
+beq $0, $15, L50
+mflo $2
+jalr $10
+.word 231395625
+L110: lis $3	;tab
+sltu $8, $3, $27
+mflo $22
+add $4, $15, $2
+L111: .word L82
+lw $26, 0x7e7($5)
+sltu $6, $20, $0
+beq $7, $22, L33 ; fwd
+sw $13, 0x6ba7($21)
+.word L88
+sub $26, $5, $13
+beq $2, $11, L53 ; fwd
+L112: lis $3	;tab
+lis $3	;tab
+
+L113: div $26, $7
+.word 1758605103
+beq $22, $0, L194 ; fwd
+.word 0x41cdef44
+.word L105
+sub $1, $11, $1
+lw $5, 8($19)
+lis $3	;tab
+.word L69
+add $28, $19, $10
+L114: add $6, $18, $26
+bne $18, $10, L54
+sltu $31, $9, $21
+
+add $22, $31, $13
+.word -1150390374
+; comment only
+lis $3	;tab
+slt $3, $9, $26
+L115: sub $5, $20, $12
+L116: sw $24, 9($7)
+L117: jr $18
+L118: .word 3403780663
+add $1, $12, $0
+sw $14, 0x931d($7)
+mult $30, $25
+lis $3	;tab
+.word L8
+.word 3531778526
+.word 0x8e13b6fa
+slt $16, $17, $15
+add $19, $20, $8
+divu $3, $16
+L119: lis $3	;tab
+.word L48
+bne $26, $26, L52
+beq $24, $11, L135 ; fwd
+beq $14, $8, L136 ; fwd
+divu $7, $5
+.word 321535674
+divu $17, $20
+mult $17, $16
+lis $18
+.word L6
+sw $7, 0xd579($31)
+lis $3	;tab
+.word 1639309028
+beq $23, $21, L5
+lis $3	;tab
+mult $0, $17
+bne $14, $14, L9
+beq $20, $20, L96 ; fwd
+lw $6, -7($19)
+lw $28, 0x4bf9($14)
+.word 1555515323
+lis $3	;tab
+.word L49
+jalr $21
+L120: bne $15, $14, L120
+L121: slt $21, $12, $23
+L122: jalr $29
+slt $23, $29, $29
+; comment only
+lw $5, -42($15)
+add $24, $12, $6
+
+mfhi $29
+add $0, $8, $16
+divu $22, $5
+lis $3	;tab
+lw $12, 0x78ee($26)
+.word 3137507571
+.word L50
+beq $6, $14, L15
+add $21, $10, $14
+L123: slt $31, $20, $24
+.word L54
+sw $15, -52($27)
+beq $29, $29, L68 ; fwd
+.word 1021326842
+divu $21, $20
+L124: mflo $5
+mult $23, $0
+beq $14, $2, L248 ; fwd
+lw $12, 0x90b($22)
+beq $15, $26, L205 ; fwd
+L125: .word 0xea54b2e0
+L126: ; comment only
+beq $29, $28, L45
+.word L34
+L127: mult $7, $20
+div $26, $26
+add $21, $30, $9
+add $25, $9, $0
+bne $1, $15, L112
+sltu $4, $0, $12
+lw $17, 0x9078($23)
+.word 1514123243
+.word -2041913212
+lis $5
+add $0, $20, $8
+multu $23, $8
+beq $17, $16, L161 ; fwd
+lis $3	;tab
+add $12, $17, $11
+lw $13, 0x2129($29)
+; comment only
+lis $1
+sw $19, 0xc546($21)
+
+lis $3	;tab
+sub $20, $13, $23
+
+L128: mflo $8
+L129: lis $18
+
+jalr $0
+add $22, $24, $5
+mfhi $3
+lis $3	;tab
+divu $0, $31
+lis $3	;tab
+L130: beq $8, $0, L14
+jr $8
+beq $29, $2, L122 ; fwd
+slt $9, $27, $20
+sw $13, 0x853($1)
+.word L98
+sw $5, 0xdec9($30)
+sltu $23, $24, $8
+.word 0x3583cd89
+L131: .word 1709888551
+
+slt $31, $18, $1
+beq $14, $29, L50 ; fwd
+divu $23, $14
+beq $24, $24, L181 ; fwd
+add $20, $8, $25
+.word L15
+jalr $26
+lis $3	;tab
+; comment only
+; comment only
+lw $25, 99($9)
+
+L132: beq $21, $15, L110
+beq $12, $16, L155 ; fwd
+lis $3	;tab
+add $9, $19, $9
+L133: 
+sw $10, 0xfccd($3)
+.word 0x292e556d
+.word 1926341545
+L134: ; comment only
+; comment only
+beq $10, $19, L76
+add $8, $29, $2
+; comment only
+add $13, $1, $11
+beq $31, $22, L98 ; fwd
+beq $6, $30, L237 ; fwd
+bne $19, $6, L117
+L135: .word L54
+bne $19, $5, L21
+mflo $27
+div $31, $14
+beq $19, $12, L68
+L136: 
+divu $28, $13
+L137: 
+mfhi $2
+sw $21, 0x9c69($21)
+L138: lw $12, 0xde5e($17)
+mult $6, $7
+lis $3	;tab
+.word L28
+sltu $14, $5, $21
+sw $23, -19($30)
+bne $21, $9, L72
+
+L139: ; comment only
+jr $5
+.word 0xef4eaaec
+mflo $28
+
+mult $18, $15
+mflo $0
+add $4, $12, $25
+
+lw $15, 0xba55($22)
+bne $23, $20, L56
+L140: divu $5, $30
+lw $18, 69($17)
+beq $21, $2, L150 ; fwd
+lis $3	;tab
+beq $21, $31, L91
+L141: sltu $25, $2, $4
+slt $19, $14, $26
+; comment only
+jalr $14
+beq $13, $28, L76
+beq $19, $1, L158 ; fwd
+
+L142: add $21, $30, $30
+add $21, $4, $16
+sub $16, $7, $30
+add $9, $22, $0
+sw $31, 0xb27a($13)
+; comment only
+.word L91
+.word L43
+lis $3	;tab
+
+beq $6, $26, L26
+add $29, $8, $2
+beq $2, $12, L46
+; comment only
+; comment only
+.word L9
+lis $3	;tab
+.word L121
+L143: ; comment only
+divu $20, $24
+divu $3, $20
+lis $3	;tab
+sltu $20, $26, $6
+L144: ; comment only
+add $17, $18, $20
+
+L145: mflo $3
+; comment only
+; comment only
+lis $3	;tab
+L146: .word L8
+L147: lis $3	;tab
+.word L113
+lis $3	;tab
+mflo $29
+bne $31, $23, L52
+L148: add $24, $2, $23
+beq $2, $7, L53 ; fwd
+L149: beq $31, $29, L225 ; fwd
+L150: .word L63
+bne $6, $16, L50
+beq $22, $18, L149
+lw $18, 0x13fd($7)
+; comment only
+.word L112
+bne $24, $23, L37
+lw $10, -43($20)
+sub $7, $31, $10
+L151: ; comment only
+add $14, $19, $27
+slt $19, $15, $23
+lw $20, 0x3ce8($21)
+sw $10, 0xee1a($28)
+.word L32
+; comment only
+bne $15, $10, L62
+mflo $20
+L152: ; comment only
+sub $11, $24, $12
+bne $0, $2, L114
+sw $24, 22($13)
+add $0, $3, $9
+.word 2888230799
+mult $10, $19
+L153: .word L66
+.word L49
+slt $16, $28, $29
+beq $6, $19, L101
+add $11, $27, $27
+L154: div $9, $5
+L155: 
+sw $2, 0x397d($13)
+lis $3	;tab
+.word L69
+beq $0, $25, L80 ; fwd
+L156: lis $3	;tab
+beq $31, $21, L62 ; fwd
+L157: beq $18, $20, L7 ; fwd
+lw $26, -37($16)
+; comment only
+sltu $3, $28, $6
+
+add $16, $31, $25
+; comment only
+beq $11, $3, L23 ; fwd
+.word L125
+beq $23, $13, L93
+L158: .word L15
+beq $26, $12, L55 ; fwd
+lis $3	;tab
+div $18, $22
+add $12, $24, $5
+lw $31, 31($3)
+jr $8
+sw $11, 0xde40($30)
+lis $3	;tab
+L159: 
+sltu $5, $15, $29
+bne $11, $29, L140
+L160: add $30, $17, $26
+L161: jalr $25
+beq $6, $15, L55
+sub $1, $27, $9
+bne $25, $14, L6
+mult $9, $10
+; comment only
+add $10, $29, $10
+L162: sub $17, $23, $28
+sw $18, -46($15)
+slt $23, $0, $18
+divu $18, $29
+L163: bne $29, $0, L51
+.word 0x57158d45
+.word 3556060392
+L164: ; comment only
+bne $29, $18, L63
+beq $11, $3, L27 ; fwd
+beq $25, $29, L5 ; fwd
+lw $19, 0x6ed3($11)
+lis $3	;tab
+L165: mflo $6
+bne $11, $16, L134
+; comment only
+mfhi $18
+bne $28, $25, L142
+jr $3
+multu $17, $25
+add $11, $24, $17
+lis $3	;tab
+L166: ; comment only
+mflo $13
+mfhi $3
+.word 0xe8064b41
+sw $15, -63($23)
+L167: 
+
+beq $0, $28, L11 ; fwd
+beq $14, $3, L68
+sw $23, -30($17)
+mfhi $8
+L168: .word L49
+beq $0, $3, L13
+multu $20, $27
+beq $11, $25, L217 ; fwd
+L169: add $13, $4, $1
+jalr $22
+.word L39
+slt $28, $21, $5
+; comment only
+add $31, $31, $27
+div $28, $0
+add $21, $11, $25
+beq $31, $9, L169
+L170: lis $3	;tab
+sltu $3, $11, $29
+add $18, $6, $11
+L171: .word L125
+.word L18
+
+; comment only
+beq $17, $27, L63 ; fwd
+beq $26, $1, L57
+; comment only
+lis $3	;tab
+beq $31, $18, L63 ; fwd
+L172: div $24, $10
+beq $21, $10, L71
+.word L95
+L173: add $29, $27, $25
+beq $12, $8, L38 ; fwd
+.word L39
+jr $6
+sltu $24, $22, $16
+L174: divu $17, $4
+.word L67
+add $7, $9, $30
+
+add $17, $25, $22
+; comment only
+.word L10
+L175: mflo $5
+sw $16, 0xcb2c($27)
+.word 1056161431
+.word 0xd1623ed
+multu $11, $25
+sltu $30, $17, $17
+.word L136
+; comment only
+add $15, $25, $31
+L176: div $9, $31
+multu $9, $31
+lis $3	;tab
+sub $23, $18, $18
+; comment only
+mfhi $29
+beq $14, $16, L128
+.word L13
+
+L177: beq $12, $11, L50 ; fwd
+multu $4, $3
+; comment only
+add $27, $29, $24
+beq $22, $4, L16 ; fwd
+div $14, $2
+mult $26, $6
+bne $14, $12, L142
+; comment only
+multu $19, $3
+lw $7, 43($29)
+.word L68
+beq $13, $4, L73 ; fwd
+sub $5, $0, $14
+sw $6, 0x6652($23)
+.word L171
+bne $25, $31, L95
+; comment only
+sltu $8, $30, $11
+
+divu $17, $1
+lis $3	;tab
+.word 3845599057
+.word 814661542
+bne $3, $1, L10
+mult $16, $14
+; comment only
+L178: beq $9, $9, L36 ; fwd
+L179: lw $0, -71($26)
+bne $7, $25, L47
+lis $3	;tab
+jalr $22
+slt $14, $19, $29
+sw $26, 0xb80f($29)
+mult $5, $19
+sltu $16, $23, $28
+lis $3	;tab
+; comment only
+L180: multu $1, $21
+divu $1, $24
+add $31, $9, $23
+lis $3	;tab
+.word 3765463327
+.word L48
+.word 0xb8458c41
+lis $3	;tab
+sltu $5, $28, $10
+lis $3	;tab
+L181: lis $3	;tab
+
+L182: lw $19, -41($12)
+; comment only
+mfhi $21
+.word 3475940323
+slt $5, $17, $29
+sw $29, 0xeab1($25)
+L183: .word 1595583265
+bne $11, $31, L161
+lis $3	;tab
+lw $23, 0x386e($4)
+div $10, $16
+lis $3	;tab
+; comment only
+L184: .word 1176665626
+lis $3	;tab
+; comment only
+.word -365349087
+beq $5, $21, L6 ; fwd
+beq $21, $14, L130
+jr $0
+mflo $16
+.word -994258334
+; comment only
+L185: lw $6, 58($24)
+lis $8
+L186: ; comment only
+beq $1, $3, L14 ; fwd
+.word L89
+L187: beq $31, $27, L65 ; fwd
+bne $11, $24, L166
+lis $3	;tab
+L188: ; comment only
+lis $2
+divu $3, $14
+L189: slt $28, $23, $10
+lis $3	;tab
+div $15, $4
+slt $18, $0, $0
+sub $23, $1, $8
+bne $8, $23, L62
+.word L107
+lis $3	;tab
+jr $30
+.word 0x7cc474b3
+lis $3	;tab
+
+lis $3	;tab
+beq $27, $14, L128
+sw $29, 0x4fa5($22)
+.word 0x9c3b870
+
+sw $10, -74($7)
+add $28, $22, $8
+lis $3	;tab
+L190: sw $25, 0x52ad($17)
+multu $0, $21
+; comment only
+mflo $16
+.word L112
+lw $28, 0x4d34($31)
+lw $18, 0xed7d($14)
+add $17, $28, $20
+.word 3753786041
+jr $24
+L191: slt $31, $16, $8
+beq $29, $2, L72 ; fwd
+add $30, $24, $14
+slt $5, $6, $9
+.word -1553375710
+; comment only
+slt $24, $6, $23
+.word 1379219319
+beq $17, $27, L97
+beq $9, $3, L96 ; fwd
+L192: add $4, $1, $28
+.word L81
+
+.word 1709005299
+L193: 
+jr $19
+; comment only
+beq $8, $10, L188
+.word 0xb5bb4b7
+beq $24, $28, L181
+beq $27, $13, L78
+add $5, $25, $9
+lis $17
+L194: add $16, $0, $24
+L195: sub $7, $9, $19
+; comment only
+.word L127
+
+L196: .word L113
+L197: bne $8, $22, L150
+lis $3	;tab
+bne $28, $0, L122
+sw $21, 18($15)
+bne $29, $0, L46
+L198: lis $3	;tab
+beq $19, $18, L193 ; fwd
+.word L53
+add $21, $1, $30
+add $2, $8, $30
+bne $5, $19, L191
+bne $2, $26, L99
+L199: lis $3	;tab
+add $20, $8, $21
+L200: div $6, $21
+jr $8
+L201: 
+sw $15, 0xd681($1)
+jalr $7
+bne $6, $14, L195
+L202: beq $23, $3, L69
+divu $20, $14
+.word L130
+.word 0x49e3fcd1
+div $14, $25
+lis $3	;tab
+slt $30, $4, $15
+.word L152
+add $25, $1, $1
+add $19, $0, $22
+.word 0x50c7852b
+beq $9, $8, L176 ; fwd
+add $13, $13, $24
+; comment only
+add $31, $6, $26
+sub $1, $10, $18
+add $8, $2, $28
+.word 0x8938bf1c
+mflo $29
+.word L58
+slt $2, $9, $4
+divu $29, $2
+
+add $20, $9, $5
+beq $2, $17, L0
+jr $31
+L203: sw $22, 0x79d9($27)
+; comment only
+L204: div $14, $8
+mult $26, $12
+.word 0x68441827
+divu $2, $5
+L205: add $23, $30, $18
+div $25, $7
+lis $3	;tab
+bne $28, $12, L176
+sw $28, -93($4)
+.word -1136266332
+sw $30, 0x9467($14)
+beq $5, $6, L35 ; fwd
+.word 0xf161b861
+beq $24, $26, L6
+.word 0xf3fcc937
+sltu $19, $6, $28
+
+.word L77
+lis $3	;tab
+lis $3	;tab
+lis $3	;tab
+sltu $27, $9, $11
+lw $26, -28($7)
+lis $3	;tab
+sltu $17, $12, $2
+beq $12, $21, L147
+lw $5, 0x6519($18)
+multu $29, $13
+; comment only
+
+lis $3	;tab
+add $11, $18, $4
+add $26, $17, $23
+div $20, $22
+.word L133
+.word L68
+beq $6, $26, L31
+L206: bne $9, $4, L99
+.word L170
+; comment only
+jr $10
+L207: 
+sltu $16, $20, $31
+; comment only
+jr $22
+; comment only
+.word 0x6afa73a
+beq $6, $16, L152 ; fwd
+beq $18, $4, L27 ; fwd
+beq $14, $26, L151 ; fwd
+add $9, $10, $24
+.word 0x7ff9947a
+L208: 
+mfhi $12
+sw $25, -24($1)
+lw $26, 0xd2db($0)
+jr $16
+add $3, $0, $18
+L209: sub $24, $29, $29
+beq $20, $11, L75 ; fwd
+sw $0, 95($12)
+.word 992630835
+L210: .word -272753403
+.word 2834334956
+lw $4, -56($16)
+add $6, $24, $21
+bne $31, $7, L163
+beq $2, $5, L131 ; fwd
+L211: sltu $23, $26, $5
+beq $28, $19, L55
+L212: sub $10, $15, $21
+beq $16, $14, L241 ; fwd
+; comment only
+sub $18, $1, $5
+
+L213: ; comment only
+slt $29, $29, $23
+.word 0x4a5f2d48
+
+divu $8, $26
+divu $6, $0
+lis $31
+slt $31, $3, $8
+.word L47
+jalr $8
+sub $22, $5, $13
+bne $18, $29, L180
+; comment only
+lis $29
+beq $7, $7, L60
+mflo $30
+lis $8
+jalr $24
+mflo $19
+L214: .word L190
+L215: sltu $10, $29, $24
+sub $17, $16, $1
+L216: .word -202201901
+.word L92
+sub $18, $10, $11
+bne $12, $6, L104
+add $1, $6, $1
+; comment only
+
+; comment only
+L217: lw $18, 53($16)
+mflo $1
+L218: 
+sw $9, -21($28)
+L219: lw $22, 0x52fe($27)
+add $25, $28, $11
+
+L220: mfhi $0
+mflo $25
+divu $19, $15
+beq $27, $22, L119
+mflo $4
+.word 0xce48423a
+
+sw $8, 0xa675($18)
+L221: .word L158
+beq $27, $30, L171
+.word L162
+beq $25, $22, L121 ; fwd
+; comment only
+sw $29, 0xbeff($22)
+L222: divu $13, $28
+.word 3333253217
+L223: beq $8, $7, L59 ; fwd
+jr $4
+jalr $3
+lis $3	;tab
+lis $3	;tab
+
+L224: bne $17, $28, L24
+L225: beq $15, $9, L246 ; fwd
+.word 0xc5883037
+; comment only
+beq $7, $13, L9 ; fwd
+add $20, $3, $8
+add $25, $22, $26
+mflo $15
+sw $8, -59($27)
+bne $7, $29, L212
+add $13, $27, $7
+L226: 
+add $25, $31, $14
+jalr $1
+bne $15, $25, L17
+L227: lis $3	;tab
+add $12, $15, $18
+L228: bne $0, $15, L31
+
+L229: lw $19, -38($27)
+beq $4, $14, L105 ; fwd
+bne $15, $3, L169
+mflo $27
+; comment only
+; comment only
+; comment only
+.word L158
+mult $12, $29
+lw $10, 0x39d4($2)
+add $7, $11, $23
+; comment only
+L230: sw $23, 0x3a5d($15)
+
+bne $9, $31, L193
+mflo $1
+bne $12, $23, L219
+.word 3996494929
+L231: 
+L232: lw $10, 29($29)
+mult $2, $16
+L233: ; comment only
+L234: .word 0x27e12995
+lw $10, -2($19)
+L235: 
+; comment only
+
+.word L43
+lis $23
+lw $29, 0xfd5f($18)
+add $24, $18, $10
+lw $2, 0xa3af($28)
+jalr $15
+L236: .word 0xcbafcbe5
+
+mflo $10
+div $3, $14
+beq $6, $24, L228 ; fwd
+divu $27, $24
+bne $15, $9, L15
+mult $15, $0
+sltu $13, $2, $14
+; comment only
+mflo $21
+beq $12, $23, L168
+jr $5
+div $3, $19
+
+sub $13, $24, $2
+.word -1800247485
+bne $29, $11, L112
+beq $20, $14, L4
+lis $23
+; comment only
+lis $3	;tab
+slt $18, $22, $29
+sltu $28, $4, $22
+.word L24
+L237: .word 1155102373
+
+L238: mfhi $3
+L239: jalr $22
+L240: add $2, $13, $28
+jr $31
+add $4, $1, $11
+.word L197
+
+L241: sltu $29, $24, $9
+jalr $22
+; comment only
+mfhi $2
+lis $26
+add $18, $4, $0
+div $26, $15
+
+add $3, $29, $18
+multu $12, $6
+; comment only
+L242: multu $19, $18
+.word 0xf1261152
+sltu $12, $21, $10
+lis $3	;tab
+multu $24, $21
+
+L243: 
+jr $21
+jr $8
+multu $23, $3
+add $28, $15, $26
+multu $10, $25
+beq $18, $31, L145 ; fwd
+.word L205
+
+L244: beq $29, $3, L178
+.word 0x4b8aa475
+
+.word 0x628a900a
+L245: beq $27, $27, L218 ; fwd
+sub $13, $1, $1
+add $12, $6, $28
+sub $12, $24, $22
+L246: sw $31, -43($23)
+div $11, $19
+bne $28, $31, L23
+
+beq $9, $4, L207
+sltu $21, $1, $12
+beq $23, $12, L158 ; fwd
+sub $24, $0, $20
+jr $29
+; comment only
+.word L130
+L247: beq $29, $1, L27 ; fwd
+bne $19, $29, L102
+L248: .word 0xd71161f
+mult $29, $24
+add $10, $30, $13
+.word 4017422242
+sw $13, 0xe808($28)
+lis $3	;tab
+jr $22
+add $25, $0, $27
+lis $3	;tab
+beq $17, $14, L136
+; comment only
+add $6, $3, $12
+
+beq $17, $24, L229 ; fwd
+
+beq $26, $13, L155 ; fwd
+sltu $26, $27, $1
+.word 0x5374b7ec
+bne $7, $5, L75
+bne $6, $2, L117
+L249: sw $3, 0x2bdf($12)
+lis $3	;tab
+sltu $11, $3, $27
+lis $3	;tab
+slt $6, $15, $27
+beq $19, $29, L72 ; fwd
+.word 0xf7eb1cc9
+add $18, $11, $12
+bne $26, $24, L33
+mflo $7
+mfhi $23
+lis $3	;tab
+bne $10, $13, L166
+lis $3	;tab
+add $30, $27, $18
+lis $3	;tab
+
+multu $17, $11
+.word 0x8c8374ea
+lis $3
+
+slt $25, $2, $22
+divu $8, $24
+.word 0x9673d263
+.word 3212472128
+beq $2, $7, L6 ; fwd
+lw $30, 0x1588($13)
+sltu $25, $12, $29
+.word L200
+
+.word 0x21d7ce4d
+beq $10, $24, L156 ; fwd
+lis $3	;tab
+lis $3	;tab
+jr $24
+add $12, $4, $18
+
+mflo $28
+add $19, $12, $5
+sw $22, -72($5)
+.word 1474033816
+slt $11, $24, $13
+bne $15, $13, L248
+beq $5, $10, L0
+mflo $31
+lis $3	;tab
+div $15, $1
+; comment only
+beq $29, $9, L67 ; fwd
+.word 3477037880
+.word 0x8ebf2ff7
+bne $22, $0, L199
+
+.word L71
+beq $19, $9, L202 ; fwd
+bne $5, $23, L19
+add $8, $3, $11
+lis $3	;tab
+beq $7, $15, L225 ; fwd
+mult $10, $26
+beq $21, $21, L167 ; fwd
+lis $17
+add $23, $12, $8
+add $14, $31, $30
+.word L13
+beq $23, $20, L72 ; fwd
+bne $25, $19, L5
+sub $1, $25, $29
+mflo $22
+add $18, $15, $24
+lis $3	;tab
+
+; comment only
+slt $0, $8, $15
+.word L106
+beq $27, $27, L37 ; fwd
+beq $2, $10, L200 ; fwd
+.word 4122890140
+mult $30, $11
+add $9, $19, $25
+; comment only
+beq $12, $0, L138
+add $27, $7, $28
+sw $24, 55($30)
+beq $14, $13, L242 ; fwd
+lw $2, 93($8)
+beq $11, $19, L176
+jr $23
+slt $23, $9, $14
+add $6, $30, $27
+beq $26, $23, L129
+beq $15, $13, L147 ; fwd
+sub $0, $11, $23
+lw $11, 0x6437($21)
+lw $14, -28($0)
+mflo $6
+; comment only
+sw $10, 0x9651($11)
+beq $19, $29, L181
+lw $3, -68($22)
+div $7, $14
+
+bne $8, $2, L105
+sub $27, $3, $25
+beq $19, $9, L40 ; fwd
+.word 0xd806e5e4
+sltu $9, $27, $1
+sltu $30, $1, $28
+add $25, $31, $22
+sltu $6, $30, $1
+beq $18, $13, L85 ; fwd
+
+lis $3	;tab
+.word -920169882
+.word 0xddefbfd2
+beq $30, $22, L135
+slt $28, $19, $22
+.word -826418092
+divu $11, $17
+sw $24, -73($2)
+sltu $2, $22, $7
+lw $17, -98($25)
+.word L249
+sw $24, 88($4)
+
+lis $3	;tab
+.word L222
+; comment only
+jalr $1
+.word 0x29d1db2b
+lis $3	;tab
+beq $15, $12, L205
+.word L249
+sltu $19, $12, $0
+; comment only
+
+slt $10, $15, $1
+bne $10, $27, L139
+bne $7, $25, L159
+sub $31, $31, $15
+beq $13, $17, L37 ; fwd
+lw $30, 0xae2($4)
+lis $3	;tab
+lis $3	;tab
+.word 0xd0586688
+divu $6, $23
+mfhi $23
+; comment only
+lis $3	;tab
+.word L45
+beq $20, $0, L200 ; fwd
+bne $18, $16, L201
+; comment only
+
+lis $3	;tab
+slt $19, $20, $0
+
+add $31, $16, $10
+lis $3	;tab
+beq $16, $24, L171 ; fwd
+add $17, $21, $9
+; comment only
+bne $21, $14, L42
+; comment only
+.word L117
+; comment only
+.word L86
+lis $21
+add $24, $1, $5
+sltu $16, $21, $23
+sw $24, -56($23)
+; comment only
+; comment only
+slt $18, $14, $22
+add $17, $21, $3
+lis $3	;tab
+divu $29, $29
+sw $5, -40($20)
+.word L28
+divu $3, $9
+.word L18
+lw $2, 0xcf70($31)
+slt $30, $21, $4
+beq $5, $24, L38
+.word L141
+jr $21
+sw $18, 0xe14e($12)
+; comment only
+mfhi $0
+lis $3	;tab
+lw $21, 0x8519($8)
+beq $17, $14, L84
+add $14, $5, $5
+sw $11, 0x136($13)
+mflo $9
+bne $5, $28, L34
+; comment only
+lis $3	;tab
+jalr $5
+lis $3	;tab
+; comment only
+mfhi $12
+beq $20, $20, L100 ; fwd
+beq $27, $3, L196 ; fwd
+
+add $17, $11, $9
+slt $28, $15, $16
+bne $28, $31, L235
+lis $3	;tab
+lis $3	;tab
+lis $3	;tab
+div $12, $23
+add $7, $6, $18
+; comment only
+.word L22
+; comment only
+divu $27, $6
+sw $19, 0x36eb($17)
+mfhi $7
+.word L157
+sw $8, 0xbf52($9)
+.word 3848059873
+lis $3	;tab
+.word L12
+
+div $3, $29
+; comment only
+add $22, $6, $2
+lis $3	;tab
+.word 0x1b203c58
+
+.word 504276022
+.word L147
+add $17, $16, $19
+.word 3591482694
+; comment only
+; comment only
+.word 3603507937
+beq $29, $25, L22
+.word L7
+lw $10, 0x1ca7($14)
+lis $3	;tab
+beq $11, $31, L100
+div $17, $24
+.word L83
+
+sltu $13, $4, $20
+.word L59
+beq $1, $27, L138
+.word L199
+.word 2666049488
+slt $16, $23, $13
+beq $9, $15, L201 ; fwd
+.word L26
+jalr $19
+
+beq $3, $24, L104 ; fwd
+add $11, $20, $8
+lis $3	;tab
+div $0, $8
+beq $23, $11, L147 ; fwd
+
+.word 2691205805
+lis $3	;tab
+lis $3	;tab
+.word L37
+.word 593420662
+div $3, $19
+beq $31, $6, L122 ; fwd
+bne $0, $5, L208
+mfhi $28
+
+add $11, $27, $5
+beq $6, $2, L224 ; fwd
+.word L236
+beq $5, $20, L84 ; fwd
+mult $18, $25
+
+; comment only
+mflo $27
+.word L38
+lis $3	;tab
+.word L133
+beq $25, $12, L61 ; fwd
+.word L207
+; comment only
+
+lis $3	;tab
+add $6, $8, $14
+sw $26, 0x1b68($2)
+add $24, $22, $20
+; comment only
+.word 0x73f9c053
+
+slt $31, $10, $14
+jalr $4
+lis $3	;tab
+add $23, $17, $29
+lw $13, 0x5807($6)
+
+bne $29, $20, L8
+divu $12, $2
+.word L128
+mfhi $29
+.word L2
+lis $19
+sub $4, $16, $29
+; comment only
+add $2, $27, $4
+.word L212
+; comment only
+divu $25, $18
+beq $7, $1, L90
+
+add $21, $10, $12
+jalr $1
+mfhi $4
+mult $17, $29
+.word L249
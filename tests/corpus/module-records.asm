@@ -0,0 +1,8 @@
+.import foo
+.import bar
+.export baz
+baz: .word foo
+.word bar
+.word baz
+beq $0,$0,baz
+.word foo
@@ -0,0 +1,2001 @@
+L0: slt $7, $31, $28
+.word 1240057366
+.word 4006204038
+slt $1, $1, $1
+add $24, $13, $27
+; comment only
+.word L0
+beq $14, $29, L0
+; comment only
+sub $18, $7, $21
+lis $3	;tab
+.word 0xda711448
+.word 0x2c4a3698
+L1: beq $6, $10, L133 ; fwd
+bne $1, $30, 0x4efb
+multu $0, $12
+; comment only
+; comment only
+
+lw $24, 89($13)
+add $30, $23, $12
+.word 0x5b569643
+L2: ; comment only
+
+
+L3: mflo $11
+; comment only
+lw $4, -79($28)
+L4: lw $17, -72($22)
+multu $16, $10
+beq $18, $29, L179 ; fwd
+.word L0
+L5: .word 0xcbd3f5e0
+L6: lis $3	;tab
+jalr $27
+add $14, $1, $25
+L7: lis $3	;tab
+.word L6
+jalr $28
+beq $1, $25, L172 ; fwd
+bne $3, $19, L3
+lw $4, 0xeacc($10)
+lw $0, 43($13)
+
+lis $3	;tab
+add $24, $12, $22
+L8: 
+.word 0x7e0ab2ed
+.word L0
+.word 1716605109
+
+bne $13, $17, L6
+bne $15, $4, L1
+L9: multu $17, $21
+sw $21, 0x1d29($15)
+
+lis $3	;tab
+mult $20, $2
+.word 0xd418f7af
+L10: 
+.word 2476699920
+bne $7, $29, 0x1b94
+L11: lw $0, -77($2)
+
+slt $10, $15, $10
+slt $24, $18, $16
+beq $13, $20, L0
+sw $28, 0x5033($4)
+L12: bne $7, $16, L9
+; comment only
+.word L10
+multu $19, $12
+slt $5, $28, $5
+beq $21, $14, L99 ; fwd
+add $20, $11, $20
+
+lw $21, -75($15)
+jr $4
+sltu $4, $1, $0
+bne $30, $9, L12
+sltu $11, $11, $9
+bne $6, $18, L3
+L13: lis $3	;tab
+L14: beq $11, $19, L5
+L15: beq $15, $16, L199 ; fwd
+L16: .word L13
+; comment only
+; comment only
+.word 0x2be893f4
+L17: beq $26, $1, L15 ; fwd
+
+L18: multu $16, $17
+.word 0x16d8e80e
+L19: ; comment only
+beq $28, $14, L61 ; fwd
+beq $30, $14, L182 ; fwd
+; comment only
+lis $3	;tab
+lw $3, 0xc360($10)
+lis $19
+; comment only
+lis $3	;tab
+.word L19
+L20: sltu $24, $11, $9
+jalr $3
+.word 0xfb314da0
+lw $8, 98($28)
+jr $27
+bne $8, $31, L13
+.word 0xa9172a05
+lis $3	;tab
+jalr $28
+add $15, $16, $13
+multu $17, $19
+sw $10, 0x5b61($26)
+jalr $24
+sub $7, $0, $18
+lis $3	;tab
+mult $23, $19
+beq $22, $20, L0 ; fwd
+L21: lis $3	;tab
+sw $21, 0xaef4($7)
+.word 0x8e903fd9
+lis $3	;tab
+lis $3	;tab
+.word L19
+.word 0xb3f0b94c
+; comment only
+; comment only
+L22: .word 0xf86668c1
+
+lis $3	;tab
+lis $3	;tab
+L23: lis $3	;tab
+beq $18, $1, L104 ; fwd
+divu $17, $11
+
+L24: sw $19, 0x764a($31)
+; comment only
+L25: ; comment only
+L26: 
+beq $28, $1, L22
+lis $3	;tab
+L27: beq $17, $19, L53 ; fwd
+lis $17
+L28: lis $3	;tab
+; comment only
+.word L16
+add $10, $19, $17
+lis $3	;tab
+; comment only
+.word L25
+
+lis $15
+add $25, $20, $27
+lis $12
+L29: lis $3	;tab
+
+lis $3	;tab
+L30: sw $10, -65($28)
+.word 0xb7d9365c
+L31: jr $20
+sub $2, $3, $1
+mfhi $31
+lis $3	;tab
+
+beq $17, $7, L156 ; fwd
+sub $25, $14, $31
+multu $15, $18
+
+.word L16
+
+L32: mfhi $2
+L33: add $30, $20, $24
+lw $25, -60($1)
+L34: mult $24, $16
+L35: .word L19
+add $3, $8, $2
+slt $5, $12, $1
+div $12, $28
+beq $17, $16, L164 ; fwd
+mfhi $11
+
+beq $3, $22, L140 ; fwd
+jalr $27
+sltu $17, $4, $16
+sub $3, $13, $27
+add $5, $30, $23
+L36: beq $8, $2, L8
+lis $3	;tab
+.word L1
+lw $16, 0x15f6($2)
+add $16, $20, $8
+.word 0x4dc232a6
+; comment only
+bne $25, $30, L28
+; comment only
+
+; comment only
+L37: lw $12, 0x63a5($6)
+mult $2, $19
+beq $20, $26, L76 ; fwd
+sw $0, 34($20)
+bne $4, $28, L29
+lis $3	;tab
+sltu $3, $8, $3
+
+lw $21, 0xfd98($25)
+
+; comment only
+add $9, $16, $14
+sub $26, $3, $6
+beq $17, $6, L52 ; fwd
+beq $5, $4, L203 ; fwd
+beq $11, $27, L5 ; fwd
+.word L18
+jalr $31
+jr $28
+; comment only
+jr $4
+sw $12, 0xbf2d($31)
+L38: 
+
+add $22, $29, $0
+lw $7, 0x8332($18)
+; comment only
+; comment only
+beq $19, $28, L77 ; fwd
+L39: .word L37
+L40: div $0, $27
+
+L41: .word -420310291
+add $24, $17, $29
+bne $21, $24, L7
+divu $9, $1
+sw $8, 0xc941($26)
+; comment only
+.word 0x6efa083b
+.word L25
+sub $8, $13, $9
+add $6, $16, $9
+slt $11, $0, $5
+add $13, $27, $22
+L42: beq $6, $26, L213 ; fwd
+slt $17, $11, $30
+lis $3	;tab
+mfhi $24
+L43: .word L18
+.word L25
+L44: .word L6
+L45: 
+mflo $16
+; comment only
+.word L40
+; comment only
+
+.word L6
+L46: lis $3	;tab
+lis $3	;tab
+; comment only
+lw $14, 0x4649($15)
+div $12, $26
+
+add $9, $26, $17
+lis $3	;tab
+.word L13
+
+beq $11, $28, L3
+; comment only
+beq $13, $20, L159 ; fwd
+beq $8, $8, L14
+L47: ; comment only
+add $11, $7, $14
+; comment only
+sw $20, -99($19)
+mfhi $14
+beq $21, $17, L153 ; fwd
+.word -2048163483
+L48: mult $22, $4
+L49: slt $20, $15, $17
+beq $5, $8, L46
+mfhi $21
+; comment only
+slt $8, $17, $25
+L50: 
+; comment only
+.word 0xe5f84260
+add $7, $11, $15
+.word 0x51dcf52
+sw $8, 3($23)
+L51: ; comment only
+; comment only
+lis $3	;tab
+
+L52: sw $8, -61($13)
+bne $18, $10, L50
+.word L25
+L53: 
+L54: lw $0, 0x21f0($6)
+.word 0xeefb98a9
+.word L3
+L55: add $0, $2, $7
+; comment only
+bne $22, $30, L51
+sltu $22, $10, $7
+lis $3	;tab
+lis $3	;tab
+beq $3, $27, L106 ; fwd
+sw $28, 79($3)
+sltu $11, $31, $21
+sltu $1, $30, $13
+divu $14, $6
+beq $29, $30, L41
+lis $3	;tab
+.word 0x8ac21475
+multu $0, $24
+add $4, $11, $29
+beq $18, $9, L39 ; fwd
+slt $1, $29, $25
+lis $3	;tab
+jalr $25
+; comment only
+.word 0xa98a6ddc
+sltu $10, $11, $24
+; comment only
+mfhi $12
+lis $3	;tab
+; comment only
+L56: .word 0xa4d5daf8
+L57: sltu $30, $2, $15
+add $19, $29, $17
+multu $20, $28
+.word 0xb2e9ed25
+.word L52
+div $17, $11
+
+L58: bne $9, $16, L22
+
+multu $16, $14
+
+jalr $27
+jalr $8
+.word 908504469
+add $1, $25, $24
+multu $4, $15
+div $12, $25
+multu $19, $9
+; comment only
+; comment only
+jr $1
+
+
+.word L16
+add $20, $10, $8
+beq $6, $7, L218 ; fwd
+
+jalr $25
+L59: lis $3	;tab
+.word 74927169
+jalr $24
+; comment only
+lw $10, 71($26)
+beq $26, $25, L69 ; fwd
+beq $8, $11, L143 ; fwd
+L60: add $31, $13, $25
+; comment only
+beq $6, $4, L2
+.word L12
+
+; comment only
+beq $14, $23, L37
+slt $3, $29, $2
+multu $18, $30
+L61: ; comment only
+L62: 
+.word 0x64f62cde
+add $30, $1, $27
+lis $3	;tab
+div $4, $23
+; comment only
+
+add $0, $6, $21
+beq $23, $4, L10
+.word L21
+; comment only
+L63: div $23, $13
+L64: 
+L65: slt $20, $26, $23
+sw $2, 82($16)
+.word 216411837
+sw $5, 0x484d($15)
+sw $3, 0x831c($13)
+sltu $20, $21, $18
+mult $28, $23
+add $1, $20, $26
+; comment only
+L66: 
+beq $27, $11, L249 ; fwd
+mfhi $8
+; comment only
+L67: sw $12, 0x5c7e($21)
+
+mfhi $0
+add $10, $16, $2
+L68: sltu $11, $2, $12
+lw $31, 0x5f12($25)
+sub $11, $12, $19
+
+.word L46
+L69: add $6, $27, $21
+beq $26, $12, L179 ; fwd
+.word L64
+
+
+.word L60
+sw $25, 0x8a2a($16)
+
+.word L58
+jalr $28
+.word L42
+beq $9, $24, L220 ; fwd
+beq $7, $22, L223 ; fwd
+add $16, $3, $19
+bne $19, $3, L10
+beq $4, $8, L199 ; fwd
+.word 461438685
+; comment only
+beq $23, $19, L75 ; fwd
+; comment only
+sub $26, $14, $2
+beq $14, $15, L182 ; fwd
+jalr $9
+sw $0, 0xb458($28)
+beq $9, $1, L94 ; fwd
+bne $20, $7, L37
+beq $17, $27, L2 ; fwd
+sltu $31, $7, $14
+lis $3	;tab
+sw $23, -41($10)
+L70: add $4, $13, $0
+.word 1514067890
+L71: bne $1, $0, L60
+sw $14, 0x35f3($3)
+; comment only
+add $21, $20, $26
+L72: 
+beq $5, $11, L55 ; fwd
+lw $3, -20($4)
+multu $2, $18
+add $5, $28, $12
+beq $11, $7, L14 ; fwd
+lis $3	;tab
+sltu $14, $18, $16
+mfhi $16
+bne $22, $29, L48
+.word 0xee862ab4
+mult $15, $4
+.word 0x8842c61c
+bne $29, $23, L50
+; comment only
+L73: div $10, $19
+; comment only
+multu $29, $9
+L74: sltu $16, $15, $22
+div $30, $19
+L75: div $28, $6
+beq $20, $4, L175 ; fwd
+; comment only
+L76: add $12, $22, $23
+bne $21, $7, L48
+L77: lw $3, 0xd676($20)
+lis $3
+lw $12, -76($14)
+lw $10, 0x134d($27)
+.word L74
+div $12, $27
+lw $14, 95($13)
+L78: .word L46
+beq $15, $13, L25
+mult $13, $20
+; comment only
+L79: add $23, $31, $22
+L80: sltu $20, $19, $20
+
+L81: bne $4, $16, -42
+add $11, $20, $14
+sw $31, 6($18)
+lw $7, 10($17)
+beq $31, $18, L155 ; fwd
+div $9, $22
+L82: beq $25, $28, L61
+mfhi $15
+L83: sub $30, $30, $20
+divu $25, $0
+lis $3	;tab
+lis $3	;tab
+
+add $23, $22, $28
+beq $19, $5, L113 ; fwd
+beq $10, $8, L5
+
+divu $30, $0
+
+L84: beq $10, $13, L102 ; fwd
+slt $16, $8, $10
+div $14, $27
+; comment only
+div $13, $18
+beq $0, $21, L30 ; fwd
+lis $3	;tab
+lis $3	;tab
+.word L57
+.word L46
+add $5, $6, $6
+divu $25, $11
+; comment only
+add $12, $28, $31
+beq $17, $11, L71
+L85: beq $4, $14, L114 ; fwd
+.word L42
+slt $3, $29, $17
+.word L42
+divu $27, $30
+beq $22, $8, L28
+jr $9
+L86: slt $3, $29, $9
+; comment only
+sw $0, 0x7cb3($19)
+sw $20, 92($6)
+.word L19
+; comment only
+L87: bne $31, $21, L40
+.word L41
+.word 1750944376
+mfhi $20
+add $21, $26, $1
+bne $13, $18, L50
+.word -1393170257
+
+lis $6
+beq $26, $9, L22
+divu $27, $20
+beq $17, $13, L49 ; fwd
+; comment only
+mult $28, $8
+bne $8, $1, L22
+lis $3	;tab
+.word L4
+sub $30, $9, $13
+div $22, $4
+add $29, $12, $15
+add $19, $2, $17
+mfhi $6
+slt $21, $6, $28
+
+beq $30, $17, L36 ; fwd
+beq $22, $24, L105 ; fwd
+; comment only
+mfhi $9
+add $15, $25, $29
+.word L72
+L88: mult $2, $27
+sw $8, 0xb1f8($26)
+
+; comment only
+lis $3	;tab
+beq $22, $7, L81
+L89: mult $23, $8
+add $30, $1, $30
+L90: 
+.word L69
+sub $25, $26, $15
+; comment only
+lis $3	;tab
+sub $13, $23, $6
+L91: sub $7, $5, $0
+mfhi $19
+add $27, $19, $25
+beq $1, $17, L232 ; fwd
+.word L28
+bne $28, $3, L22
+.word L58
+
+; comment only
+.word 0x98cc92ac
+lis $1
+L92: divu $7, $23
+sw $8, -73($29)
+.word L60
+bne $8, $0, L34
+slt $18, $0, $17
+; comment only
+
+sltu $20, $28, $5
+; comment only
+beq $2, $12, L43 ; fwd
+L93: sub $7, $19, $12
+multu $13, $5
+lis $3	;tab
+.word 3293467686
+L94: 
+add $27, $18, $30
+sub $13, $2, $27
+.word 3671264157
+mfhi $23
+L95: .word L41
+lis $9
+lis $3	;tab
+slt $0, $30, $19
+lis $3	;tab
+mflo $24
+.word 4110547168
+.word L82
+L96: sw $12, 32($15)
+
+L97: .word L45
+
+
+; comment only
+add $25, $9, $27
+L98: sw $27, 63($17)
+.word 3282985291
+; comment only
+beq $1, $6, L197 ; fwd
+lw $18, -65($26)
+.word 0xf872d5c5
+jalr $1
+add $26, $5, $15
+.word L10
+add $22, $2, $4
+L99: add $19, $22, $19
+L100: .word L79
+beq $22, $15, L29
+beq $13, $19, L244 ; fwd
+; comment only
+lw $30, -36($9)
+mult $16, $25
+mult $20, $24
+mflo $2
+.word 0xa3233a20
+sub $14, $7, $29
+; comment only
+
+.word L55
+mfhi $15
+; comment only
+sw $22, -32($1)
+beq $28, $2, L52 ; fwd
+L101: .word L84
+mfhi $12
+L102: beq $8, $1, L112 ; fwd
+add $14, $30, $11
+add $14, $8, $4
+L103: div $5, $16
+add $17, $22, $16
+.word 0x8884dcee
+L104: .word L72
+
+add $3, $20, $9
+.word 2322953465
+L105: .word 197235593
+sw $19, 0x5db($12)
+lis $3	;tab
+multu $5, $13
+add $25, $18, $0
+sub $27, $30, $11
+jalr $29
+sltu $25, $14, $4
+L106: ; comment only
+; comment only
+.word 0x716d389a
+
+
+div $4, $1
+
+.word L14
+jr $22
+beq $17, $21, L21
+sw $15, 0xbff8($1)
+lw $18, -34($20)
+beq $11, $14, L75 ; fwd
+divu $23, $25
+.word L103
+beq $6, $31, L144 ; fwd
+L107: beq $2, $3, L4 ; fwd
+sw $11, 0x7a34($1)
+beq $14, $22, L91
+L108: .word L65
+multu $14, $5
+div $0, $29
+
+add $27, $14, $16
+.word L24
+
+.word 0x82e9f4ac
+
+slt $26, $10, $27
+; comment only
+; comment only
+
+.word 0xb52774fb
+lw $22, 38($16)
+L109: beq $4, $16, L181 ; fwd
+div $16, $31
+L110: .word L14
+slt $3, $11, $4
+L111: ; comment only
+.word L100
+L112: lw $30, 89($22)
+slt $20, $24, $24
+jr $22
+.word 4019364955
+bne $24, $4, L101
+
+multu $7, $13
+lis $3	;tab
+
+beq $10, $13, L76 ; fwd
+lis $3	;tab
+L113: .word -318934189
+L114: mflo $13
+.word L65
+.word 3598976785
+; comment only
+mult $0, $4
+L115: lw $29, 0xb6af($16)
+sltu $25, $29, $15
+L116: lis $3	;tab
+beq $1, $24, L163 ; fwd
+L117: beq $28, $20, L97
+lis $3	;tab
+lis $3	;tab
+lis $3	;tab
+L118: beq $28, $6, L108 ; fwd
+sltu $1, $0, $26
+beq $25, $2, 0xedab
+; comment only
+.word 0x91fd3e7b
+
+beq $2, $25, L138 ; fwd
+.word 0x52f14880
+; comment only
+beq $8, $5, L154 ; fwd
+
+.word 0x4a695073
+slt $0, $7, $6
+divu $15, $15
+L119: sub $6, $2, $7
+L120: .word 2776877484
+.word 1380144130
+
+; comment only
+
+beq $3, $0, L12
+add $3, $17, $19
+
+sw $24, -70($19)
+mult $23, $28
+L121: .word 0x1d249fb5
+lis $9
+
+L122: lis $3	;tab
+beq $26, $21, L79
+lw $18, 0x83e1($12)
+mflo $24
+add $31, $8, $27
+sltu $17, $6, $14
+L123: .word -1536710845
+sw $20, 0xbf37($9)
+L124: sw $1, -13($12)
+mfhi $27
+lis $3	;tab
+mfhi $0
+bne $26, $21, L88
+.word 3332289066
+bne $1, $6, L121
+L125: 
+; comment only
+sw $25, 59($25)
+
+.word L85
+.word L12
+beq $10, $31, L55 ; fwd
+; comment only
+sw $8, 0xd2be($30)
+L126: bne $13, $17, 0x4f83
+
+sw $10, 0x435c($9)
+beq $28, $31, L184 ; fwd
+.word 0x9534e4ce
+L127: lis $3	;tab
+.word 1267822690
+
+.word 0x156b7e23
+L128: .word L6
+lis $3	;tab
+beq $13, $27, L74 ; fwd
+add $2, $31, $24
+; comment only
+beq $7, $24, L73 ; fwd
+add $14, $21, $26
+.word L52
+beq $5, $21, L203 ; fwd
+beq $11, $15, L132 ; fwd
+.word L18
+.word 766704267
+lw $11, 0x40ac($27)
+lw $30, 0xd10c($13)
+L129: beq $25, $0, L145 ; fwd
+add $24, $21, $6
+
+sub $24, $1, $14
+beq $1, $0, L135 ; fwd
+
+mult $25, $26
+mfhi $28
+bne $12, $16, L74
+lis $3	;tab
+L130: beq $17, $23, L148 ; fwd
+; comment only
+jalr $1
+L131: lw $20, -44($14)
+lw $16, -4($9)
+.word 0xd9e3f8a9
+beq $18, $17, L39
+beq $24, $3, L19
+jr $19
+L132: beq $31, $27, L93
+lis $3	;tab
+jr $25
+sub $10, $21, $23
+lis $3	;tab
+.word -1924417161
+lis $3	;tab
+multu $14, $6
+bne $10, $24, L123
+mult $12, $15
+slt $0, $0, $23
+mfhi $19
+multu $4, $10
+lw $4, -51($26)
+.word 0x9a6d12ac
+sltu $9, $15, $12
+lis $3	;tab
+; comment only
+sltu $23, $5, $22
+divu $27, $14
+; comment only
+.word 0x5e233373
+.word 3575829325
+
+beq $29, $23, L90 ; fwd
+jalr $30
+
+
+sltu $5, $14, $27
+beq $19, $31, L183 ; fwd
+L133: mfhi $19
+
+add $29, $20, $26
+sub $3, $24, $10
+add $31, $31, $23
+.word 0xaa84e1a2
+; comment only
+; comment only
+beq $12, $20, L9 ; fwd
+divu $11, $28
+L134: sw $5, 31($24)
+beq $2, $26, L123
+multu $12, $21
+sw $15, 94($18)
+L135: 
+add $20, $5, $11
+slt $8, $2, $8
+beq $22, $28, L191 ; fwd
+.word 0xcdb7c116
+lw $22, -5($6)
+.word 3464721468
+beq $2, $3, L46
+beq $17, $17, L63
+add $8, $26, $22
+.word L9
+sw $15, 0x8497($16)
+L136: divu $9, $22
+L137: 
+jalr $9
+.word 2743838782
+L138: 
+sub $2, $17, $17
+mult $4, $29
+.word 0x2238872a
+.word L89
+.word L47
+add $19, $14, $3
+add $5, $29, $0
+beq $15, $8, L182 ; fwd
+lis $3	;tab
+.word 3103065803
+mult $21, $22
+L139: ; comment only
+bne $5, $27, L42
+slt $11, $31, $5
+.word 0xa2474cdb
+bne $27, $4, L105
+lis $3	;tab
+lis $3	;tab
+L140: beq $14, $19, L35
+lis $3	;tab
+add $10, $19, $3
+slt $7, $11, $28
+jr $27
+L141: .word L92
+lis $3	;tab
+sltu $27, $8, $14
+sltu $23, $11, $3
+mfhi $22
+lis $3	;tab
+beq $26, $26, L42 ; fwd
+add $14, $3, $9
+sub $9, $17, $14
+lis $3	;tab
+L142: sw $22, 52($3)
+.word L9
+bne $19, $24, L98
+beq $7, $0, L182 ; fwd
+L143: sub $7, $0, $15
+sub $21, $13, $18
+.word L119
+
+jr $24
+L144: add $4, $19, $28
+sw $11, 0x9b50($24)
+lis $3	;tab
+jr $0
+.word L126
+beq $7, $13, L99
+add $11, $24, $27
+mult $10, $2
+jalr $29
+sw $30, 0x561($27)
+beq $22, $27, L182 ; fwd
+lis $13
+
+sw $18, 0xde37($4)
+L145: bne $18, $14, L81
+div $15, $26
+beq $27, $25, L57 ; fwd
+L146: sub $29, $24, $14
+.word 0x2659d491
+beq $19, $26, L141 ; fwd
+L147: lis $3	;tab
+sub $31, $27, $7
+bne $19, $2, L115
+L148: lw $16, 91($18)
+beq $2, $8, L82
+.word L42
+lw $1, 0x8a0f($1)
+; comment only
+.word 0x91cacc83
+L149: lis $2
+.word L138
+add $8, $30, $30
+beq $6, $26, L115 ; fwd
+lw $3, 0x2765($12)
+L150: beq $21, $6, L81
+div $5, $13
+lw $31, 0x7614($24)
+beq $30, $11, L214 ; fwd
+mult $11, $19
+beq $9, $13, L219 ; fwd
+lis $3	;tab
+.word L35
+L151: .word L129
+.word 0x6fa7c7d3
+beq $12, $24, L9 ; fwd
+lw $28, 0x27b6($28)
+beq $3, $22, L181 ; fwd
+div $31, $21
+
+lis $3	;tab
+beq $25, $4, L18 ; fwd
+L152: add $4, $5, $8
+add $13, $27, $21
+beq $22, $12, L211 ; fwd
+divu $5, $22
+L153: .word L85
+sub $3, $9, $26
+
+mfhi $10
+; comment only
+L154: lis $3	;tab
+
+lw $28, 0xb3b($10)
+add $20, $1, $9
+lis $31
+sub $18, $1, $15
+beq $11, $15, L151 ; fwd
+sub $12, $23, $10
+sub $19, $14, $24
+lw $19, -65($19)
+jr $25
+sub $25, $30, $0
+lis $3	;tab
+beq $13, $30, L51
+; comment only
+divu $12, $23
+add $15, $7, $23
+L155: add $13, $27, $21
+.word L113
+beq $28, $23, L10 ; fwd
+beq $16, $8, L211 ; fwd
+lis $3	;tab
+L156: .word 1453156477
+beq $14, $12, L240 ; fwd
+.word -1310209895
+beq $15, $17, L78 ; fwd
+beq $7, $0, L89 ; fwd
+divu $31, $29
+beq $7, $14, L153 ; fwd
+sub $10, $12, $27
+L157: .word 3869266490
+; comment only
+
+lis $3	;tab
+bne $0, $7, L69
+L158: ; comment only
+add $31, $20, $27
+
+; comment only
+; comment only
+L159: lw $20, -49($10)
+
+lis $3	;tab
+L160: lw $17, 46($29)
+add $9, $19, $8
+L161: add $29, $31, $2
+lis $3	;tab
+sw $29, 0xa7a1($26)
+L162: lw $18, -34($8)
+lis $6
+lis $3	;tab
+mult $31, $4
+beq $9, $29, L103 ; fwd
+beq $18, $31, L249 ; fwd
+; comment only
+L163: beq $5, $13, L155 ; fwd
+lis $3	;tab
+; comment only
+L164: multu $27, $2
+L165: beq $19, $16, L185 ; fwd
+sw $25, 0x7033($20)
+
+multu $30, $16
+lis $3	;tab
+
+add $18, $31, $22
+.word L37
+lis $3	;tab
+multu $21, $4
+
+beq $26, $26, L56
+beq $30, $22, L20 ; fwd
+.word L100
+add $27, $16, $31
+beq $13, $24, L82
+L166: beq $28, $9, L240 ; fwd
+mult $12, $25
+lis $3	;tab
+lw $27, -80($20)
+lw $19, 0x5998($20)
+lis $3	;tab
+beq $23, $2, L210 ; fwd
+lis $3	;tab
+
+lw $16, 0x1c43($29)
+sw $9, 26($24)
+beq $29, $15, L38
+div $22, $14
+lis $3	;tab
+jalr $3
+sw $29, 0x5d7c($27)
+L167: lis $3
+beq $24, $31, L84 ; fwd
+L168: mfhi $17
+.word L119
+; comment only
+L169: 
+; comment only
+sltu $8, $26, $5
+.word -1734038986
+L170: beq $7, $6, L20 ; fwd
+sltu $23, $26, $25
+L171: beq $28, $19, L190 ; fwd
+.word L101
+
+L172: 
+slt $17, $9, $16
+add $6, $10, $2
+L173: bne $2, $10, L158
+.word -422027462
+L174: ; comment only
+.word 1906065857
+multu $9, $15
+mfhi $13
+.word L93
+.word 133398288
+lw $20, -73($27)
+; comment only
+; comment only
+sltu $5, $22, $25
+.word 27962376
+.word L82
+sub $22, $4, $11
+sub $9, $29, $4
+sw $23, -53($18)
+; comment only
+.word L152
+mfhi $19
+mflo $11
+lw $25, 0xcc09($11)
+.word 775655096
+; comment only
+divu $8, $18
+div $21, $16
+multu $16, $13
+add $3, $2, $29
+; comment only
+beq $7, $4, L154 ; fwd
+L175: mflo $1
+divu $20, $3
+; comment only
+lw $3, 0x1d1a($31)
+beq $19, $9, L107
+add $0, $23, $11
+L176: mult $2, $1
+add $18, $30, $31
+sub $11, $22, $5
+div $12, $29
+beq $15, $14, L22
+; comment only
+sltu $23, $15, $18
+beq $19, $7, L230 ; fwd
+.word -1238012656
+.word 0x4d2c6ae0
+sub $23, $29, $30
+.word 1661833374
+beq $2, $25, L27
+lis $30
+
+L177: lis $3	;tab
+.word L127
+lis $16
+lw $20, 0x5776($12)
+.word -1241274909
+add $24, $8, $25
+; comment only
+mult $14, $12
+.word 0xdf58b8db
+L178: .word 0x4273800d
+L179: .word L103
+.word L20
+
+L180: bne $21, $22, L64
+.word 2737513587
+
+L181: beq $6, $13, L131
+; comment only
+bne $27, $14, L97
+L182: .word L32
+beq $29, $26, L67
+L183: .word L170
+L184: lis $3	;tab
+add $23, $27, $15
+lis $3	;tab
+bne $0, $9, L61
+sub $17, $23, $14
+divu $22, $23
+add $11, $24, $22
+; comment only
+.word 3445612970
+L185: ; comment only
+lw $27, 42($15)
+.word 0x49aafc9e
+slt $14, $12, $30
+L186: beq $2, $5, L113
+L187: add $28, $8, $5
+sub $9, $31, $8
+.word -89075538
+; comment only
+
+jalr $9
+.word 0xc7531b1c
+.word 0x106623d1
+add $6, $19, $14
+.word 2203851322
+slt $28, $19, $2
+L188: .word L159
+; comment only
+L189: lw $31, 0xa985($9)
+L190: .word 0xfddb5885
+.word 0x390d69b2
+; comment only
+sub $1, $14, $21
+jalr $10
+; comment only
+sw $21, 0x6c79($13)
+L191: 
+multu $24, $0
+sw $13, 4($15)
+beq $12, $26, L146 ; fwd
+mult $13, $6
+L192: divu $23, $11
+beq $10, $10, L228 ; fwd
+divu $5, $28
+sw $22, 13($14)
+lw $27, 0xb692($15)
+.word L105
+.word L131
+beq $14, $14, L108
+L193: slt $27, $24, $29
+L194: mfhi $25
+lis $3	;tab
+; comment only
+; comment only
+; comment only
+beq $24, $18, L94
+divu $15, $12
+L195: mfhi $16
+lis $3	;tab
+beq $16, $2, L239 ; fwd
+.word 1812679969
+mflo $9
+beq $18, $28, L108 ; fwd
+bne $16, $14, L190
+
+beq $6, $8, L63 ; fwd
+divu $25, $16
+.word 3503713652
+.word 0x8d479e23
+sub $24, $7, $24
+
+jr $30
+mult $22, $3
+.word L34
+.word 3014195853
+.word L71
+; comment only
+lis $3	;tab
+.word 1782788750
+.word 0x621f646
+div $8, $10
+; comment only
+beq $19, $28, L159 ; fwd
+mfhi $13
+bne $24, $2, L22
+div $19, $11
+L196: .word L118
+beq $8, $15, L171
+L197: lis $19
+.word L85
+.word L4
+.word L33
+L198: .word 0x60b37275
+lis $3	;tab
+L199: beq $30, $21, L92 ; fwd
+sub $20, $10, $8
+L200: .word L61
+
+lis $3	;tab
+L201: add $0, $30, $29
+.word -1104326685
+mfhi $6
+beq $18, $31, L193 ; fwd
+lw $29, 0x47f9($19)
+; comment only
+add $19, $12, $16
+lis $3	;tab
+; comment only
+add $20, $29, $7
+L202: bne $2, $8, L166
+bne $25, $11, L119
+multu $30, $10
+; comment only
+lw $29, 0x96d4($31)
+lis $3	;tab
+L203: ; comment only
+.word L146
+multu $2, $19
+beq $29, $16, L145 ; fwd
+bne $2, $11, L127
+beq $23, $16, L185 ; fwd
+mfhi $16
+; comment only
+sw $30, 80($5)
+; comment only
+; comment only
+
+bne $4, $14, L43
+L204: lis $3	;tab
+
+beq $12, $29, L170 ; fwd
+mult $12, $3
+L205: .word 1220642700
+mult $27, $2
+.word 0x99d2012c
+sltu $20, $31, $0
+.word 0x6041399a
+jr $31
+beq $3, $26, L150
+lis $3	;tab
+L206: mflo $31
+beq $23, $23, L20
+.word 0x243977eb
+add $5, $8, $8
+mflo $28
+beq $19, $11, L146
+beq $7, $2, L191 ; fwd
+L207: beq $18, $13, L14 ; fwd
+
+; comment only
+lis $3	;tab
+sw $28, 19($21)
+L208: lw $2, -40($11)
+.word 1674093396
+jr $9
+lis $3	;tab
+slt $28, $22, $1
+.word L163
+add $15, $18, $11
+.word L17
+beq $16, $19, L139
+add $20, $5, $9
+lis $3	;tab
+L209: beq $1, $0, L15 ; fwd
+L210: ; comment only
+.word L12
+; comment only
+; comment only
+L211: .word L145
+beq $1, $17, L91 ; fwd
+beq $11, $11, L1
+jalr $14
+.word L31
+beq $31, $6, L184 ; fwd
+; comment only
+; comment only
+slt $5, $7, $20
+
+sw $18, 0x819c($29)
+sw $4, 0xfcf3($2)
+.word 0xb79b819d
+
+mflo $24
+slt $8, $16, $2
+lis $5
+.word 0x7c74334f
+sltu $29, $2, $27
+
+lw $8, -4($1)
+add $28, $0, $22
+.word L83
+multu $28, $13
+.word 0x715fd11d
+beq $5, $4, L135 ; fwd
+
+mfhi $31
+L212: ; comment only
+sltu $20, $24, $14
+.word L58
+L213: slt $16, $19, $1
+beq $24, $15, L110 ; fwd
+
+.word L65
+; comment only
+sltu $7, $24, $7
+.word 0x581ce44a
+.word L122
+beq $10, $25, L10 ; fwd
+beq $25, $24, L115 ; fwd
+L214: beq $15, $8, L18 ; fwd
+mfhi $29
+beq $25, $27, L6 ; fwd
+add $2, $31, $26
+L215: 
+jalr $24
+sltu $2, $26, $9
+div $2, $19
+add $20, $18, $2
+divu $31, $16
+add $26, $2, $18
+add $22, $12, $21
+mult $2, $6
+sw $31, 0x92d8($1)
+; comment only
+lis $3	;tab
+; comment only
+slt $24, $14, $0
+
+bne $24, $13, L209
+
+L216: lw $22, 20($17)
+lis $4
+; comment only
+beq $14, $16, L198 ; fwd
+beq $8, $3, L118 ; fwd
+
+lis $3	;tab
+L217: .word L126
+lis $3	;tab
+L218: ; comment only
+beq $31, $20, L78 ; fwd
+bne $5, $27, L179
+beq $4, $23, L169
+lw $22, 0x333($6)
+add $11, $29, $6
+sltu $8, $25, $11
+
+L219: sw $11, -5($7)
+sltu $25, $10, $11
+lw $3, 54($13)
+L220: beq $28, $12, L157 ; fwd
+div $23, $24
+L221: 
+beq $27, $28, L42
+L222: sw $14, -79($8)
+jalr $23
+add $12, $28, $2
+divu $8, $31
+mflo $3
+; comment only
+.word -1090632370
+L223: add $21, $19, $11
+.word 0x3f6f67e6
+jr $6
+lis $3	;tab
+.word 0x8d36682d
+L224: beq $12, $11, L162 ; fwd
+lis $3	;tab
+add $4, $24, $1
+; comment only
+beq $13, $30, L143 ; fwd
+L225: add $24, $25, $25
+L226: add $18, $22, $14
+.word L142
+add $12, $7, $20
+lis $3	;tab
+.word 0xe3bf4069
+
+sltu $23, $27, $27
+.word L57
+L227: ; comment only
+
+add $6, $5, $25
+.word 0xae15acd1
+.word 1339812983
+sw $5, -59($3)
+beq $11, $18, L59
+beq $0, $26, L73 ; fwd
+
+L228: beq $7, $21, L51
+lis $3	;tab
+lis $3	;tab
+mflo $21
+mflo $27
+L229: 
+lis $3	;tab
+add $19, $24, $24
+bne $8, $16, L112
+.word L49
+slt $7, $11, $16
+.word 0x4c700c91
+multu $6, $27
+; comment only
+beq $15, $8, L170 ; fwd
+
+beq $28, $16, L14
+add $15, $2, $22
+sub $11, $12, $12
+beq $2, $0, L173 ; fwd
+beq $3, $15, L133 ; fwd
+mfhi $20
+add $24, $19, $22
+L230: .word L87
+.word L121
+beq $10, $27, L15 ; fwd
+; comment only
+
+L231: .word 0x324f6733
+; comment only
+L232: 
+.word 4094296921
+.word 2464020324
+lis $3	;tab
+.word -690888542
+beq $27, $19, L166
+multu $8, $0
+.word 3071363870
+; comment only
+lis $3	;tab
+lis $3	;tab
+divu $12, $18
+beq $7, $7, L123 ; fwd
+L233: ; comment only
+; comment only
+slt $17, $3, $20
+div $29, $3
+L234: ; comment only
+
+L235: beq $5, $27, L110 ; fwd
+slt $22, $10, $31
+beq $26, $18, L192 ; fwd
+mflo $12
+L236: lw $28, 14($13)
+; comment only
+sub $5, $10, $10
+jr $16
+beq $9, $14, L239 ; fwd
+lis $3	;tab
+add $14, $10, $18
+L237: jalr $1
+add $2, $11, $1
+.word L185
+beq $9, $23, L102 ; fwd
+beq $31, $17, L31 ; fwd
+lw $18, 62($18)
+L238: bne $7, $28, L181
+L239: ; comment only
+bne $15, $17, L194
+jr $24
+
+.word 0xa1f915f8
+jalr $8
+L240: divu $22, $22
+beq $6, $16, L218 ; fwd
+bne $1, $16, L67
+lis $3	;tab
+lis $3	;tab
+sw $9, 0xd3f0($24)
+jalr $11
+sub $6, $12, $14
+L241: lis $3	;tab
+lis $3	;tab
+.word L162
+
+add $2, $6, $2
+slt $13, $20, $25
+
+sw $14, 0x1e90($9)
+sw $22, -87($5)
+bne $15, $19, L73
+; comment only
+mult $9, $14
+.word 0xa4158d73
+add $29, $26, $0
+slt $11, $4, $7
+.word L93
+lw $17, 97($8)
+.word L220
+; comment only
+add $3, $7, $11
+beq $5, $25, L15 ; fwd
+mult $19, $0
+.word L62
+lis $3	;tab
+lis $3	;tab
+L242: 
+
+multu $22, $3
+lis $3	;tab
+beq $31, $28, L23 ; fwd
+L243: lis $3	;tab
+divu $17, $3
+L244: ; comment only
+L245: jalr $18
+
+add $6, $30, $9
+lw $5, 73($14)
+
+beq $4, $17, L215
+lis $3	;tab
+bne $10, $0, L42
+
+bne $31, $30, L104
+L246: sub $14, $20, $13
+L247: 
+lis $3	;tab
+L248: beq $26, $24, L13
+lis $3	;tab
+sw $4, -74($22)
+multu $26, $30
+mfhi $10
+beq $11, $5, L247 ; fwd
+lis $3	;tab
+
+L249: jr $16
+add $25, $17, $26
+lis $3	;tab
+jr $7
+sub $13, $13, $1
+divu $31, $28
+beq $12, $26, L177
+bne $5, $29, L142
+lis $3	;tab
+add $12, $17, $22
+beq $12, $15, L94
+beq $28, $29, L230 ; fwd
+lis $3	;tab
+lis $3	;tab
+lis $3	;tab
+sltu $2, $13, $21
+slt $16, $15, $3
+lw $19, 44($27)
+beq $19, $4, L41
+jalr $0
+; comment only
+add $12, $13, $20
+
+sltu $24, $26, $24
+beq $21, $24, L112 ; fwd
+sw $12, 0xf2dd($6)
+lis $3	;tab
+.word L249
+bne $11, $2, L248
+beq $3, $25, L39 ; fwd
+
+lis $3	;tab
+multu $4, $25
+; comment only
+jalr $25
+bne $11, $26, L70
+jalr $23
+
+; comment only
+add $18, $18, $17
+multu $29, $2
+lw $5, -87($31)
+divu $29, $24
+mfhi $26
+mult $18, $29
+add $9, $12, $13
+beq $10, $13, L32 ; fwd
+add $24, $1, $25
+
+bne $21, $9, L136
+lis $3	;tab
+beq $20, $29, L195
+mult $0, $1
+.word L175
+sub $24, $26, $7
+sw $2, 92($2)
+; comment only
+add $18, $26, $4
+bne $25, $3, L168
+lw $13, 0x2919($3)
+
+
+.word 835265653
+; comment only
+add $9, $14, $0
+; comment only
+add $15, $27, $6
+.word L95
+beq $13, $15, L231
+mflo $19
+sub $13, $8, $4
+.word L192
+sw $15, -64($27)
+slt $11, $3, $2
+lw $30, 6($22)
+lis $3	;tab
+bne $10, $18, L130
+bne $7, $3, L231
+slt $26, $24, $23
+beq $9, $28, L57
+; comment only
+sw $21, 67($2)
+sltu $6, $28, $7
+lis $3	;tab
+.word L194
+lis $3	;tab
+bne $7, $20, L31
+divu $5, $31
+beq $20, $6, L141
+jr $15
+.word L243
+beq $10, $3, L109
+beq $21, $19, L141 ; fwd
+
+lis $3	;tab
+lis $9
+beq $4, $12, L199 ; fwd
+add $11, $22, $27
+beq $16, $13, L41 ; fwd
+jr $11
+multu $29, $9
+
+
+
+sw $10, 0xf427($18)
+mflo $10
+lw $9, 0x694($3)
+bne $9, $27, L40
+; comment only
+beq $4, $16, L12
+; comment only
+lw $30, 0xd45($26)
+
+sub $0, $2, $1
+add $13, $23, $13
+.word L11
+lis $3	;tab
+add $14, $19, $12
+; comment only
+multu $12, $23
+; comment only
+mflo $6
+beq $29, $31, L122
+sub $29, $20, $22
+bne $9, $7, L224
+beq $20, $10, L165 ; fwd
+slt $1, $28, $0
+beq $8, $18, L202 ; fwd
+sw $3, 21($9)
+add $31, $26, $2
+mfhi $24
+beq $1, $19, L243 ; fwd
+add $1, $15, $24
+sw $0, 0x9d97($13)
+lis $3	;tab
+.word L128
+add $8, $17, $2
+slt $6, $3, $31
+
+.word L38
+sltu $31, $16, $11
+add $6, $29, $4
+div $29, $10
+lis $3	;tab
+.word L188
+bne $19, $30, L77
+; comment only
+add $11, $15, $6
+lis $3	;tab
+.word -1816139583
+div $6, $28
+slt $4, $28, $27
+sltu $7, $29, $30
+sw $29, 0x6101($6)
+.word 3581014947
+.word L110
+add $5, $24, $21
+add $1, $0, $28
+lis $3	;tab
+; comment only
+divu $19, $26
+sltu $13, $27, $20
+.word L198
+.word 626660820
+.word 2812776579
+.word L190
+div $6, $10
+
+lis $3	;tab
+beq $31, $1, L239 ; fwd
+lw $6, -32($26)
+sw $18, -18($13)
+
+
+; comment only
+sltu $10, $16, $7
+mfhi $8
+; comment only
+beq $29, $7, L138 ; fwd
+; comment only
+mflo $26
+.word 0xcc2510a0
+lis $3	;tab
+multu $23, $15
+beq $2, $26, L217 ; fwd
+beq $10, $20, L150 ; fwd
+mflo $30
+sw $30, -43($4)
+
+jr $8
+.word -1425505977
+
+.word L192
+.word L185
+add $31, $16, $18
+sw $30, -70($19)
+beq $24, $27, L241 ; fwd
+mflo $9
+sltu $18, $13, $6
+bne $8, $14, L40
+lis $3	;tab
+sub $12, $19, $15
+beq $4, $2, L240 ; fwd
+bne $13, $23, L180
+slt $29, $21, $18
+beq $5, $8, L236
+add $15, $13, $27
+lw $6, -4($12)
+sub $10, $20, $13
+lis $3	;tab
+beq $16, $22, L81
+add $29, $12, $7
+.word L231
+divu $24, $13
+bne $15, $31, L186
+add $29, $22, $30
+beq $28, $25, L178
+
+beq $30, $31, L181 ; fwd
+beq $18, $3, L128 ; fwd
+.word L59
+sltu $19, $10, $28
+lis $10
+; comment only
+sw $0, 0x909b($0)
+sw $16, 0xe896($2)
+
+; comment only
+lis $3	;tab
+add $12, $30, $13
+.word 0x8311e7e9
+
+divu $25, $31
+; comment only
+mflo $26
+
+.word L19
+lis $3	;tab
+.word 0xb0bab062
+mfhi $2
+.word L210
+mfhi $11
+beq $16, $13, L104
+; comment only
+sltu $11, $16, $2
+mult $3, $13
+lis $3	;tab
+div $8, $11
+lis $3	;tab
+.word 1174512380
+lis $3	;tab
+.word L118
+sub $17, $1, $26
+lw $11, 0x1926($19)
+jalr $7
+add $17, $13, $13
+jalr $12
+.word L81
+.word 4217582737
+.word L64
+.word L187
+add $1, $21, $30
+lis $3	;tab
+add $15, $8, $3
+.word 0xd850907
+sub $17, $17, $9
+jalr $9
+.word L14
+.word 0x7b73127
+beq $27, $19, L124 ; fwd
+add $28, $20, $27
+beq $1, $10, L71 ; fwd
+beq $4, $9, L81
+.word 0x528bd9d8
+multu $26, $13
+sub $10, $0, $1
+slt $4, $11, $22
+; comment only
+; comment only
+beq $11, $11, L188 ; fwd
+.word 0xae6308
+.word 998403917
+
+jr $20
+jalr $6
+sw $13, 0xaf9a($9)
+lw $10, 0xb239($12)
+add $25, $22, $30
+; comment only
+.word 3098083099
+divu $13, $31
+sw $7, 29($22)
+multu $27, $19
+.word 0x3ecd2e49
+add $2, $12, $23
+.word 0x68e8384e
+lis $3	;tab
+.word 0xb215b99e
+lis $3	;tab
+beq $23, $23, L128 ; fwd
+.word 0xc200d2c8
+add $13, $22, $11
+; comment only
+
+lis $3	;tab
+sw $11, 0x5e5b($1)
+multu $22, $30
+beq $28, $12, L31 ; fwd
+beq $27, $14, L107
+lw $12, 15($0)
+; comment only
+
+mflo $2
+
+.word L171
+beq $12, $7, L195
+sw $6, 0x5ee3($27)
+beq $19, $5, L40
+
+
+
+jalr $18
+
+beq $30, $18, L174 ; fwd
+lw $16, -59($27)
+lis $3	;tab
+sw $25, -41($26)
+div $15, $13
+div $4, $4
+lis $3	;tab
+mfhi $19
+add $8, $25, $25
+beq $3, $7, L154 ; fwd
+add $8, $29, $25
+lw $10, 20($16)
+; comment only
+.word 1317722274
+beq $8, $2, L33 ; fwd
+beq $9, $0, L132 ; fwd
+lw $2, 0xdfbc($11)
+lis $11
+lis $3	;tab
+mflo $31
+beq $15, $8, L53 ; fwd
+add $21, $15, $25
+.word L183
+lw $7, -89($18)
+.word L12
+sltu $19, $23, $22
+mflo $16
+mflo $21
+sw $23, -91($11)
+.word 0x32aabc6
+.word 0xaff39ce4
+
+
+add $16, $4, $3
+.word 3895020582
+lw $5, 0x790($2)
+.word L1
+.word 0xa7344190
+lis $21
+add $24, $18, $1
+beq $29, $1, L246 ; fwd
+.word -2079611209
+add $25, $28, $9
+sub $12, $26, $22
+beq $14, $12, L154
+sw $20, 0x4384($22)
+beq $14, $4, L116 ; fwd
+lis $0
+; comment only
+
+beq $22, $19, L50
+beq $22, $20, L228 ; fwd
+; comment only
+; comment only
+sw $5, 0x30cb($12)
+lis $30
+.word L1
+add $19, $8, $24
+slt $8, $20, $20
+.word 0x907b9040
+mflo $24
+lis $3	;tab
+
+beq $19, $29, L216
+lis $3	;tab
+beq $9, $30, L209
+add $2, $25, $27
+lis $3	;tab
+sub $27, $23, $27
+.word L98
+.word 0x2f945a49
+beq $11, $24, L90
+lis $3	;tab
+
+beq $10, $14, L63
+beq $4, $5, L51 ; fwd
+
+.word 4261309169
+slt $5, $20, $11
+.word L60
+beq $18, $10, L197
+lis $3	;tab
+sltu $1, $6, $16
+.word L249
@@ -0,0 +1,2001 @@
+add $5, $5, $23
+lis $3	;tab
+sw $13, 55($27)
+lis $3	;tab
+; comment only
+; comment only
+; comment only
+add $1, $23, $29
+.word 3966878886
+L0: beq $8, $23, 0xacaa
+.word L0
+bne $23, $28, -30
+.word L0
+.word L0
+.word L0
+lis $3	;tab
+lis $3	;tab
+beq $14, $20, L208 ; fwd
+div $30, $19
+lis $3	;tab
+; comment only
+beq $26, $19, L187 ; fwd
+; comment only
+beq $4, $21, L185 ; fwd
+L1: mfhi $3
+add $17, $14, $6
+div $15, $13
+add $27, $2, $3
+multu $1, $5
+L2: sub $2, $1, $23
+multu $0, $24
+mflo $2
+L3: 
+lis $3	;tab
+L4: bne $1, $19, 0x8d2f
+add $16, $25, $9
+mfhi $20
+add $28, $8, $25
+beq $21, $16, L3
+lis $3	;tab
+mult $16, $2
+L5: mult $29, $14
+lis $3	;tab
+mflo $28
+L6: sltu $14, $23, $16
+lw $9, 0x627f($10)
+L7: lis $3	;tab
+L8: sub $1, $11, $14
+L9: add $29, $29, $19
+.word 0xf68ed036
+add $3, $26, $11
+beq $30, $23, L4 ; fwd
+sltu $23, $18, $23
+beq $26, $6, L26 ; fwd
+beq $1, $28, L15 ; fwd
+.word L7
+
+add $18, $1, $23
+lis $3	;tab
+L10: .word L3
+L11: bne $29, $8, L6
+lw $7, 0x9dd5($25)
+lis $3	;tab
+L12: 
+add $31, $18, $22
+div $17, $30
+.word L11
+.word 1855657206
+
+.word 2509596189
+; comment only
+L13: .word 1710276598
+L14: sw $14, 0xabb5($28)
+lw $9, 0xfc97($6)
+jalr $16
+divu $15, $25
+beq $29, $28, L12
+divu $3, $30
+sw $30, 0xf644($5)
+lis $3	;tab
+
+beq $24, $0, L80 ; fwd
+lis $3	;tab
+.word L10
+sub $25, $13, $24
+slt $12, $17, $12
+
+L15: 
+.word L8
+divu $13, $4
+.word L2
+.word L10
+; comment only
+sltu $22, $11, $25
+beq $8, $3, L41 ; fwd
+.word L9
+sw $0, 0x8b5($28)
+beq $19, $31, L166 ; fwd
+L16: lis $3	;tab
+lw $16, 0x4dde($19)
+.word 1806018851
+beq $5, $19, L10 ; fwd
+.word L7
+add $7, $7, $24
+lis $22
+L17: .word L11
+.word L9
+divu $13, $17
+sub $30, $12, $23
+multu $14, $17
+beq $24, $25, L206 ; fwd
+bne $20, $25, L9
+beq $4, $23, L78 ; fwd
+div $22, $28
+div $24, $8
+slt $10, $22, $4
+lis $3	;tab
+.word 0x52053d31
+.word L4
+jr $6
+lis $16
+L18: bne $5, $21, L7
+add $21, $23, $3
+mult $27, $28
+div $7, $21
+lis $3	;tab
+.word 0xddc2c2d
+beq $31, $25, L5
+; comment only
+slt $8, $7, $11
+L19: sw $0, 0x1b20($14)
+divu $5, $21
+beq $29, $3, L219 ; fwd
+mfhi $30
+L20: add $8, $3, $3
+add $21, $15, $8
+add $8, $7, $15
+L21: mfhi $13
+bne $10, $6, L6
+lis $21
+.word 0x1996cb53
+.word L8
+lis $3	;tab
+L22: ; comment only
+add $12, $13, $12
+add $8, $1, $16
+.word L17
+L23: mflo $20
+L24: mfhi $8
+; comment only
+sltu $29, $18, $13
+bne $4, $26, L23
+L25: lw $17, 0x36e2($21)
+lis $3	;tab
+; comment only
+jr $8
+.word L14
+.word 4180044883
+
+sub $23, $30, $14
+beq $8, $19, L222 ; fwd
+lw $0, 0x32aa($3)
+sw $28, 0x6b5a($1)
+
+L26: multu $24, $4
+.word L8
+.word L15
+mflo $19
+mflo $21
+lis $3	;tab
+.word 3155430205
+L27: 
+.word 0x74ae5dae
+.word -924161652
+sltu $0, $3, $24
+.word 0x45d490e1
+; comment only
+.word L18
+L28: .word L23
+lw $1, 22($9)
+jalr $3
+beq $18, $6, L164 ; fwd
+sltu $8, $27, $8
+L29: ; comment only
+.word L1
+bne $6, $23, L22
+beq $17, $30, L229 ; fwd
+
+add $2, $21, $27
+add $22, $3, $4
+; comment only
+.word -306602304
+L30: lis $3	;tab
+beq $11, $18, L5 ; fwd
+add $15, $14, $25
+L31: beq $4, $15, L12
+L32: lis $3	;tab
+; comment only
+
+add $25, $27, $8
+divu $23, $3
+
+.word L27
+beq $28, $10, L126 ; fwd
+div $9, $1
+multu $26, $16
+.word L29
+.word 3304612984
+
+.word 0xd709f000
+beq $17, $15, L119 ; fwd
+bne $15, $10, L23
+; comment only
+jr $7
+.word L29
+L33: lis $3	;tab
+.word 0xbd37088b
+mflo $26
+lis $3	;tab
+divu $16, $20
+.word 3432498252
+sub $0, $23, $20
+lis $3	;tab
+lis $3	;tab
+beq $30, $25, L15
+sltu $1, $22, $1
+mult $0, $21
+beq $0, $30, L163 ; fwd
+mflo $20
+sw $31, 0xc33e($5)
+
+bne $11, $15, L14
+.word L15
+lw $10, 0x67de($23)
+beq $12, $11, L216 ; fwd
+add $8, $13, $13
+L34: slt $12, $11, $17
+add $0, $23, $7
+
+.word -1624779020
+L35: .word L4
+.word L34
+L36: ; comment only
+sw $1, 40($4)
+multu $19, $29
+add $21, $29, $3
+jalr $22
+lis $3	;tab
+mflo $14
+L37: slt $6, $23, $4
+lis $3	;tab
+beq $27, $12, L1
+beq $4, $3, L31
+beq $22, $30, L169 ; fwd
+sltu $9, $7, $0
+div $9, $19
+beq $8, $5, L238 ; fwd
+lis $3	;tab
+lis $5
+beq $27, $13, L105 ; fwd
+add $21, $27, $31
+beq $7, $2, L24
+L38: lis $3	;tab
+lw $5, 31($12)
+
+sltu $20, $8, $15
+.word L25
+beq $3, $22, L1
+lis $3	;tab
+beq $21, $27, L8
+multu $25, $9
+beq $19, $27, L118 ; fwd
+L39: .word 0x8686952
+L40: .word 1368303743
+sw $14, 0xf256($19)
+.word L30
+.word 1144548860
+.word 0x9398bc43
+beq $0, $16, L37
+sltu $30, $17, $10
+beq $14, $13, L32
+; comment only
+mult $19, $29
+L41: ; comment only
+L42: beq $14, $2, L2
+; comment only
+mflo $25
+jalr $14
+sw $16, 0x68a($3)
+L43: .word L12
+lw $29, 0x2f2b($3)
+sw $16, 0x80a0($3)
+add $26, $14, $11
+beq $30, $8, L108 ; fwd
+lw $11, 95($26)
+sltu $9, $1, $1
+beq $30, $27, L240 ; fwd
+
+beq $0, $4, L33
+; comment only
+L44: add $18, $16, $7
+L45: 
+L46: bne $6, $24, L42
+divu $0, $15
+divu $2, $17
+L47: 
+mflo $11
+add $10, $7, $12
+sw $5, 65($15)
+bne $11, $13, L18
+L48: jalr $19
+sw $2, 95($30)
+div $18, $27
+.word 1343498385
+L49: sltu $9, $30, $1
+jr $23
+divu $12, $6
+sw $8, 0x96ca($30)
+add $2, $0, $7
+add $28, $14, $13
+sub $1, $7, $24
+L50: 
+.word 1924393379
+L51: mflo $5
+sw $7, 97($19)
+
+L52: beq $1, $0, L171 ; fwd
+L53: beq $29, $29, L4 ; fwd
+
+L54: lis $4
+lis $3	;tab
+sub $12, $5, $27
+sw $7, -31($20)
+
+jr $28
+L55: .word 0xd016e0e9
+L56: .word L46
+lis $3	;tab
+jalr $26
+add $25, $17, $7
+sw $15, 93($15)
+add $17, $8, $24
+
+beq $8, $2, L15 ; fwd
+add $16, $11, $10
+beq $27, $10, L18
+beq $13, $17, L14 ; fwd
+jr $31
+add $2, $19, $26
+
+; comment only
+.word -1724120223
+sltu $11, $1, $21
+add $17, $25, $20
+
+mult $15, $9
+bne $3, $13, L12
+add $31, $25, $9
+
+slt $10, $15, $6
+sw $31, 0xe98e($29)
+lis $0
+add $6, $26, $27
+.word L55
+.word 1963323468
+
+mflo $5
+; comment only
+beq $7, $21, L19
+beq $9, $16, L67 ; fwd
+; comment only
+; comment only
+
+
+.word L27
+slt $5, $9, $6
+.word L49
+
+L57: .word 0xf928dbaa
+L58: .word L53
+beq $26, $12, L155 ; fwd
+add $11, $16, $1
+add $27, $19, $25
+beq $27, $17, L155 ; fwd
+lw $16, 0xddc2($0)
+mflo $20
+
+beq $21, $24, L150 ; fwd
+L59: add $6, $15, $26
+.word 0x464f4a93
+beq $26, $26, L87 ; fwd
+L60: .word L60
+L61: ; comment only
+.word L25
+lw $27, 0x3cb1($17)
+.word L55
+.word 0x879325bc
+
+beq $26, $3, L21 ; fwd
+L62: multu $21, $18
+mflo $4
+L63: sw $21, 29($12)
+sw $30, 0xa1e3($18)
+.word L56
+L64: .word 0x6a301686
+L65: sw $26, 74($10)
+lis $3	;tab
+; comment only
+
+
+beq $17, $8, L39
+jalr $4
+L66: ; comment only
+.word L0
+mfhi $4
+beq $25, $11, L38
+beq $0, $29, L21
+mfhi $29
+mfhi $19
+L67: sw $6, 78($24)
+
+.word L27
+L68: ; comment only
+L69: lis $3	;tab
+bne $22, $17, L64
+
+add $9, $21, $15
+mflo $26
+lw $19, 0xf5($29)
+sw $6, 0xf0d2($23)
+L70: .word 2030246585
+L71: .word L60
+lis $3	;tab
+lis $25
+beq $20, $16, L151 ; fwd
+lis $3	;tab
+.word L53
+lis $3	;tab
+L72: ; comment only
+mflo $13
+L73: add $26, $4, $25
+.word L22
+mult $1, $25
+multu $19, $9
+L74: multu $13, $12
+L75: add $15, $21, $2
+beq $9, $21, L9 ; fwd
+lw $8, 40($28)
+L76: ; comment only
+lis $3	;tab
+add $11, $15, $5
+.word L76
+L77: .word 0x620ba332
+L78: .word L9
+beq $14, $9, L6 ; fwd
+bne $30, $28, L16
+sw $19, -83($27)
+beq $19, $1, L19
+beq $22, $9, L23 ; fwd
+sub $9, $15, $0
+lw $2, -2($19)
+.word L21
+
+L79: jr $16
+beq $29, $21, L39
+mfhi $4
+.word L70
+L80: div $23, $18
+; comment only
+L81: beq $22, $10, L69 ; fwd
+lw $1, 0x204c($24)
+sltu $22, $26, $20
+sw $31, 0x4e2c($18)
+L82: beq $30, $8, L46 ; fwd
+slt $16, $24, $1
+lis $3	;tab
+multu $0, $8
+.word L2
+lis $3	;tab
+lis $3	;tab
+beq $15, $4, L200 ; fwd
+
+multu $29, $13
+sw $4, -62($15)
+
+L83: add $21, $16, $24
+lis $3	;tab
+add $22, $22, $14
+add $22, $25, $1
+; comment only
+sltu $29, $1, $28
+.word L40
+sw $17, 0xb7c4($19)
+L84: beq $20, $26, L229 ; fwd
+lw $5, 0x2310($25)
+.word L8
+sw $18, 0xacc6($19)
+L85: 
+lis $3	;tab
+
+beq $2, $1, L249 ; fwd
+beq $13, $20, L51 ; fwd
+; comment only
+.word L42
+.word 0x793b9c53
+jalr $28
+
+
+.word -1503994200
+beq $25, $20, L196 ; fwd
+L86: .word 565815646
+lis $3	;tab
+add $2, $21, $1
+sw $27, -44($31)
+multu $27, $30
+add $6, $4, $27
+bne $12, $27, L15
+mfhi $28
+L87: 
+
+sltu $22, $26, $30
+.word -958566383
+L88: ; comment only
+beq $27, $23, L43 ; fwd
+lis $25
+.word 0xd35ae379
+lis $5
+add $7, $8, $10
+.word L12
+
+add $31, $19, $16
+lis $28
+jr $16
+lis $3	;tab
+lis $3	;tab
+
+L89: beq $23, $19, L83
+beq $22, $17, L54 ; fwd
+
+div $28, $23
+L90: .word L51
+L91: bne $1, $12, L72
+L92: beq $0, $4, L155 ; fwd
+L93: add $1, $12, $11
+add $22, $22, $5
+L94: beq $14, $26, L237 ; fwd
+lw $26, 0x2934($15)
+.word 2122348540
+.word 1086119122
+lis $3	;tab
+mfhi $26
+add $6, $15, $31
+mflo $23
+beq $18, $15, L36
+add $16, $30, $30
+beq $27, $10, L23 ; fwd
+L95: .word 0xca3d2515
+sltu $19, $25, $17
+L96: ; comment only
+L97: ; comment only
+div $9, $21
+sub $7, $17, $28
+mflo $25
+jr $20
+sw $16, 0x236($18)
+lw $16, 0xc66b($3)
+
+.word 0xb6da4b61
+slt $23, $7, $20
+mult $5, $27
+multu $26, $30
+; comment only
+L98: .word 3580645299
+.word 0x8c227bec
+beq $31, $15, L233 ; fwd
+beq $31, $0, L211 ; fwd
+mfhi $20
+lw $23, 0x700e($5)
+beq $11, $9, L26 ; fwd
+jalr $14
+beq $22, $12, L202 ; fwd
+add $11, $20, $23
+beq $26, $22, L155 ; fwd
+
+lis $27
+jalr $17
+
+; comment only
+; comment only
+jr $21
+sw $23, 0x72ad($20)
+add $16, $13, $25
+add $13, $2, $31
+div $29, $24
+.word L95
+mflo $21
+L99: mflo $14
+lw $8, 53($9)
+add $29, $3, $15
+beq $16, $12, L71
+mflo $21
+mflo $10
+jr $16
+jr $23
+lis $3	;tab
+L100: sub $22, $25, $26
+add $29, $9, $31
+slt $11, $18, $14
+sub $15, $31, $17
+.word L73
+.word -279075242
+add $21, $18, $25
+L101: .word L18
+L102: lw $28, 0x683e($12)
+jalr $16
+.word 4197412874
+add $24, $30, $23
+lis $29
+
+; comment only
+beq $28, $25, L57
+beq $30, $6, L0
+L103: bne $21, $16, L12
+
+sw $24, 0x9c60($29)
+beq $6, $22, L81 ; fwd
+sltu $5, $13, $21
+lw $29, -35($7)
+add $7, $28, $15
+beq $6, $22, L217 ; fwd
+; comment only
+slt $9, $20, $26
+jr $18
+.word -1732755000
+.word L36
+add $19, $10, $21
+L104: .word L45
+; comment only
+lis $3	;tab
+beq $22, $21, L172 ; fwd
+.word 1737247626
+L105: lw $18, 0x794c($31)
+slt $22, $14, $22
+L106: divu $22, $30
+L107: lw $10, -27($8)
+L108: beq $5, $13, L1 ; fwd
+beq $22, $2, L79 ; fwd
+L109: sw $21, -46($10)
+add $31, $9, $30
+sw $31, 76($24)
+lis $3	;tab
+sw $0, -93($11)
+; comment only
+add $15, $3, $5
+.word L99
+add $17, $30, $17
+.word -1743548169
+L110: 
+lw $17, 84($0)
+
+L111: jr $16
+.word L54
+add $26, $5, $15
+slt $18, $9, $11
+sub $29, $31, $8
+lis $3	;tab
+L112: 
+
+lis $3	;tab
+mflo $14
+bne $19, $5, L12
+div $6, $20
+.word L57
+bne $5, $31, L46
+; comment only
+beq $25, $25, L23 ; fwd
+
+.word 0xaba0ac67
+L113: lis $3	;tab
+; comment only
+div $23, $23
+beq $8, $5, L25
+add $26, $4, $17
+.word 0x574254f8
+.word L111
+L114: beq $3, $2, L16
+sub $1, $6, $13
+L115: add $8, $26, $28
+.word 0x7e93c0c4
+jr $26
+L116: ; comment only
+
+L117: bne $17, $19, L9
+L118: mult $27, $12
+L119: .word L81
+lw $10, 0x1e30($7)
+L120: .word L36
+L121: slt $29, $23, $11
+beq $18, $0, L246 ; fwd
+lis $3	;tab
+add $30, $6, $4
+.word -342207537
+L122: beq $30, $18, L185 ; fwd
+lis $3	;tab
+mfhi $5
+divu $23, $0
+; comment only
+
+.word L2
+; comment only
+div $22, $29
+.word L60
+bne $10, $30, L37
+beq $0, $16, L52 ; fwd
+L123: add $19, $25, $6
+mflo $18
+L124: .word 0x1a8d1953
+lis $3	;tab
+add $14, $29, $1
+lis $3	;tab
+.word L20
+mult $24, $11
+divu $23, $16
+lw $10, 0xbf2a($22)
+.word 0xcc5370e0
+L125: sub $0, $12, $6
+lw $12, -76($15)
+add $26, $21, $8
+.word L48
+
+slt $22, $27, $4
+; comment only
+multu $16, $3
+lw $4, 0xfedc($19)
+.word L33
+slt $8, $27, $24
+lis $3	;tab
+; comment only
+
+add $15, $26, $27
+lw $18, 0x8175($15)
+L126: multu $19, $16
+bne $21, $4, L100
+.word L9
+L127: multu $4, $30
+L128: beq $21, $3, L55
+L129: 
+; comment only
+L130: .word L76
+beq $19, $27, L8
+lis $3	;tab
+lis $3	;tab
+; comment only
+L131: beq $1, $10, L229 ; fwd
+beq $22, $26, L34 ; fwd
+mflo $0
+; comment only
+bne $23, $8, 0xc4c4
+lw $23, 78($8)
+L132: jalr $16
+bne $28, $3, L117
+sltu $30, $31, $17
+; comment only
+multu $8, $11
+lis $3	;tab
+L133: sw $21, 0x716f($16)
+jr $17
+
+.word L20
+lis $3	;tab
+
+sw $5, -89($7)
+L134: add $30, $24, $29
+slt $26, $21, $2
+sw $14, -72($3)
+.word L56
+
+.word 0xbf902896
+
+.word L98
+beq $28, $23, L3 ; fwd
+lis $3	;tab
+; comment only
+L135: .word L93
+sltu $13, $7, $1
+; comment only
+.word L44
+lis $3	;tab
+L136: sw $12, 0x40b2($14)
+.word -744887623
+lis $25
+L137: .word L12
+jalr $30
+beq $12, $7, L122
+slt $22, $10, $27
+mfhi $12
+add $29, $2, $28
+beq $26, $23, L115 ; fwd
+sltu $18, $4, $13
+beq $1, $12, L57
+L138: lis $3	;tab
+add $22, $21, $11
+L139: ; comment only
+beq $22, $10, L22 ; fwd
+divu $21, $18
+slt $7, $19, $4
+L140: lis $3	;tab
+
+multu $28, $7
+lis $3	;tab
+L141: jalr $18
+lw $31, 0xa096($27)
+lw $1, -57($12)
+.word L91
+L142: .word 0xd7b6f2bb
+add $10, $19, $19
+lis $3	;tab
+jr $3
+.word 937076648
+sw $27, 79($23)
+L143: 
+jr $31
+beq $17, $15, L103 ; fwd
+beq $28, $31, L137
+bne $25, $18, L4
+sub $2, $5, $23
+
+add $4, $19, $31
+L144: .word L5
+add $4, $23, $1
+div $5, $10
+bne $4, $24, L79
+L145: beq $23, $28, L11
+
+beq $9, $3, L85 ; fwd
+lis $3	;tab
+beq $16, $12, L238 ; fwd
+beq $30, $15, L216 ; fwd
+lw $30, 0xe83b($25)
+L146: ; comment only
+.word L70
+lis $22
+.word L109
+multu $3, $18
+sltu $26, $29, $28
+mult $5, $0
+div $13, $19
+sw $7, 0x72c2($31)
+slt $31, $12, $7
+L147: lis $30
+.word 2330936728
+lis $3	;tab
+div $16, $22
+mult $14, $2
+; comment only
+lis $3	;tab
+lw $28, 47($2)
+divu $3, $25
+.word L31
+add $26, $28, $27
+slt $8, $20, $15
+beq $11, $31, L37 ; fwd
+.word L110
+.word L112
+beq $19, $31, L3 ; fwd
+multu $10, $9
+sw $14, -97($19)
+sw $0, 2($18)
+.word 0x67de2fc4
+L148: beq $25, $6, L90 ; fwd
+; comment only
+; comment only
+; comment only
+L149: ; comment only
+lw $4, 85($21)
+.word L125
+
+L150: .word L61
+jalr $26
+slt $21, $22, $21
+.word L148
+lis $3
+L151: .word L123
+beq $4, $16, L114
+multu $26, $1
+L152: sw $18, 0x5a51($6)
+.word 0x83ff1f0b
+sub $5, $8, $14
+bne $13, $9, L130
+bne $25, $30, L33
+sw $12, 0xae14($14)
+sltu $7, $22, $13
+beq $17, $7, L224 ; fwd
+lis $3	;tab
+lis $3	;tab
+jalr $29
+; comment only
+add $9, $4, $21
+L153: beq $8, $23, L53
+.word L138
+jr $27
+sw $9, 10($5)
+add $17, $19, $3
+add $30, $31, $31
+sw $16, 0xa1b1($24)
+lis $3	;tab
+
+add $8, $3, $30
+div $11, $14
+beq $5, $6, L41
+jalr $7
+lw $12, 0xf22($27)
+.word L32
+sub $17, $6, $7
+divu $2, $22
+lis $3	;tab
+beq $12, $15, L23
+mflo $24
+beq $11, $4, L62 ; fwd
+.word 473397235
+L154: beq $19, $25, L122 ; fwd
+L155: sw $19, -24($26)
+div $12, $22
+; comment only
+
+add $31, $15, $3
+beq $14, $21, L184 ; fwd
+L156: jalr $25
+lis $1
+.word -1802962336
+div $24, $9
+add $25, $4, $6
+beq $21, $26, L101 ; fwd
+add $16, $18, $23
+bne $9, $16, L0
+
+div $24, $22
+
+lis $3	;tab
+lis $3	;tab
+beq $16, $12, L187 ; fwd
+L157: 
+beq $0, $17, L11
+lis $3	;tab
+beq $8, $9, L143
+mfhi $25
+.word -2132498298
+.word 0x3e63bf46
+L158: bne $24, $26, L118
+L159: jr $8
+add $7, $16, $27
+.word L37
+bne $3, $22, L62
+L160: lis $3	;tab
+lw $12, -69($19)
+bne $5, $9, L117
+.word 0xcb7b2e2b
+jalr $27
+.word L58
+jr $23
+.word L106
+add $12, $8, $14
+beq $6, $31, L132 ; fwd
+bne $8, $10, L92
+slt $18, $16, $26
+jalr $18
+add $6, $31, $4
+add $10, $19, $7
+mflo $31
+sw $15, -51($14)
+sltu $15, $5, $17
+divu $31, $4
+.word L94
+mflo $28
+bne $25, $19, L113
+
+
+lis $3	;tab
+lis $3	;tab
+
+lis $3	;tab
+.word L119
+.word 0xf48c5cc
+lis $3	;tab
+.word L32
+beq $12, $15, L193 ; fwd
+
+.word L14
+; comment only
+; comment only
+sltu $15, $6, $30
+bne $4, $12, L29
+; comment only
+sw $12, 0x5ecf($14)
+slt $4, $22, $22
+lis $3	;tab
+; comment only
+add $4, $16, $8
+lw $15, 0($28)
+.word L11
+L161: beq $16, $12, L51 ; fwd
+L162: beq $15, $22, L5 ; fwd
+jr $12
+lw $2, 0x6fdc($9)
+lis $3	;tab
+beq $7, $20, L66
+divu $24, $20
+L163: 
+lis $3	;tab
+L164: sltu $25, $1, $31
+.word 0xeb24c14a
+sw $31, -93($1)
+; comment only
+L165: sltu $13, $1, $6
+add $27, $1, $19
+beq $27, $4, L90
+L166: beq $7, $13, L29
+slt $19, $19, $17
+beq $15, $31, L114
+L167: sw $20, 0x4348($27)
+bne $20, $19, L18
+lis $4
+L168: beq $29, $4, L10 ; fwd
+.word 3728142922
+.word L9
+beq $10, $18, L7
+mult $28, $18
+bne $4, $21, L37
+bne $4, $9, L0
+add $31, $31, $27
+slt $19, $24, $10
+lw $8, 0xc044($30)
+beq $16, $17, L28 ; fwd
+add $16, $27, $31
+.word L145
+L169: bne $6, $25, L159
+L170: add $7, $17, $2
+lis $3	;tab
+.word 3925251295
+.word L14
+.word 0x37cfad4b
+lis $4
+add $4, $8, $18
+add $26, $4, $4
+lw $21, 0x784c($1)
+
+L171: lis $3	;tab
+jalr $20
+multu $2, $18
+L172: 
+beq $8, $0, L226 ; fwd
+div $3, $12
+lis $3	;tab
+
+div $24, $16
+.word -579153881
+
+beq $8, $9, L12
+beq $8, $30, L123
+multu $1, $22
+sltu $13, $19, $30
+.word 1283783648
+L173: beq $3, $1, L0
+lw $25, -17($12)
+add $27, $7, $22
+L174: .word L62
+sw $31, -91($26)
+beq $30, $19, L97 ; fwd
+beq $5, $31, L12 ; fwd
+mflo $21
+L175: .word L74
+add $4, $4, $16
+add $29, $14, $6
+lis $1
+lis $3	;tab
+; comment only
+L176: .word 0x181a972a
+L177: .word L171
+
+
+
+sw $27, -7($7)
+mflo $24
+
+mult $24, $20
+L178: div $31, $9
+L179: beq $17, $30, L85
+L180: bne $18, $25, L18
+; comment only
+sub $23, $29, $22
+L181: sub $25, $13, $25
+L182: beq $26, $24, L28 ; fwd
+; comment only
+beq $21, $6, L0 ; fwd
+L183: beq $0, $17, L122 ; fwd
+jalr $21
+.word -1354140774
+L184: .word 0x958d4848
+L185: ; comment only
+div $27, $19
+L186: beq $3, $3, L221 ; fwd
+add $20, $27, $24
+beq $19, $12, L194 ; fwd
+L187: sub $4, $7, $17
+.word 0x9bb5d0
+add $23, $6, $0
+multu $19, $22
+lis $3	;tab
+lis $3	;tab
+.word -1728975693
+sw $18, 43($18)
+div $4, $13
+
+L188: lis $2
+L189: add $15, $25, $18
+lis $3
+L190: sltu $5, $15, $22
+.word 0x5ffd5eef
+L191: 
+
+add $16, $22, $3
+beq $21, $3, L126 ; fwd
+multu $25, $17
+
+L192: lis $3	;tab
+lis $29
+lis $3	;tab
+; comment only
+mult $1, $8
+L193: beq $28, $26, L15 ; fwd
+; comment only
+L194: 
+; comment only
+sub $27, $2, $31
+L195: lis $2
+lw $17, 0x2b1b($8)
+mflo $24
+; comment only
+beq $27, $4, L49 ; fwd
+.word 1217884004
+add $13, $1, $27
+.word 4179669083
+.word L138
+.word L49
+sw $25, 17($20)
+lis $3	;tab
+.word L180
+
+L196: add $20, $6, $26
+L197: divu $31, $3
+lis $12
+.word 0xfff842ae
+.word L11
+.word L38
+; comment only
+L198: ; comment only
+.word L69
+sltu $31, $27, $29
+; comment only
+lw $29, 0x166a($24)
+.word 3548885831
+bne $29, $26, L152
+sub $16, $26, $23
+; comment only
+.word L26
+mult $21, $12
+.word 0x8d15177f
+beq $22, $29, L180
+
+sw $21, 16($16)
+divu $15, $6
+L199: .word L197
+lis $3	;tab
+jalr $16
+multu $16, $16
+jr $15
+beq $27, $8, L92 ; fwd
+beq $27, $0, L196
+
+.word 0x3054d299
+; comment only
+lis $3	;tab
+lis $3	;tab
+; comment only
+beq $13, $22, L125 ; fwd
+
+jalr $6
+lw $24, -84($10)
+.word -189422333
+.word 1991223698
+sw $3, 0xa30d($21)
+mflo $13
+add $5, $6, $19
+sltu $7, $21, $29
+; comment only
+L200: add $7, $19, $26
+.word 0xc3075edf
+jr $0
+
+slt $21, $8, $5
+; comment only
+.word L104
+beq $0, $24, L169
+multu $29, $2
+add $28, $11, $23
+L201: .word L107
+divu $9, $24
+lis $3	;tab
+L202: lis $3	;tab
+
+lis $24
+.word 0xbb0fe149
+add $26, $5, $4
+beq $27, $10, L67 ; fwd
+beq $3, $20, L203 ; fwd
+
+sw $5, 30($11)
+multu $16, $6
+sltu $18, $0, $18
+sltu $19, $15, $30
+sltu $18, $28, $0
+add $23, $17, $26
+lw $25, 0xf5cd($24)
+L203: div $1, $10
+.word 0x17fdf5c
+beq $19, $3, L239 ; fwd
+divu $29, $6
+beq $2, $9, L142
+lis $3	;tab
+L204: beq $20, $6, L54
+lw $4, 76($27)
+bne $2, $25, L126
+beq $4, $30, L118
+mfhi $0
+slt $11, $27, $26
+; comment only
+lis $3	;tab
+beq $30, $6, L175
+lw $13, 0xac90($12)
+add $23, $27, $16
+; comment only
+add $5, $20, $15
+lis $3	;tab
+L205: .word L4
+bne $10, $16, L79
+sltu $16, $25, $15
+lis $3	;tab
+divu $12, $25
+L206: add $17, $22, $29
+mflo $26
+beq $7, $23, L103 ; fwd
+add $11, $26, $13
+lis $3	;tab
+sub $0, $1, $6
+mfhi $25
+L207: lis $31
+add $15, $14, $28
+beq $5, $6, L11
+beq $31, $16, L12
+sw $29, 0xf459($11)
+add $5, $21, $28
+; comment only
+; comment only
+add $27, $8, $3
+div $1, $0
+sub $14, $4, $29
+L208: sw $3, -69($4)
+beq $29, $16, L121
+sltu $13, $17, $0
+; comment only
+sltu $12, $20, $17
+L209: beq $8, $31, L139
+.word L141
+mfhi $25
+lw $4, 0xfbae($29)
+L210: sw $2, 22($30)
+.word L22
+.word L7
+slt $16, $21, $18
+add $22, $7, $22
+jr $3
+
+beq $4, $21, L3 ; fwd
+.word -1053452791
+lis $8
+bne $4, $16, 0x5cb7
+; comment only
+L211: mult $25, $11
+beq $25, $28, L116 ; fwd
+L212: ; comment only
+add $7, $19, $10
+beq $21, $28, L145 ; fwd
+.word 1894994368
+multu $15, $11
+sw $1, 77($6)
+L213: jalr $28
+slt $20, $26, $13
+add $20, $15, $17
+lis $3	;tab
+.word L12
+add $6, $27, $12
+divu $21, $24
+sltu $25, $28, $19
+lw $4, -3($22)
+.word 3649761964
+L214: 
+.word 1250019399
+.word L167
+
+L215: divu $18, $30
+bne $24, $15, L26
+; comment only
+.word L213
+multu $29, $4
+sltu $24, $19, $24
+.word 0x11a8acfe
+.word L163
+add $2, $29, $16
+lis $28
+
+.word L117
+L216: div $16, $19
+mult $14, $10
+divu $22, $25
+div $14, $28
+.word 0x8849def5
+divu $31, $23
+beq $18, $2, L55 ; fwd
+mflo $31
+.word L102
+add $1, $21, $2
+bne $20, $25, L175
+beq $5, $26, L178
+sltu $8, $23, $18
+mfhi $23
+; comment only
+.word L59
+jalr $30
+
+.word L9
+.word 0xdf1d9f46
+mult $9, $29
+multu $1, $11
+lis $30
+.word L181
+lis $3	;tab
+L217: jr $27
+; comment only
+jalr $16
+L218: slt $28, $10, $15
+sw $31, 0xf75d($28)
+
+
+
+; comment only
+L219: lis $31
+sltu $21, $13, $1
+lis $3	;tab
+; comment only
+add $31, $14, $14
+divu $10, $15
+.word 0xa49ef71d
+
+add $28, $26, $31
+sw $5, 48($15)
+beq $2, $20, L49
+L220: lis $3	;tab
+lw $17, 0x3e55($12)
+lis $3	;tab
+jalr $27
+
+.word 0x198cbb84
+lis $3	;tab
+
+div $6, $0
+beq $5, $19, L89 ; fwd
+L221: lis $3	;tab
+sw $19, 24($20)
+add $29, $24, $23
+L222: 
+L223: sw $10, -21($31)
+multu $0, $11
+mult $5, $10
+multu $24, $11
+beq $19, $10, 0xfc31
+add $24, $10, $21
+lis $3	;tab
+L224: add $8, $18, $3
+.word L30
+bne $5, $10, L16
+slt $17, $24, $3
+multu $1, $2
+add $13, $23, $3
+L225: ; comment only
+lw $20, 0x8385($6)
+lis $3	;tab
+L226: mflo $30
+beq $23, $24, L3 ; fwd
+beq $9, $22, L140
+
+L227: beq $30, $16, L133
+lw $26, 0x1297($29)
+; comment only
+lis $22
+; comment only
+div $26, $5
+lis $3	;tab
+jr $31
+add $19, $27, $2
+lis $26
+add $5, $20, $29
+L228: .word -1992235700
+sub $23, $9, $30
+; comment only
+lis $3	;tab
+beq $27, $12, L128
+L229: 
+sw $29, -95($29)
+L230: lis $3
+mult $27, $10
+beq $1, $20, L99
+bne $16, $4, 0xbafb
+beq $29, $17, L123 ; fwd
+.word L52
+; comment only
+jalr $6
+div $15, $14
+lis $3	;tab
+.word L157
+
+
+; comment only
+sw $23, 89($0)
+lis $3	;tab
+.word 0x37fb9275
+L231: divu $20, $1
+.word L113
+lis $3	;tab
+lis $4
+.word 0x4abc63da
+
+add $30, $4, $22
+
+add $26, $3, $1
+lis $3	;tab
+L232: mult $25, $8
+.word L206
+lw $7, 0x570($8)
+L233: .word 0x80eb4a7a
+lw $13, 0x6b08($25)
+L234: .word L1
+L235: add $4, $6, $13
+lis $3	;tab
+L236: beq $10, $13, L110
+slt $10, $26, $14
+add $1, $30, $6
+L237: add $17, $29, $22
+slt $7, $12, $20
+; comment only
+
+L238: ; comment only
+L239: .word L142
+L240: slt $10, $14, $30
+bne $24, $15, L61
+; comment only
+.word 0xe1db6483
+.word 0xaa98d0c8
+sw $17, 0x3e46($27)
+lis $27
+.word 0xc537c138
+beq $2, $16, L191 ; fwd
+.word 0x409b691a
+.word L213
+
+sw $2, 0x126e($23)
+.word L173
+sub $24, $3, $5
+lw $10, 0xaf84($28)
+.word 2455038315
+.word 0x5f596c84
+add $18, $12, $12
+L241: sw $18, -28($24)
+
+
+mfhi $19
+L242: lw $9, 25($1)
+bne $21, $29, L209
+add $7, $4, $13
+slt $17, $31, $30
+beq $2, $20, L91 ; fwd
+mfhi $17
+; comment only
+lis $3	;tab
+beq $11, $17, L20 ; fwd
+mfhi $8
+.word L147
+; comment only
+multu $16, $12
+div $4, $24
+add $20, $30, $28
+L243: lw $23, 0x76a6($12)
+; comment only
+lw $17, -23($18)
+add $6, $15, $1
+mult $27, $14
+jalr $17
+L244: .word L93
+add $27, $19, $0
+.word L7
+; comment only
+slt $6, $8, $31
+
+.word L89
+beq $3, $25, L1 ; fwd
+add $27, $28, $8
+L245: add $24, $12, $8
+
+div $3, $6
+.word L57
+beq $16, $8, L145 ; fwd
+.word L87
+.word 0x2c55bdb8
+.word 0x6ff4acc2
+; comment only
+divu $25, $31
+divu $1, $26
+
+beq $25, $31, L24 ; fwd
+jalr $8
+lw $25, -50($20)
+add $13, $14, $28
+lis $19
+add $0, $15, $13
+.word 1445297578
+lis $3	;tab
+L246: lis $3	;tab
+lw $23, 0x5093($28)
+beq $22, $19, L103
+sub $13, $3, $2
+; comment only
+; comment only
+bne $25, $12, L76
+add $22, $9, $15
+multu $9, $31
+add $22, $12, $30
+beq $3, $24, L138 ; fwd
+; comment only
+div $14, $19
+add $12, $3, $12
+L247: 
+sub $22, $15, $16
+lw $28, 86($8)
+L248: beq $13, $7, L40 ; fwd
+.word 0xcf6f5974
+lis $3	;tab
+lis $3	;tab
+; comment only
+add $8, $22, $3
+lw $2, 0x7d0b($10)
+
+L249: lw $23, -97($0)
+beq $29, $18, L89 ; fwd
+beq $11, $4, L231 ; fwd
+beq $0, $2, L235 ; fwd
+mfhi $22
+.word -572203815
+beq $25, $10, L32 ; fwd
+div $9, $3
+div $23, $26
+bne $27, $24, L190
+.word 3625690397
+; comment only
+add $14, $8, $4
+lis $3	;tab
+mult $3, $21
+lw $5, -74($12)
+lis $3	;tab
+bne $13, $2, L151
+bne $0, $21, L144
+; comment only
+; comment only
+sub $12, $2, $14
+lis $3	;tab
+.word -1635512467
+beq $31, $9, L137
+add $14, $0, $18
+; comment only
+mflo $21
+.word 1806991320
+
+beq $7, $3, L181 ; fwd
+add $4, $17, $22
+lw $26, -48($14)
+sw $26, -6($20)
+; comment only
+beq $16, $7, L201 ; fwd
+sw $19, 87($17)
+sw $22, -18($22)
+.word 1301339478
+lis $3	;tab
+lis $5
+div $7, $26
+div $18, $2
+slt $18, $25, $25
+sub $29, $10, $0
+add $8, $20, $15
+add $31, $4, $4
+slt $24, $13, $0
+bne $24, $14, L15
+sub $7, $19, $7
+lis $13
+add $24, $21, $4
+; comment only
+; comment only
+.word 869661384
+sw $17, 0xe3f9($31)
+bne $30, $23, L83
+.word 0xdc51f20f
+sw $23, 0x5306($26)
+mult $16, $20
+slt $25, $18, $6
+beq $6, $6, L210 ; fwd
+jr $14
+
+add $1, $28, $15
+lis $3	;tab
+add $9, $30, $31
+div $17, $26
+.word L93
+
+jr $21
+add $4, $31, $6
+lw $9, 0x4f81($27)
+lw $28, 0xf1f0($25)
+sub $13, $14, $13
+lis $3	;tab
+add $22, $5, $20
+bne $26, $5, L229
+lis $3	;tab
+add $16, $18, $0
+jr $19
+lis $7
+.word 0x3fab7eaa
+; comment only
+; comment only
+lis $3	;tab
+.word L45
+
+add $22, $30, $21
+.word L122
+.word 0x1ea39259
+.word 1190184641
+div $10, $11
+lis $3	;tab
+divu $11, $21
+divu $14, $12
+bne $16, $16, L129
+.word 0xfa6576af
+.word 0x143c7c65
+sltu $18, $22, $30
+beq $28, $2, L246
+.word 0x5c85979a
+add $28, $0, $21
+lis $3	;tab
+.word 0x7e69446
+add $23, $25, $21
+mflo $7
+sw $2, 1($31)
+
+beq $11, $4, L83 ; fwd
+add $6, $16, $3
+lis $3	;tab
+beq $9, $13, L85
+lis $3	;tab
+; comment only
+slt $18, $9, $25
+add $6, $21, $20
+beq $29, $10, L199 ; fwd
+lis $3	;tab
+
+beq $3, $15, L216 ; fwd
+lis $3	;tab
+beq $6, $9, L103 ; fwd
+mfhi $1
+bne $21, $21, L192
+lis $3	;tab
+jalr $5
+.word 0x42c24024
+sltu $21, $19, $10
+
+beq $28, $18, L52 ; fwd
+beq $13, $29, L35
+; comment only
+add $21, $3, $16
+multu $27, $23
+mult $30, $19
+div $6, $20
+lis $25
+beq $15, $25, L14 ; fwd
+add $18, $17, $12
+; comment only
+.word L225
+lis $3	;tab
+beq $28, $27, L198 ; fwd
+add $0, $27, $9
+lw $22, 0x9843($1)
+lis $3	;tab
+beq $29, $11, L75 ; fwd
+beq $1, $15, L227 ; fwd
+lis $3	;tab
+bne $22, $17, L18
+.word 724701079
+sw $6, 0xea91($27)
+sub $23, $13, $9
+.word 1744763103
+beq $0, $3, L28
+jalr $4
+.word L123
+bne $22, $7, L117
+beq $17, $23, L144 ; fwd
+.word L188
+lw $28, -11($18)
+sub $11, $8, $29
+beq $16, $4, L47 ; fwd
+sw $6, 0x28ae($9)
+.word 0x3e5f5b25
+multu $27, $0
+beq $31, $2, L81 ; fwd
+add $0, $29, $12
+.word L109
+lw $2, 79($26)
+lis $3	;tab
+.word L53
+
+mult $18, $20
+mult $16, $11
+slt $19, $30, $27
+div $11, $10
+.word 0x90eb8bb3
+
+
+beq $18, $30, L209
+
+beq $21, $4, L79 ; fwd
+add $9, $7, $15
+lw $16, 88($31)
+lis $3	;tab
+mfhi $5
+sub $7, $21, $25
+beq $25, $16, L28
+sub $3, $1, $13
+slt $29, $31, $2
+add $18, $19, $3
+.word 0xf52de3f5
+add $8, $9, $12
+
+beq $10, $8, L25 ; fwd
+
+lis $3	;tab
+multu $19, $9
+bne $11, $11, L94
+
+add $21, $22, $17
+lis $3	;tab
+lw $23, -59($19)
+.word 750648468
+
+beq $3, $26, L226
+mfhi $26
+slt $28, $22, $19
+divu $29, $14
+.word 0x3ebea1a1
+sltu $20, $8, $28
+.word -607446292
+beq $30, $30, L131
+multu $28, $12
+.word 1738122356
+jr $1
+lis $3	;tab
+bne $2, $7, L131
+sw $27, -26($0)
+slt $8, $4, $13
+.word L12
+.word 415787890
+.word -579303667
+divu $14, $2
+.word L34
+mflo $13
+
+.word L148
+.word L122
+mult $5, $25
+sw $14, 0x182($13)
+.word 0x2f44016a
+sltu $27, $5, $24
+beq $11, $23, L237 ; fwd
+bne $17, $23, L28
+lis $3	;tab
+divu $16, $21
+add $12, $4, $19
+lis $3	;tab
+.word L194
+beq $28, $23, L186
+.word 0xbe6750c7
+beq $17, $8, L161
+beq $13, $6, L225 ; fwd
+; comment only
+add $31, $27, $14
+; comment only
+beq $25, $16, L196
+mfhi $11
+lis $3	;tab
+
+.word 0xd5f1ef8
+sltu $7, $21, $26
+add $19, $25, $29
+divu $19, $12
+lw $6, 46($15)
+lw $27, 93($23)
+lis $16
+slt $1, $10, $7
+sw $12, 0x552($8)
+; comment only
+; comment only
+
+sub $1, $19, $2
+
+slt $5, $28, $6
+bne $1, $29, L137
+jalr $30
+sltu $20, $3, $18
+mfhi $16
+.word L172
+divu $5, $20
+sltu $14, $7, $23
+mfhi $20
+lis $3	;tab
+sub $7, $9, $21
+; comment only
+mult $3, $12
+.word L50
+multu $31, $27
+beq $20, $11, L62 ; fwd
+add $11, $28, $19
+lis $3	;tab
+.word 0x56823c61
+sltu $19, $27, $22
+.word L64
+jr $12
+add $8, $1, $17
+sw $30, -53($10)
+slt $3, $9, $19
+.word L173
+beq $18, $20, L140
+add $2, $25, $27
+lw $20, 14($29)
+sw $2, 0xb4fe($25)
+.word 0xc7fea397
+bne $3, $15, L249
+lis $3	;tab
+; comment only
+lis $3	;tab
+; comment only
+lw $16, 0xf0fd($30)
+add $7, $9, $12
+lw $23, 0x4035($8)
+slt $13, $5, $27
+add $14, $25, $21
+
+; comment only
+
+lis $3	;tab
+lw $3, 0x396($21)
+
+div $30, $26
+lis $3	;tab
+multu $19, $10
+.word L175
+div $28, $8
+lis $3	;tab
+; comment only
+lis $3	;tab
+.word 0xd4f8a1ae
+add $2, $21, $15
+beq $12, $3, L149 ; fwd
+.word 0xca79fb47
+beq $10, $14, L216 ; fwd
+lis $3	;tab
+; comment only
+mult $18, $9
+add $18, $6, $16
+lw $0, 37($11)
+beq $9, $5, L201
+sw $16, 0x84b3($5)
+add $13, $17, $20
+.word L85
+.word L239
+
+.word 310762037
+; comment only
+lis $15
+jr $13
+.word -243011452
+mfhi $5
+slt $22, $26, $30
+lw $23, -11($7)
+add $25, $17, $26
+.word L11
+; comment only
+add $17, $26, $22
+; comment only
+beq $26, $3, L36 ; fwd
+sub $31, $16, $18
+bne $16, $1, L124
+.word L6
+slt $16, $29, $15
+.word L196
+div $30, $22
+sw $16, 0x52aa($13)
+multu $29, $30
+divu $27, $25
+add $10, $13, $24
+sub $16, $4, $29
+beq $4, $21, L246
+bne $25, $19, L44
+mfhi $31
+add $9, $22, $24
+; comment only
+div $18, $26
+lis $3	;tab
+mult $0, $7
+beq $9, $30, L233 ; fwd
+sub $26, $3, $20
+.word L61
+add $27, $28, $0
+.word 0xc5b89ad5
+beq $4, $13, L101
+
+.word 4277288213
+.word L25
+
+beq $16, $29, L120 ; fwd
+.word L5
+beq $10, $22, L150
+sltu $9, $19, $13
+add $2, $13, $16
+
+lis $3	;tab
+sub $12, $5, $5
+lw $3, 0x1108($9)
+.word L140
+; comment only
+add $6, $8, $7
+lis $3	;tab
+; comment only
+sw $14, 0xab43($25)
+div $4, $18
+.word -1034547066
+.word 495275854
+; comment only
+
+sw $27, -62($10)
+lis $21
+
+.word L137
+.word 0x63fd363e
+; comment only
+sw $4, -50($23)
+; comment only
+jr $29
+add $26, $10, $28
+beq $2, $10, L15
+bne $20, $3, L67
+lw $14, 0x3aa3($0)
+; comment only
+.word L109
+
+.word 4069459473
+beq $28, $21, L29 ; fwd
+; comment only
+add $27, $2, $18
+bne $11, $3, L20
+bne $29, $14, L180
+divu $25, $4
+mfhi $18
+sw $11, 45($11)
+mflo $13
+sw $29, 0xf164($10)
+sub $10, $8, $7
+lis $3	;tab
+beq $15, $22, L26 ; fwd
+bne $13, $12, L111
+slt $17, $13, $11
+sub $13, $11, $9
+add $12, $26, $0
+.word -1379190006
+add $19, $16, $4
+lw $20, 0x6952($5)
+add $2, $28, $12
+.word L244
+.word L249
@@ -0,0 +1,2001 @@
+; comment only
+L0: 
+
+L1: add $30, $16, $14
+lis $3	;tab
+; comment only
+beq $9, $14, L162 ; fwd
+; comment only
+add $4, $10, $2
+add $17, $30, $24
+.word 0xef829c88
+L2: divu $13, $16
+.word 0xd55ec1a5
+.word 361858708
+
+div $6, $13
+
+sub $30, $30, $5
+slt $9, $1, $18
+.word 0xb813439
+lw $2, -21($6)
+add $12, $26, $18
+mult $21, $20
+divu $24, $29
+.word 0x81cc8265
+lis $3	;tab
+sw $16, 0x4d90($0)
+
+.word 0xa0996d52
+bne $31, $1, L0
+sw $19, 0x99f8($11)
+bne $16, $19, L0
+beq $8, $19, L128 ; fwd
+lw $20, 0xad95($6)
+L3: bne $14, $28, L2
+jalr $28
+sub $12, $20, $11
+beq $22, $8, 3
+sw $22, 0x6aba($26)
+add $26, $9, $12
+L4: 
+.word 0xf69f28d8
+sltu $18, $7, $15
+L5: lis $3	;tab
+jr $3
+L6: lis $3	;tab
+L7: ; comment only
+beq $1, $26, L13 ; fwd
+
+L8: div $30, $3
+mfhi $7
+lw $0, 0xa0ec($3)
+lis $27
+L9: beq $3, $8, L0
+L10: add $5, $31, $20
+slt $24, $24, $19
+lis $27
+L11: ; comment only
+L12: lis $3	;tab
+sltu $11, $2, $23
+beq $24, $2, L159 ; fwd
+add $23, $31, $20
+lis $3	;tab
+add $15, $13, $17
+slt $14, $27, $8
+bne $16, $7, L1
+lis $3	;tab
+; comment only
+beq $6, $20, L144 ; fwd
+
+.word L2
+.word 2337805938
+beq $1, $7, 36
+sw $5, -91($6)
+sltu $3, $20, $11
+mflo $15
+lis $3	;tab
+.word 0x9975c976
+slt $15, $26, $10
+
+beq $30, $9, L164 ; fwd
+multu $6, $31
+lis $3	;tab
+.word L9
+multu $17, $12
+L13: ; comment only
+jalr $18
+.word 0xe3b05135
+L14: .word L12
+div $15, $20
+divu $30, $13
+beq $1, $30, L184 ; fwd
+L15: .word -1950575043
+beq $4, $13, L218 ; fwd
+lis $8
+lis $3	;tab
+add $16, $10, $2
+.word 2538145664
+L16: lw $22, 0x948e($0)
+L17: bne $24, $31, -41
+.word L12
+L18: beq $17, $4, L3
+; comment only
+sltu $23, $23, $28
+beq $16, $6, L193 ; fwd
+beq $31, $22, L9
+
+beq $9, $11, L94 ; fwd
+beq $29, $7, L27 ; fwd
+div $26, $19
+.word L15
+mult $6, $11
+; comment only
+.word 0x440e7cf7
+L19: mult $30, $17
+; comment only
+bne $28, $4, L3
+
+L20: sltu $7, $11, $12
+beq $25, $8, L151 ; fwd
+.word 0x2dcba933
+lw $28, 0xf306($20)
+
+.word L16
+sw $1, 53($6)
+beq $14, $31, L44 ; fwd
+.word L6
+; comment only
+; comment only
+.word L3
+beq $9, $8, L119 ; fwd
+
+add $23, $14, $4
+add $21, $20, $21
+lis $3	;tab
+sltu $2, $5, $21
+mfhi $12
+jr $20
+L21: add $26, $4, $12
+.word 0xb303e1b2
+.word L9
+L22: .word L22
+divu $2, $16
+bne $23, $25, L0
+sw $9, 17($10)
+divu $10, $1
+L23: 
+.word L5
+L24: add $25, $28, $20
+lis $3	;tab
+jr $2
+add $14, $15, $6
+mflo $21
+beq $3, $18, -15
+sw $15, 43($21)
+bne $5, $3, L2
+add $6, $1, $5
+L25: ; comment only
+L26: add $12, $21, $12
+.word L10
+beq $24, $19, L20
+slt $11, $26, $7
+; comment only
+beq $25, $11, L214 ; fwd
+lis $3	;tab
+; comment only
+div $26, $28
+lis $3	;tab
+lw $24, 24($10)
+add $29, $5, $6
+
+beq $3, $3, L115 ; fwd
+lis $3	;tab
+beq $4, $12, L3
+lw $28, -80($15)
+multu $0, $7
+mflo $26
+
+; comment only
+.word L5
+add $7, $1, $6
+lw $6, 19($6)
+beq $22, $25, L154 ; fwd
+slt $28, $24, $13
+L27: add $29, $19, $4
+jr $4
+beq $23, $27, L200 ; fwd
+
+lis $3
+.word 0x403da74b
+mflo $29
+; comment only
+beq $26, $30, L13
+
+lw $11, -76($18)
+add $30, $2, $12
+sw $27, 0x5844($12)
+lw $6, 0x4ca1($28)
+L28: divu $18, $24
+beq $23, $10, L110 ; fwd
+.word L15
+; comment only
+sw $1, 0x5f9d($19)
+; comment only
+L29: multu $1, $10
+add $13, $29, $22
+beq $31, $11, L17
+beq $6, $28, L15
+.word L13
+beq $1, $27, L10
+
+divu $21, $8
+mult $1, $31
+.word L14
+
+beq $18, $11, L8
+; comment only
+L30: bne $29, $17, L18
+div $8, $2
+jr $17
+L31: 
+slt $8, $17, $17
+L32: beq $4, $23, L8 ; fwd
+beq $28, $12, L79 ; fwd
+divu $25, $20
+L33: mfhi $20
+.word 0x919e6f9
+slt $14, $12, $5
+sltu $7, $0, $18
+lis $3	;tab
+L34: sw $29, -32($11)
+multu $9, $11
+.word L25
+divu $3, $11
+div $12, $8
+add $9, $13, $24
+.word 0xfccdef69
+L35: sub $18, $8, $24
+
+L36: mfhi $23
+.word L15
+L37: ; comment only
+.word L6
+bne $1, $22, L28
+.word L34
+.word L9
+.word 3008439443
+div $17, $12
+L38: 
+.word -1383480133
+.word 796596336
+
+multu $20, $29
+bne $22, $22, L21
+sw $11, -69($21)
+lis $27
+.word L8
+; comment only
+divu $3, $4
+; comment only
+lw $15, -3($4)
+mfhi $31
+.word 3820738385
+; comment only
+.word L23
+beq $6, $31, L37 ; fwd
+add $23, $4, $0
+L39: sub $20, $27, $18
+add $20, $28, $23
+jr $21
+sltu $24, $14, $30
+L40: sw $12, -70($5)
+bne $0, $31, L17
+L41: jalr $27
+beq $19, $27, L73 ; fwd
+L42: lis $3	;tab
+sub $28, $20, $4
+bne $27, $6, L41
+
+beq $25, $5, L33
+L43: ; comment only
+
+multu $30, $25
+.word L42
+mflo $19
+
+L44: ; comment only
+; comment only
+
+lis $3	;tab
+.word L3
+lw $31, -45($29)
+L45: ; comment only
+lis $11
+bne $15, $24, 37
+L46: .word 0x3933b869
+lw $21, 87($14)
+multu $15, $30
+lis $14
+; comment only
+; comment only
+div $28, $23
+L47: ; comment only
+.word L1
+sw $31, 0x639f($22)
+
+mult $26, $21
+div $6, $22
+sw $9, 0x5ff4($2)
+beq $12, $5, L179 ; fwd
+; comment only
+
+sw $26, 0xa6b3($0)
+; comment only
+bne $30, $23, L15
+jalr $24
+beq $20, $31, L25
+.word 0xb94ee1cc
+multu $7, $6
+slt $20, $25, $17
+L48: sw $14, -34($7)
+.word 0xae7fbc04
+; comment only
+beq $14, $15, L66 ; fwd
+lis $3	;tab
+sub $8, $5, $14
+beq $20, $9, L42
+; comment only
+L49: .word L47
+
+.word -300793265
+L50: divu $0, $13
+multu $23, $16
+L51: ; comment only
+beq $7, $10, L47
+L52: .word 0x2641202c
+
+lw $5, 59($6)
+L53: sltu $25, $29, $28
+lis $3	;tab
+slt $26, $10, $0
+L54: ; comment only
+beq $2, $13, L51
+beq $20, $14, L112 ; fwd
+add $22, $13, $14
+.word -1735630375
+add $25, $1, $21
+.word L36
+beq $24, $13, L133 ; fwd
+beq $19, $4, L45 ; fwd
+; comment only
+lw $28, 0x2049($10)
+; comment only
+sub $31, $4, $30
+lis $3	;tab
+.word -2060093802
+L55: ; comment only
+add $3, $22, $18
+.word L31
+lw $19, 60($25)
+add $7, $12, $15
+L56: lis $3	;tab
+lis $3	;tab
+; comment only
+L57: mult $19, $0
+bne $5, $26, L21
+.word 0xf0214df0
+lis $3	;tab
+.word L47
+beq $16, $30, L48
+beq $15, $3, L15
+beq $11, $28, L56
+
+.word 0x64f0d40f
+mflo $14
+
+L58: .word 0xc42a04b2
+; comment only
+.word 484385554
+lis $3	;tab
+add $12, $6, $8
+; comment only
+sub $13, $18, $8
+.word 0x285bc0e3
+beq $28, $1, L65 ; fwd
+
+bne $13, $7, L5
+.word 3194895713
+slt $19, $13, $13
+.word 2154623167
+lw $16, 0x3425($9)
+mflo $7
+lw $25, 0x940d($12)
+lis $22
+slt $25, $22, $15
+sltu $7, $1, $11
+beq $14, $20, L49
+; comment only
+L59: bne $1, $31, L45
+divu $0, $7
+bne $17, $24, L54
+.word L23
+lis $3	;tab
+L60: ; comment only
+
+.word L0
+lis $3	;tab
+jalr $7
+multu $16, $20
+L61: ; comment only
+L62: lis $0
+add $24, $10, $6
+; comment only
+lis $3	;tab
+add $29, $27, $5
+L63: sltu $5, $12, $6
+beq $21, $1, L204 ; fwd
+lis $3	;tab
+sltu $13, $20, $28
+
+beq $12, $0, L55
+L64: bne $26, $30, L38
+lw $14, 0x2a3a($28)
+jalr $20
+beq $18, $23, L49
+
+; comment only
+mfhi $22
+L65: lis $3	;tab
+add $29, $16, $31
+lis $3	;tab
+lis $3	;tab
+lw $4, 0xc865($25)
+lis $8
+
+multu $15, $29
+slt $23, $12, $6
+L66: .word L38
+add $20, $18, $11
+
+sw $21, -39($2)
+; comment only
+L67: add $11, $2, $30
+sub $23, $15, $30
+beq $3, $0, L192 ; fwd
+beq $20, $9, L146 ; fwd
+lis $22
+divu $27, $25
+L68: .word 0x9e1d9be6
+beq $0, $11, L5
+.word 0xafd3f8b1
+L69: sw $11, 0xe856($26)
+jalr $22
+jr $23
+lw $14, -7($15)
+.word L33
+
+; comment only
+.word L21
+.word 0xfda7b329
+L70: .word 0x930825b0
+lis $3	;tab
+.word 0x135063e4
+lw $12, 0xb1c0($13)
+jalr $14
+
+mfhi $7
+add $26, $2, $19
+beq $8, $16, L60
+beq $24, $16, L134 ; fwd
+beq $30, $5, L49 ; fwd
+add $31, $3, $26
+sltu $25, $20, $26
+bne $4, $29, L32
+lis $3	;tab
+L71: ; comment only
+L72: jalr $22
+beq $15, $20, L221 ; fwd
+sltu $0, $9, $12
+beq $6, $12, L90 ; fwd
+sub $25, $29, $1
+beq $24, $26, L13
+L73: lis $3	;tab
+L74: lis $3	;tab
+mflo $28
+lis $3	;tab
+.word L64
+multu $14, $31
+beq $3, $14, L159 ; fwd
+beq $22, $4, L163 ; fwd
+beq $1, $28, L28 ; fwd
+mfhi $11
+; comment only
+beq $27, $1, L56
+.word L30
+L75: 
+
+jalr $17
+L76: .word L52
+L77: .word 2636580548
+L78: .word L3
+multu $20, $21
+lis $3	;tab
+sub $22, $3, $1
+beq $4, $11, L3
+beq $30, $0, L218 ; fwd
+.word -496584212
+beq $4, $20, L69
+.word -1480422527
+; comment only
+.word 3462760129
+
+beq $18, $9, L39 ; fwd
+beq $0, $15, L44 ; fwd
+.word L47
+.word 0x8fe9477c
+lw $20, 0x146e($27)
+.word L38
+L79: jr $30
+sltu $24, $31, $13
+lw $18, 0xc9aa($4)
+L80: mfhi $2
+; comment only
+.word 3995958545
+.word -213997761
+sltu $22, $22, $1
+beq $3, $17, L125 ; fwd
+add $13, $24, $2
+add $5, $15, $20
+slt $25, $0, $24
+sw $8, 70($9)
+; comment only
+L81: sub $15, $1, $15
+bne $2, $26, L9
+.word L31
+beq $22, $23, L12
+divu $5, $21
+beq $5, $8, L38
+; comment only
+slt $4, $12, $6
+
+beq $11, $10, L73
+lis $3	;tab
+multu $21, $20
+mfhi $11
+add $15, $17, $19
+L82: .word L47
+sw $28, 45($21)
+lis $30
+.word L39
+lis $3	;tab
+beq $30, $7, L23
+mult $21, $3
+lw $15, 0x5ea3($11)
+beq $8, $9, L80 ; fwd
+beq $19, $20, L10
+jalr $7
+sub $1, $31, $28
+bne $13, $18, L9
+sltu $27, $5, $9
+divu $15, $17
+.word 0x3d681103
+; comment only
+beq $16, $10, L231 ; fwd
+add $14, $5, $11
+L83: jalr $4
+.word L52
+; comment only
+mfhi $20
+beq $16, $22, L6 ; fwd
+jalr $28
+beq $1, $31, L118 ; fwd
+div $5, $22
+sw $28, -20($1)
+lw $6, 0x71d7($28)
+; comment only
+add $22, $27, $17
+beq $21, $9, L224 ; fwd
+jalr $23
+L84: add $1, $31, $27
+
+.word -529566809
+.word 0x3faee5a1
+lis $25
+beq $0, $1, L11
+beq $19, $27, L240 ; fwd
+L85: 
+beq $11, $8, L81
+jalr $12
+beq $31, $19, L231 ; fwd
+; comment only
+sw $22, 75($23)
+div $17, $12
+bne $29, $6, L1
+.word L57
+
+bne $29, $22, L32
+sub $5, $3, $18
+; comment only
+lis $3	;tab
+add $0, $13, $19
+.word L38
+
+
+.word 1427999327
+; comment only
+mflo $4
+sw $19, 68($30)
+.word 0xb34f33bc
+.word L11
+sub $24, $1, $28
+L86: .word 0xa141997a
+L87: lw $0, 0x45ce($17)
+beq $6, $22, L221 ; fwd
+
+slt $16, $4, $24
+beq $28, $5, L208 ; fwd
+sw $21, 0x5077($8)
+lw $29, 0x27c3($15)
+
+L88: 
+lis $12
+add $5, $25, $7
+add $13, $31, $26
+bne $15, $25, L52
+jr $30
+add $23, $23, $2
+bne $6, $13, L59
+
+bne $27, $27, L85
+divu $16, $25
+
+add $4, $28, $6
+L89: bne $16, $17, L12
+
+lis $3	;tab
+; comment only
+sw $1, -98($15)
+.word 0x9401f59b
+lis $3	;tab
+mflo $16
+L90: .word 0x2e7eaea8
+.word 1324452735
+
+
+
+sub $18, $21, $13
+beq $6, $30, L69 ; fwd
+sub $2, $10, $13
+; comment only
+beq $6, $1, L98 ; fwd
+sw $14, 0xa344($28)
+.word L35
+beq $23, $26, L180 ; fwd
+.word 0xf3c2d184
+add $17, $12, $11
+L91: lw $30, 0xfbc3($7)
+beq $10, $18, L157 ; fwd
+; comment only
+L92: sw $12, 0($30)
+sw $4, 0xff6f($18)
+.word L67
+beq $14, $5, L65
+L93: ; comment only
+sub $15, $11, $10
+div $19, $9
+add $2, $12, $22
+bne $24, $2, L3
+add $25, $25, $5
+beq $9, $8, L93 ; fwd
+
+divu $15, $24
+L94: add $17, $12, $28
+
+
+lis $3	;tab
+beq $29, $29, L196 ; fwd
+beq $12, $25, L85
+; comment only
+.word L39
+mflo $30
+mfhi $11
+sw $19, -26($18)
+lis $3	;tab
+bne $24, $20, L92
+beq $12, $22, L194 ; fwd
+div $3, $19
+L95: .word L14
+L96: mflo $21
+mfhi $17
+
+add $24, $9, $2
+beq $19, $21, L87 ; fwd
+.word L47
+beq $14, $11, L66 ; fwd
+L97: .word L45
+beq $23, $27, L113 ; fwd
+.word 0x2ad31a2c
+sw $4, 0x9916($3)
+sub $18, $14, $9
+div $11, $18
+bne $4, $21, L89
+lis $3	;tab
+
+add $30, $26, $29
+sub $2, $26, $10
+beq $25, $18, L30 ; fwd
+; comment only
+
+beq $25, $26, L184 ; fwd
+multu $2, $18
+; comment only
+L98: ; comment only
+add $14, $9, $5
+.word 0xbb6903e5
+div $1, $14
+L99: .word L65
+; comment only
+beq $9, $22, L148 ; fwd
+.word L11
+lis $3	;tab
+.word L81
+lis $13
+add $10, $22, $4
+L100: .word L12
+lis $9
+
+multu $3, $6
+lis $3	;tab
+slt $9, $14, $28
+L101: sltu $19, $27, $2
+L102: add $2, $15, $23
+L103: lw $7, 0xe253($7)
+jr $3
+lis $3	;tab
+slt $3, $11, $16
+beq $18, $30, L94 ; fwd
+beq $28, $1, L109 ; fwd
+
+
+
+lw $23, 0x21d1($12)
+.word L90
+
+; comment only
+.word 0x10140f4b
+
+add $15, $10, $12
+sub $18, $11, $1
+beq $15, $7, L138 ; fwd
+; comment only
+mflo $11
+beq $20, $16, L207 ; fwd
+L104: 
+sub $19, $15, $26
+lis $3	;tab
+sw $20, 0xf76d($7)
+.word 1437802993
+beq $7, $6, L138 ; fwd
+slt $31, $2, $27
+L105: divu $2, $11
+beq $5, $26, L10
+
+; comment only
+bne $23, $27, L0
+divu $28, $7
+div $4, $29
+.word L38
+L106: ; comment only
+lis $3	;tab
+sw $21, -79($28)
+L107: .word -667002344
+lis $3	;tab
+add $20, $29, $16
+beq $14, $16, L227 ; fwd
+add $7, $22, $9
+lw $11, 65($1)
+.word 0xaa6dfbf4
+beq $7, $2, L216 ; fwd
+L108: sw $28, -78($17)
+div $30, $13
+L109: .word L83
+
+sw $29, 18($26)
+.word L76
+lw $23, -49($30)
+L110: beq $19, $3, L4
+L111: .word 3653819474
+.word 0xe64bd139
+add $14, $27, $18
+L112: beq $30, $29, L79 ; fwd
+.word 0x2bab3f51
+L113: ; comment only
+beq $3, $12, L208 ; fwd
+slt $11, $27, $15
+
+jalr $15
+beq $0, $15, L50
+mflo $2
+jalr $10
+.word 231395625
+L114: lis $3	;tab
+sltu $8, $3, $27
+mflo $22
+add $4, $15, $2
+L115: .word L71
+lw $26, 0x7e7($5)
+sltu $6, $20, $0
+beq $7, $22, L33 ; fwd
+sw $13, 0x6ba7($21)
+.word L101
+mfhi $9
+lis $3	;tab
+L116: lis $2
+multu $2, $15
+lis $3	;tab
+lis $3	;tab
+
+L117: div $26, $7
+.word 1758605103
+beq $22, $0, L194 ; fwd
+.word 0x41cdef44
+.word L83
+beq $4, $3, L220 ; fwd
+L118: add $18, $9, $5
+slt $26, $28, $31
+; comment only
+L119: .word L75
+add $2, $6, $18
+multu $23, $21
+div $27, $22
+; comment only
+div $0, $22
+lis $26
+mult $18, $29
+L120: lis $3	;tab
+slt $3, $9, $26
+L121: sub $5, $20, $12
+L122: sw $24, 9($7)
+L123: jr $18
+L124: .word 3403780663
+add $1, $12, $0
+sw $14, 0x931d($7)
+mult $30, $25
+lis $3	;tab
+.word L66
+L125: sw $20, 40($30)
+beq $3, $18, L5 ; fwd
+sw $22, 0x8976($4)
+beq $17, $15, L213 ; fwd
+add $19, $20, $8
+divu $3, $16
+L126: lis $3	;tab
+.word L98
+sw $25, 0x9c07($28)
+mfhi $24
+.word L82
+multu $9, $31
+L127: slt $24, $0, $17
+jr $9
+lis $3	;tab
+beq $16, $9, L70
+sub $20, $18, $23
+mfhi $12
+beq $8, $30, L18
+.word 3825235275
+
+lis $21
+beq $2, $19, L156 ; fwd
+multu $3, $0
+sw $21, -43($20)
+.word -900716005
+add $19, $19, $0
+sw $14, 0xb969($15)
+.word 0xa057e254
+
+.word 1044612653
+bne $15, $14, L14
+.word L86
+beq $6, $14, L117
+slt $23, $29, $29
+; comment only
+lw $5, -42($15)
+add $24, $12, $6
+
+mfhi $29
+add $0, $8, $16
+divu $22, $5
+lis $3	;tab
+lw $12, 0x78ee($26)
+.word 3137507571
+.word L7
+.word L90
+L128: jalr $26
+L129: beq $21, $10, L20
+
+bne $29, $27, L91
+mfhi $27
+beq $29, $29, L68 ; fwd
+.word 1021326842
+divu $21, $20
+L130: mflo $5
+mult $23, $0
+beq $14, $2, L248 ; fwd
+lw $12, 0x90b($22)
+beq $15, $26, L205 ; fwd
+L131: .word 0xea54b2e0
+L132: ; comment only
+beq $29, $28, L45
+.word L74
+sub $0, $7, $20
+div $26, $26
+add $21, $30, $9
+add $25, $9, $0
+bne $1, $15, L112
+sltu $4, $0, $12
+lw $17, 0x9078($23)
+.word 1514123243
+.word -2041913212
+lis $5
+add $0, $20, $8
+multu $23, $8
+beq $17, $16, L161 ; fwd
+lis $3	;tab
+add $12, $17, $11
+lw $13, 0x2129($29)
+; comment only
+lis $1
+sw $19, 0xc546($21)
+
+lis $3	;tab
+sub $20, $13, $23
+
+L133: mflo $8
+L134: lis $18
+
+jalr $0
+add $22, $24, $5
+mfhi $3
+lis $3	;tab
+divu $0, $31
+lis $3	;tab
+L135: beq $8, $0, L14
+jr $8
+beq $29, $2, L122 ; fwd
+slt $9, $27, $20
+sw $13, 0x853($1)
+.word L97
+.word -892636984
+.word 0x68d40bb1
+divu $25, $24
+.word 0x1d6b7096
+add $31, $4, $25
+add $10, $31, $14
+lis $14
+divu $23, $14
+beq $24, $24, L181 ; fwd
+add $20, $8, $25
+.word L109
+jalr $26
+lis $3	;tab
+; comment only
+; comment only
+lw $25, 99($9)
+
+L136: beq $21, $15, L110
+beq $12, $16, L155 ; fwd
+lis $3	;tab
+add $9, $19, $9
+L137: 
+sw $10, 0xfccd($3)
+.word 0x292e556d
+.word 1926341545
+L138: ; comment only
+; comment only
+beq $10, $19, L76
+add $8, $29, $2
+; comment only
+add $13, $1, $11
+beq $31, $22, L98 ; fwd
+beq $6, $30, L237 ; fwd
+bne $19, $6, L117
+L139: .word L103
+; comment only
+bne $19, $5, L21
+mflo $27
+div $31, $14
+beq $19, $12, L68
+L140: 
+divu $28, $13
+L141: 
+mfhi $2
+sw $21, 0x9c69($21)
+L142: lw $12, 0xde5e($17)
+mult $6, $7
+lis $3	;tab
+.word L110
+L143: sltu $14, $5, $21
+sw $23, -19($30)
+bne $21, $9, L72
+
+L144: ; comment only
+jr $5
+.word 0xef4eaaec
+mflo $28
+
+mult $18, $15
+mflo $0
+add $4, $12, $25
+
+lw $15, 0xba55($22)
+bne $23, $20, L56
+L145: divu $5, $30
+lw $18, 69($17)
+beq $21, $2, L150 ; fwd
+lis $3	;tab
+beq $21, $31, L91
+L146: sltu $25, $2, $4
+slt $19, $14, $26
+; comment only
+jalr $14
+beq $13, $28, L76
+beq $19, $1, L158 ; fwd
+
+L147: add $21, $30, $30
+add $21, $4, $16
+sub $16, $7, $30
+add $9, $22, $0
+sw $31, 0xb27a($13)
+; comment only
+.word L85
+.word L42
+multu $7, $27
+lis $14
+; comment only
+.word 2889857033
+mult $22, $6
+; comment only
+multu $23, $26
+L148: ; comment only
+.word L9
+lis $3	;tab
+.word L32
+lis $3	;tab
+multu $26, $20
+; comment only
+
+L149: 
+lis $3	;tab
+sltu $20, $26, $6
+L150: ; comment only
+add $17, $18, $20
+
+L151: mflo $3
+; comment only
+; comment only
+lis $3	;tab
+L152: .word L137
+L153: lis $3	;tab
+.word L27
+.word 2452842075
+bne $31, $23, L52
+L154: add $24, $2, $23
+beq $2, $7, L53 ; fwd
+L155: beq $31, $29, L225 ; fwd
+L156: .word L85
+bne $6, $16, L50
+beq $22, $18, L149
+lw $18, 0x13fd($7)
+; comment only
+.word L80
+bne $24, $23, L37
+lw $10, -43($20)
+sub $7, $31, $10
+L157: ; comment only
+add $14, $19, $27
+slt $19, $15, $23
+lw $20, 0x3ce8($21)
+sw $10, 0xee1a($28)
+.word L83
+lis $3	;tab
+; comment only
+bne $15, $10, L62
+mflo $20
+L158: ; comment only
+sub $11, $24, $12
+bne $0, $2, L114
+sw $24, 22($13)
+add $0, $3, $9
+.word 2888230799
+mult $10, $19
+L159: .word L48
+add $30, $16, $12
+slt $16, $28, $29
+beq $6, $19, L101
+add $11, $27, $27
+L160: div $9, $5
+L161: 
+sw $2, 0x397d($13)
+lis $3	;tab
+.word L152
+mult $25, $20
+L162: lis $3	;tab
+beq $31, $21, L62 ; fwd
+L163: beq $18, $20, L7 ; fwd
+lw $26, -37($16)
+; comment only
+sltu $3, $28, $6
+
+add $16, $31, $25
+; comment only
+beq $11, $3, L23 ; fwd
+.word L41
+sw $4, -8($23)
+L164: .word L76
+
+beq $26, $12, L55 ; fwd
+lis $3	;tab
+div $18, $22
+add $12, $24, $5
+lw $31, 31($3)
+jr $8
+sw $11, 0xde40($30)
+lis $3	;tab
+L165: 
+sltu $5, $15, $29
+bne $11, $29, L140
+L166: add $30, $17, $26
+L167: jalr $25
+beq $6, $15, L55
+sub $1, $27, $9
+bne $25, $14, L6
+mult $9, $10
+; comment only
+add $10, $29, $10
+L168: sub $17, $23, $28
+sw $18, -46($15)
+slt $23, $0, $18
+divu $18, $29
+L169: bne $29, $0, L51
+.word 0x57158d45
+.word 3556060392
+L170: ; comment only
+bne $29, $18, L63
+beq $11, $3, L27 ; fwd
+beq $25, $29, L5 ; fwd
+lw $19, 0x6ed3($11)
+lis $3	;tab
+L171: mflo $6
+bne $11, $16, L134
+; comment only
+mfhi $18
+bne $28, $25, L142
+jr $3
+multu $17, $25
+add $11, $24, $17
+lis $3	;tab
+L172: ; comment only
+mflo $13
+mfhi $3
+.word 0xe8064b41
+sw $15, -63($23)
+L173: 
+
+beq $0, $28, L11 ; fwd
+beq $14, $3, L68
+sw $23, -30($17)
+mfhi $8
+L174: .word L12
+beq $0, $3, L13
+multu $20, $27
+beq $11, $25, L217 ; fwd
+L175: add $13, $4, $1
+jalr $22
+.word L23
+; comment only
+L176: sw $21, -78($0)
+.word L111
+div $28, $0
+add $21, $11, $25
+beq $31, $9, L169
+L177: lis $3	;tab
+sltu $3, $11, $29
+add $18, $6, $11
+L178: .word L43
+sw $28, 0x6517($20)
+; comment only
+sw $15, 0x54eb($3)
+.word 2267507246
+; comment only
+lis $3	;tab
+beq $31, $18, L63 ; fwd
+L179: div $24, $10
+beq $21, $10, L71
+.word L15
+; comment only
+L180: .word L165
+; comment only
+
+jalr $8
+L181: beq $28, $19, L39 ; fwd
+jr $6
+sltu $24, $22, $16
+L182: divu $17, $4
+.word L108
+beq $0, $7, L39 ; fwd
+.word 0x8c21062e
+beq $29, $29, L119 ; fwd
+sub $12, $13, $5
+sw $16, 0xcb2c($27)
+.word 1056161431
+.word 0xd1623ed
+multu $11, $25
+sltu $30, $17, $17
+.word L13
+beq $3, $15, L101 ; fwd
+sub $10, $17, $9
+beq $9, $9, L36
+add $5, $0, $23
+lis $3	;tab
+beq $12, $0, L119 ; fwd
+beq $14, $16, L128
+.word L177
+add $1, $14, $12
+beq $9, $10, L236 ; fwd
+sltu $3, $27, $1
+.word L168
+sw $4, -84($11)
+mfhi $9
+L183: ; comment only
+L184: .word 0xf9ac3461
+mflo $6
+.word 0x217ea0a6
+lis $3	;tab
+lw $7, 43($29)
+.word L70
+
+beq $13, $4, L73 ; fwd
+sub $5, $0, $14
+sw $6, 0x6652($23)
+.word L83
+lis $3	;tab
+.word L103
+lis $3	;tab
+L185: ; comment only
+; comment only
+sltu $8, $30, $11
+
+divu $17, $1
+lis $3	;tab
+.word 3845599057
+.word 814661542
+bne $3, $1, L10
+mult $16, $14
+; comment only
+L186: beq $9, $9, L36 ; fwd
+L187: lw $0, -71($26)
+bne $7, $25, L47
+lis $3	;tab
+jalr $22
+slt $14, $19, $29
+sw $26, 0xb80f($29)
+mult $5, $19
+sltu $16, $23, $28
+lis $3	;tab
+; comment only
+L188: multu $1, $21
+divu $1, $24
+add $31, $9, $23
+lis $3	;tab
+.word 3765463327
+.word L61
+.word 0xb8458c41
+lis $3	;tab
+sltu $5, $28, $10
+lis $3	;tab
+L189: lis $3	;tab
+
+L190: lw $19, -41($12)
+; comment only
+mfhi $21
+.word 3475940323
+slt $5, $17, $29
+sw $29, 0xeab1($25)
+L191: .word 1595583265
+bne $11, $31, L161
+lis $3	;tab
+lw $23, 0x386e($4)
+div $10, $16
+lis $3	;tab
+; comment only
+L192: .word 1176665626
+lis $3	;tab
+; comment only
+.word -365349087
+beq $5, $21, L6 ; fwd
+beq $21, $14, L130
+jr $0
+mflo $16
+.word -994258334
+; comment only
+L193: lw $6, 58($24)
+lis $8
+L194: ; comment only
+beq $1, $3, L14 ; fwd
+.word L122
+beq $31, $27, L65 ; fwd
+bne $11, $24, L166
+lis $3	;tab
+L195: ; comment only
+lis $2
+divu $3, $14
+L196: slt $28, $23, $10
+lis $3	;tab
+div $15, $4
+slt $18, $0, $0
+sub $23, $1, $8
+bne $8, $23, L62
+.word L86
+; comment only
+jr $30
+.word 0x7cc474b3
+lis $3	;tab
+
+lis $3	;tab
+beq $27, $14, L128
+sw $29, 0x4fa5($22)
+.word 0x9c3b870
+
+sw $10, -74($7)
+add $28, $22, $8
+lis $3	;tab
+L197: sw $25, 0x52ad($17)
+multu $0, $21
+; comment only
+mflo $16
+.word L42
+.word L75
+sltu $28, $19, $24
+; comment only
+lis $22
+beq $23, $14, L203 ; fwd
+L198: sw $20, 0x66a0($22)
+L199: lw $30, -2($7)
+.word L67
+lis $3	;tab
+
+add $18, $1, $30
+; comment only
+.word L24
+
+L200: 
+; comment only
+lw $28, -2($6)
+
+beq $6, $23, L62 ; fwd
+L201: lis $3	;tab
+add $19, $13, $17
+L202: bne $10, $17, L127
+lis $3	;tab
+mult $24, $0
+add $4, $1, $28
+.word L137
+
+.word 1709005299
+L203: 
+jr $19
+; comment only
+beq $8, $10, L188
+.word 0xb5bb4b7
+beq $24, $28, L181
+beq $27, $13, L78
+add $5, $25, $9
+lis $17
+L204: add $16, $0, $24
+L205: sub $7, $9, $19
+; comment only
+.word L103
+
+L206: .word L161
+.word L34
+.word L33
+; comment only
+add $25, $21, $20
+; comment only
+.word L148
+divu $12, $17
+bne $2, $15, L93
+lis $3	;tab
+beq $0, $26, L151 ; fwd
+lis $3	;tab
+beq $19, $18, L193 ; fwd
+.word L165
+.word 1339726051
+.word L201
+lis $3	;tab
+beq $8, $30, L67 ; fwd
+bne $5, $19, L191
+bne $2, $26, L99
+L207: lis $3	;tab
+add $20, $8, $21
+L208: div $6, $21
+jr $8
+L209: 
+sw $15, 0xd681($1)
+jalr $7
+bne $6, $14, L195
+L210: beq $23, $3, L69
+divu $20, $14
+.word L180
+L211: ; comment only
+.word 0x49e3fcd1
+div $14, $25
+lis $3	;tab
+slt $30, $4, $15
+.word L188
+
+L212: add $1, $28, $13
+L213: add $22, $15, $20
+.word 0x50c7852b
+beq $9, $8, L176 ; fwd
+add $13, $13, $24
+; comment only
+add $31, $6, $26
+sub $1, $10, $18
+add $8, $2, $28
+.word 0x8938bf1c
+mflo $29
+.word L146
+slt $2, $9, $4
+divu $29, $2
+
+add $20, $9, $5
+beq $2, $17, L0
+jr $31
+L214: sw $22, 0x79d9($27)
+; comment only
+L215: div $14, $8
+mult $26, $12
+.word 0x68441827
+divu $2, $5
+L216: add $23, $30, $18
+div $25, $7
+lis $3	;tab
+bne $28, $12, L176
+sw $28, -93($4)
+.word -1136266332
+sw $30, 0x9467($14)
+beq $5, $6, L35 ; fwd
+.word 0xf161b861
+beq $24, $26, L6
+.word 0xf3fcc937
+sltu $19, $6, $28
+
+.word L69
+lis $3	;tab
+lis $24
+
+beq $9, $11, L81 ; fwd
+lw $26, -28($7)
+lis $3	;tab
+sltu $17, $12, $2
+beq $12, $21, L147
+lw $5, 0x6519($18)
+multu $29, $13
+; comment only
+
+lis $3	;tab
+add $11, $18, $4
+add $26, $17, $23
+div $20, $22
+.word L9
+add $28, $5, $17
+beq $6, $26, L31
+L217: bne $9, $4, L99
+.word L16
+jalr $15
+add $17, $7, $16
+.word L114
+; comment only
+jr $22
+; comment only
+.word 0x6afa73a
+beq $6, $16, L152 ; fwd
+beq $18, $4, L27 ; fwd
+beq $14, $26, L151 ; fwd
+add $9, $10, $24
+.word 0x7ff9947a
+L218: 
+mfhi $12
+sw $25, -24($1)
+lw $26, 0xd2db($0)
+jr $16
+add $3, $0, $18
+L219: sub $24, $29, $29
+beq $20, $11, L75 ; fwd
+sw $0, 95($12)
+.word 992630835
+L220: .word -272753403
+.word 2834334956
+lw $4, -56($16)
+add $6, $24, $21
+bne $31, $7, L163
+beq $2, $5, L131 ; fwd
+L221: sltu $23, $26, $5
+beq $28, $19, L55
+L222: sub $10, $15, $21
+beq $16, $14, L241 ; fwd
+; comment only
+sub $18, $1, $5
+
+L223: ; comment only
+slt $29, $29, $23
+.word 0x4a5f2d48
+
+divu $8, $26
+divu $6, $0
+lis $31
+slt $31, $3, $8
+.word L40
+multu $8, $10
+L224: beq $13, $26, L113
+sw $2, 0xb4ee($22)
+; comment only
+lis $14
+L225: ; comment only
+L226: .word 0x2782f578
+lw $2, 0x95b9($12)
+lw $0, 21($5)
+beq $10, $29, L98 ; fwd
+sub $17, $16, $1
+L227: .word -202201901
+.word L184
+bne $5, $15, L41
+div $20, $12
+L228: 
+
+beq $1, $6, L4 ; fwd
+; comment only
+
+; comment only
+L229: lw $18, 53($16)
+mflo $1
+L230: 
+sw $9, -21($28)
+L231: lw $22, 0x52fe($27)
+add $25, $28, $11
+
+L232: mfhi $0
+mflo $25
+divu $19, $15
+beq $27, $22, L119
+mflo $4
+.word 0xce48423a
+
+sw $8, 0xa675($18)
+L233: .word L53
+add $23, $3, $27
+jr $3
+beq $25, $22, L121 ; fwd
+; comment only
+sw $29, 0xbeff($22)
+L234: divu $13, $28
+.word 3333253217
+L235: beq $8, $7, L59 ; fwd
+jr $4
+jalr $3
+lis $3	;tab
+lis $3	;tab
+
+L236: bne $17, $28, L24
+L237: beq $15, $9, L246 ; fwd
+.word 0xc5883037
+; comment only
+beq $7, $13, L9 ; fwd
+add $20, $3, $8
+add $25, $22, $26
+mflo $15
+sw $8, -59($27)
+bne $7, $29, L212
+add $13, $27, $7
+L238: 
+add $25, $31, $14
+jalr $1
+bne $15, $25, L17
+L239: lis $3	;tab
+add $12, $15, $18
+L240: bne $0, $15, L31
+
+L241: lw $19, -38($27)
+beq $4, $14, L105 ; fwd
+bne $15, $3, L169
+mflo $27
+; comment only
+; comment only
+; comment only
+.word L162
+add $9, $0, $12
+; comment only
+lw $10, 0x39d4($2)
+add $7, $11, $23
+; comment only
+L242: sw $23, 0x3a5d($15)
+
+bne $9, $31, L193
+mflo $1
+bne $12, $23, L219
+.word 3996494929
+L243: 
+L244: lw $10, 29($29)
+mult $2, $16
+L245: ; comment only
+L246: .word 0x27e12995
+lw $10, -2($19)
+L247: 
+; comment only
+
+.word L108
+sub $23, $23, $30
+L248: slt $18, $25, $18
+add $24, $18, $10
+lw $2, 0xa3af($28)
+jalr $15
+L249: .word 0xcbafcbe5
+
+; comment only
+
+beq $1, $12, L218 ; fwd
+multu $11, $21
+; comment only
+add $14, $11, $6
+.word -1783108877
+add $20, $22, $15
+mult $12, $9
+add $15, $0, $25
+
+sltu $13, $2, $14
+lw $13, 0x5783($21)
+add $12, $23, $5
+.word 0x57e4beab
+lis $3	;tab
+sltu $10, $18, $3
+
+sw $3, 59($14)
+jr $2
+.word L183
+.word -1800247485
+bne $29, $11, L112
+.word 0xad9e28f9
+
+jalr $21
+add $12, $14, $18
+
+bne $6, $15, L73
+; comment only
+lis $3	;tab
+lis $3	;tab
+bne $2, $7, L242
+.word L18
+; comment only
+bne $24, $6, L108
+lis $3	;tab
+sub $28, $13, $23
+
+multu $14, $6
+add $8, $21, $13
+; comment only
+beq $1, $2, L92
+lw $26, 0xa33c($2)
+beq $4, $1, L234 ; fwd
+divu $4, $20
+sltu $29, $24, $9
+lw $22, 0x3756($15)
+lis $3	;tab
+sub $3, $12, $22
+.word 0xd4de215b
+sltu $0, $8, $16
+
+.word 0xab08f0ed
+lw $8, -49($29)
+; comment only
+multu $8, $19
+lw $12, 0xb6e8($13)
+sw $1, -81($21)
+multu $11, $10
+.word 0xd1cd0af
+jr $21
+beq $30, $8, L44
+div $3, $12
+add $28, $15, $26
+lw $8, 0x6618($23)
+beq $18, $31, L145 ; fwd
+.word L228
+beq $23, $6, L203 ; fwd
+beq $29, $3, L178
+.word L93
+.word 0x4b8aa475
+.word 0xa04e34fe
+lis $3	;tab
+lis $3	;tab
+beq $24, $0, L100 ; fwd
+sltu $27, $27, $5
+add $13, $1, $1
+lw $12, 0x1882($13)
+sub $12, $24, $22
+slt $18, $31, $14
+; comment only
+
+slt $23, $21, $8
+lw $19, 0x439f($31)
+lw $5, 0x9d7e($8)
+
+mult $26, $27
+beq $6, $21, L192 ; fwd
+add $12, $23, $12
+
+lis $3	;tab
+.word -1632399724
+.word 0xfd1b27f5
+
+.word L180
+lis $3	;tab
+beq $15, $1, L129 ; fwd
+beq $29, $1, L27 ; fwd
+lis $29
+sw $22, 70($16)
+.word 0xd71161f
+sub $6, $29, $24
+mfhi $10
+lis $3	;tab
+.word L167
+lis $3	;tab
+jr $20
+.word 4017422242
+sw $21, 0x205e($28)
+bne $22, $14, L90
+bne $3, $25, L111
+jr $31
+beq $17, $14, L136
+lis $3	;tab
+; comment only
+.word 2328396435
+; comment only
+.word 0xcecfc57f
+.word 0xf2bf5d14
+sw $20, 0xab2c($24)
+bne $7, $5, L75
+
+
+bne $6, $2, L117
+sub $18, $24, $3
+lis $3	;tab
+div $12, $7
+; comment only
+lis $3	;tab
+
+mult $27, $6
+.word L210
+sub $27, $19, $29
+sw $2, 25($23)
+add $18, $11, $12
+bne $26, $24, L33
+mflo $7
+mfhi $23
+lis $3	;tab
+bne $10, $13, L166
+lis $3	;tab
+add $30, $27, $18
+lis $3	;tab
+
+multu $17, $11
+.word 0x8c8374ea
+lis $3
+
+slt $25, $2, $22
+divu $8, $24
+.word 0x9673d263
+.word 3212472128
+beq $2, $7, L6 ; fwd
+lw $30, 0x1588($13)
+sltu $25, $12, $29
+.word L207
+lis $3	;tab
+divu $25, $8
+.word L246
+.word L169
+divu $14, $27
+; comment only
+.word 0xb7de9b76
+
+mflo $28
+add $19, $12, $5
+sw $22, -72($5)
+.word 1474033816
+slt $11, $24, $13
+bne $15, $13, L248
+beq $5, $10, L0
+mflo $31
+lis $3	;tab
+div $15, $1
+; comment only
+beq $29, $9, L67 ; fwd
+.word 3477037880
+.word 0x8ebf2ff7
+bne $22, $0, L199
+
+.word L20
+sw $9, 0xe06a($5)
+beq $0, $8, L247
+mult $15, $10
+add $10, $26, $21
+beq $17, $17, L241
+
+; comment only
+; comment only
+beq $8, $1, L228
+jr $30
+.word L91
+add $23, $20, $18
+bne $25, $19, L5
+sub $1, $25, $29
+mflo $22
+add $18, $15, $24
+lis $3	;tab
+
+; comment only
+slt $0, $8, $15
+.word L92
+.word 4013490031
+divu $29, $13
+multu $4, $30
+
+mult $9, $19
+.word 3624302117
+.word 2162274601
+.word L223
+sw $24, 55($30)
+beq $14, $13, L242 ; fwd
+lw $2, 93($8)
+beq $11, $19, L176
+jr $23
+slt $23, $9, $14
+add $6, $30, $27
+beq $26, $23, L129
+beq $15, $13, L147 ; fwd
+sub $0, $11, $23
+lw $11, 0x6437($21)
+lw $14, -28($0)
+mflo $6
+; comment only
+sw $10, 0x9651($11)
+beq $19, $29, L181
+lw $3, -68($22)
+div $7, $14
+
+bne $8, $2, L105
+sub $27, $3, $25
+beq $19, $9, L40 ; fwd
+.word 0xd806e5e4
+sltu $9, $27, $1
+sltu $30, $1, $28
+add $25, $31, $22
+sltu $6, $30, $1
+beq $18, $13, L85 ; fwd
+
+lis $3	;tab
+.word -920169882
+.word 0xddefbfd2
+beq $30, $22, L135
+slt $28, $19, $22
+.word -826418092
+divu $11, $17
+sw $24, -73($2)
+sltu $2, $22, $7
+lw $17, -98($25)
+.word L57
+sw $24, 88($4)
+
+lis $3	;tab
+.word L235
+
+; comment only
+jalr $1
+.word 0x29d1db2b
+lis $3	;tab
+beq $15, $12, L205
+.word L94
+sltu $19, $12, $0
+; comment only
+
+slt $10, $15, $1
+bne $10, $27, L139
+bne $7, $25, L159
+sub $31, $31, $15
+beq $13, $17, L37 ; fwd
+lw $30, 0xae2($4)
+lis $3	;tab
+lis $3	;tab
+.word 0xd0586688
+divu $6, $23
+mfhi $23
+; comment only
+lis $3	;tab
+.word L28
+div $0, $21
+.word 0xc69e576a
+; comment only
+
+lis $3	;tab
+slt $19, $20, $0
+
+add $31, $16, $10
+lis $3	;tab
+beq $16, $24, L171 ; fwd
+add $17, $21, $9
+; comment only
+bne $21, $14, L42
+; comment only
+.word L198
+beq $4, $29, L140 ; fwd
+.word L122
+beq $22, $21, L205
+add $5, $4, $16
+bne $17, $27, L198
+lis $6
+sw $14, 0x5f3($21)
+add $8, $30, $29
+.word L70
+lw $15, -77($20)
+.word L87
+sub $24, $3, $9
+.word L103
+slt $0, $2, $21
+.word 0x1fa4829a
+beq $22, $15, L97
+.word -902052338
+; comment only
+jr $21
+sw $18, 0xe14e($12)
+; comment only
+mfhi $0
+lis $3	;tab
+lw $21, 0x8519($8)
+beq $17, $14, L84
+add $14, $5, $5
+sw $11, 0x136($13)
+mflo $9
+bne $5, $28, L34
+; comment only
+lis $3	;tab
+jalr $5
+lis $3	;tab
+; comment only
+mfhi $12
+beq $20, $20, L100 ; fwd
+beq $27, $3, L196 ; fwd
+
+add $17, $11, $9
+slt $28, $15, $16
+bne $28, $31, L235
+lis $3	;tab
+lis $3	;tab
+lis $3	;tab
+div $12, $23
+add $7, $6, $18
+; comment only
+.word L113
+sltu $9, $27, $27
+slt $18, $19, $13
+sw $13, 0x1d39($19)
+beq $20, $22, L96
+.word 0xc9f956df
+mult $30, $13
+add $9, $19, $3
+lis $3	;tab
+; comment only
+.word L135
+add $22, $6, $2
+lis $3	;tab
+.word 0x1b203c58
+
+.word 504276022
+.word L195
+mult $17, $16
+sw $21, 68($5)
+; comment only
+; comment only
+.word 3603507937
+beq $29, $25, L22
+.word L40
+add $19, $3, $10
+mfhi $21
+lis $2
+divu $21, $21
+.word 0xd946c4ea
+beq $24, $28, L88 ; fwd
+beq $13, $4, L116
+beq $22, $6, L138
+beq $1, $27, L56 ; fwd
+.word L138
+.word L249
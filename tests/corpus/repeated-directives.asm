@@ -0,0 +1,6 @@
+.import a
+.import a
+.export b
+.export b
+b: .word a
+.word b
@@ -0,0 +1,38 @@
+add $1,$2,$3
+	lis	$4 ;tab separated
+ADD $1, $2, $3
+Loop:beq $0,$0,Loop
+a:b:c: .word c
+.word 0XFF
+.word 0xFFffFFff
+.word 0x
+.word -
+.word $
+.word $32
+.word $007
+.word 4294967296
+.word -2147483649
+.word 99999999999999999999999
+.word -99999999999999999999999
+.word 0x123456789abcdef01
+.wordx 1
+.Word 1
+.import
+.export x y
+lw $1,-4($2)
+lw $1 , 4 ( $2 )
+# not a comment
+;; comment ; with ; semicolons
+x: ; label then comment
+_under: .word _under
+9lives: .word 1
+jr $31 extra
+.word 1,2
+add $1, $2, $3;no space
+beq $1,$2,-0x1
+@
+
+   
+last: .word last
+crlf: .word 1
+.word crlf
@@ -0,0 +1 @@
+add $1, $2, $3 ; x
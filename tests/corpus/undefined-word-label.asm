@@ -0,0 +1 @@
+.word nolabel
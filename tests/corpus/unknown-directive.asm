@@ -0,0 +1 @@
+.foo 3
@@ -0,0 +1,11 @@
+; Each .word label must be recorded at the address of the .word itself:
+; REL for a label of the module, ESR for an import.
+.import ext
+.export here
+.word 7           ; 0x0c
+here: .word here  ; 0x10: REL 0x10
+.word ext         ; 0x14: ESR 0x14 ext
+beq $0, $0, here  ; 0x18
+.word there       ; 0x1c: REL 0x1c, a forward reference
+.word ext         ; 0x20: ESR 0x20 ext
+there: .word 0    ; 0x24
@@ -0,0 +1,3 @@
+.word 0xffffffffffffffffff
+.word -99999999999999999999
+.word 99999999999999999999
@@ -0,0 +1 @@
+.word $3
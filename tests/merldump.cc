@@ -0,0 +1,42 @@
+#include "merl.h"
+#include <cstdio>
+#include <iostream>
+
+/*
+ * merldump: prints a MERL module of any format as text, for the tests:
+ * each code word with its address, then the REL, ESR and ESD records, as
+ * readMerl() gives them. All addresses are counted from the start of the
+ * file, as in the file itself.
+ */
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: merldump module" << std::endl;
+    return 1;
+  }
+  MerlModule module;
+  try {
+    loadMerl(argv[1], module);
+  } catch (MerlFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+  for (size_t i = 0; i < module.code.size(); i++) {
+    std::printf("code 0x%08x 0x%08x\n",
+                static_cast<unsigned>(MERL_CODE_START + i * 4),
+                static_cast<unsigned>(module.code[i]));
+  }
+  for (uint32_t address : module.relocations) {
+    std::printf("rel 0x%08x\n", static_cast<unsigned>(address));
+  }
+  for (const MerlSymbol &symbol : module.imports) {
+    std::printf("esr 0x%08x %.*s\n", static_cast<unsigned>(symbol.address),
+                static_cast<int>(symbol.nameLength),
+                module.name(symbol).data());
+  }
+  for (const MerlSymbol &symbol : module.exports) {
+    std::printf("esd 0x%08x %.*s\n", static_cast<unsigned>(symbol.address),
+                static_cast<int>(symbol.nameLength),
+                module.name(symbol).data());
+  }
+  return 0;
+}
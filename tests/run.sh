@@ -0,0 +1,127 @@
+#!/bin/sh
+# Regression tests for the scanner and binasm; run with make test.
+#
+# Usage: tests/run.sh binasm asmgen tokdump merldump mipsdis
+#
+# Prints one line per check, which make test compares with
+# tests/expected.txt:
+#   tokens NAME CRC SIZE    the cksum of tokdump's dump of the source
+#   FORMAT NAME RESULT      what binasm made of the source in that format:
+#                           "ok CRC SIZE" (the cksum of the output file) or
+#                           the first line of the error
+#   records LINE            a line of merldump's listing of the module
+#                           word-addresses.asm assembles to
+#   mipsdis NAME RESULT     what mipsdis --check made of a module with names
+#                           of thousands of characters
+# Every source is assembled with -j 1, -j 4, --stream, and --cache twice
+# (building the cache, then reusing it). Where they do not all agree, each
+# one's result is printed instead, so a new disagreement fails. (The few
+# expected ones are sources --stream rejects for a different reason; see
+# Assembler::assembleStream.)
+#
+# The sources are the files in tests/corpus, a large module from asmgen,
+# and copies of mixed-200k.asm with an error deep inside it, where the
+# source is scanned in parallel. After an intended change of output,
+# update tests/expected.txt from the test_output.txt make test leaves.
+
+BINASM=$1
+ASMGEN=$2
+TOKDUMP=$3
+MERLDUMP=$4
+MIPSDIS=$5
+DIR=$(dirname "$0")
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+# The result of assembling $1 with the flags after it.
+result() {
+  source=$1
+  shift
+  rm -f "$WORK/out"
+  if "$BINASM" "$@" "$WORK/out" "$source" 2>"$WORK/err" >/dev/null; then
+    echo "ok $(cksum < "$WORK/out")"
+  else
+    head -n 1 "$WORK/err"
+  fi
+}
+
+check() {
+  source=$1
+  name=$(basename "$source" .asm)
+  echo "tokens $name $("$TOKDUMP" "$source" | cksum)"
+  for format in v1 v2 packed; do
+    case $format in
+      v1) flags= ;;
+      v2) flags=--merl-v2 ;;
+      packed) flags=--merl-packed ;;
+    esac
+    rm -f "$WORK/cache"
+    # $flags is unquoted so that v1 passes no flag at all.
+    result "$source" $flags -j 1 > "$WORK/j1"
+    result "$source" $flags -j 4 > "$WORK/j4"
+    result "$source" $flags --stream > "$WORK/stream"
+    result "$source" $flags --cache "$WORK/cache" > "$WORK/cold"
+    result "$source" $flags --cache "$WORK/cache" > "$WORK/warm"
+    agreed=yes
+    for mode in j4 stream cold warm; do
+      cmp -s "$WORK/j1" "$WORK/$mode" || agreed=no
+    done
+    if [ $agreed = yes ]; then
+      echo "$format $name $(cat "$WORK/j1")"
+    else
+      for mode in j1 j4 stream cold warm; do
+        echo "$format $name $mode: $(cat "$WORK/$mode")"
+      done
+    fi
+  done
+}
+
+for source in "$DIR"/corpus/*.asm; do
+  check "$source"
+done
+
+"$ASMGEN" --lines=100000 --imports=16 --exports=16 \
+    --seed=7 > "$WORK/generated-module.asm"
+check "$WORK/generated-module.asm"
+
+big="$DIR/corpus/mixed-200k.asm"
+{ head -n 150000 "$big"; echo 'bogus $1'; tail -n +150001 "$big"; } \
+    > "$WORK/deep-invalid.asm"
+{ head -n 150000 "$big"; echo '.wrd 1'; } > "$WORK/deep-scan-error.asm"
+{ cat "$big"; echo 'L0: .word 1'; } > "$WORK/late-duplicate.asm"
+for source in "$WORK"/deep-*.asm "$WORK/late-duplicate.asm"; do
+  check "$source"
+done
+
+# The REL and ESR records of .word label and .word import must hold the
+# address of the .word itself, in every format and mode.
+source="$DIR/corpus/word-addresses.asm"
+rm -f "$WORK/records"
+for flags in "" --merl-v2 --merl-packed; do
+  for mode in "-j 1" "-j 4" --stream cache cache; do
+    case $mode in
+      cache) mode="--cache $WORK/cache" ;;
+    esac
+    rm -f "$WORK/out"
+    "$BINASM" $flags $mode "$WORK/out" "$source" >/dev/null 2>&1
+    "$MERLDUMP" "$WORK/out" > "$WORK/dump" 2>&1
+    if [ ! -f "$WORK/records" ]; then
+      cp "$WORK/dump" "$WORK/records"
+    elif ! cmp -s "$WORK/dump" "$WORK/records"; then
+      echo "records differ: $flags $mode"
+    fi
+  done
+  rm -f "$WORK/cache"
+done
+sed 's/^/records /' "$WORK/records"
+
+# Names have no length limit: a module importing, exporting and branching
+# to names of thousands of characters must disassemble and round-trip.
+import=$(head -c 3000 /dev/zero | tr '\0' i)
+label=$(head -c 4000 /dev/zero | tr '\0' l)
+printf '%s\n' ".import $import" ".export $label" ".word $import" \
+    "$label: beq \$0, \$0, $label" ".word $label" 'add $1, $2, $3' \
+    > "$WORK/long-names.asm"
+"$BINASM" "$WORK/out" "$WORK/long-names.asm" >/dev/null 2>&1
+echo "mipsdis long-names $("$MIPSDIS" --check "$WORK/out" 2>&1 |
+    sed "s|$WORK/||")"
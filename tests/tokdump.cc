@@ -0,0 +1,56 @@
+#include "scanner.h"
+#include "sourcefile.h"
+#include "symbols.h"
+#include <iostream>
+#include <string>
+
+/*
+ * tokdump: prints the tokens the scanner finds on each line of a source,
+ * one line of output per source line, for comparing the scanner's output
+ * with a known-good dump. Lines are scanned into a TokenArena with names
+ * interned, as the assembler scans them. Each token is printed as
+ * Token(KIND, lexeme), with =value after numbers and registers; a line
+ * that cannot be scanned prints ERROR.
+ */
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: tokdump source" << std::endl;
+    return 1;
+  }
+  SourceFile source;
+  try {
+    source.map(argv[1]);
+  } catch (SourceFailure &f) {
+    std::cerr << f.what() << std::endl;
+    return 1;
+  }
+  SymbolTable symbols;
+  TokenArena tokens;
+  forEachLine(source.text(), [&](std::string_view text) {
+    try {
+      scan(text, tokens, &symbols);
+    } catch (ScanningFailure &) {
+      std::cout << "ERROR\n";
+      return;
+    }
+    const TokenLine line = tokens.line(tokens.lines() - 1);
+    for (uint32_t t = 0; t < line.size(); t++) {
+      std::string_view lexeme = line.lexeme(t);
+      std::cout << (t ? " " : "") << Token(line.kind(t), lexeme);
+      if (line.kind(t) == Token::INT || line.kind(t) == Token::HEXINT ||
+          line.kind(t) == Token::REG) {
+        std::cout << '=' << line.number(t);
+      } else if (line.kind(t) == Token::ID || line.kind(t) == Token::LABEL) {
+        // The interned name must be the lexeme, less a label's colon.
+        if (line.kind(t) == Token::LABEL) {
+          lexeme.remove_suffix(1);
+        }
+        if (symbols.name(line.symbol(t)) != lexeme) {
+          std::cout << "!=" << symbols.name(line.symbol(t));
+        }
+      }
+    }
+    std::cout << '\n';
+  });
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include "threadpool.h"
+
+ThreadPool::ThreadPool(unsigned threads) {
+  for (unsigned i = 1; i < threads; i++) {
+    workers.emplace_back([this, i] { work(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wake.notify_all();
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::drain(const Job &f, size_t count, unsigned thread) {
+  for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+    f(i, thread);
+  }
+}
+
+void ThreadPool::work(unsigned thread) {
+  uint64_t seen = 0;
+  std::unique_lock<std::mutex> lock(mutex);
+  for (;;) {
+    wake.wait(lock, [&] { return stopping || generation != seen; });
+    if (stopping) {
+      return;
+    }
+    seen = generation;
+    const Job &f = *job;
+    const size_t count = jobCount;
+    lock.unlock();
+    drain(f, count, thread);
+    lock.lock();
+    if (--busy == 0) {
+      done.notify_one();
+    }
+  }
+}
+
+void ThreadPool::run(size_t count, const Job &f) {
+  if (workers.empty() || count <= 1) {
+    for (size_t i = 0; i < count; i++) {
+      f(i, 0);
+    }
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    job = &f;
+    jobCount = count;
+    next = 0;
+    busy = workers.size();
+    generation++;
+  }
+  wake.notify_all();
+  drain(f, count, 0);
+  // Every worker takes part in every job, so f stays alive until all of
+  // them have let go of it.
+  std::unique_lock<std::mutex> lock(mutex);
+  done.wait(lock, [&] { return busy == 0; });
+  job = nullptr;
+}
+
+unsigned defaultThreadCount() {
+  unsigned cores = std::thread::hardware_concurrency();
+  return cores ? cores : 1;
+}
@@ -0,0 +1,63 @@
+#ifndef CS241_THREADPOOL_H
+#define CS241_THREADPOOL_H
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* A fixed set of worker threads that share out the iterations of a loop.
+ *
+ * run(count, f) calls f(i, thread) once for every i in [0, count), on the
+ * workers and on the calling thread, and returns once every call has
+ * finished. thread is the index, below size(), of the thread making the
+ * call (0 for the caller), so f can keep state per thread without locking.
+ * Iterations are handed out one at a time from a shared counter, so a few
+ * slow iterations do not hold up the rest. f must not throw.
+ *
+ * The threads are started once and sleep between runs, so a pool can be
+ * kept and reused for many small jobs. Only one thread may call run() on a
+ * pool at a time.
+ */
+class ThreadPool {
+  public:
+    using Job = std::function<void(size_t, unsigned)>;
+
+  private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    // The current job, valid while busy is non-zero.
+    const Job *job = nullptr;
+    size_t jobCount = 0;
+    std::atomic<size_t> next{0};
+    // Workers that have not finished the current job.
+    size_t busy = 0;
+    uint64_t generation = 0;
+    bool stopping = false;
+
+    void work(unsigned thread);
+    void drain(const Job &f, size_t count, unsigned thread);
+
+  public:
+    // Runs jobs on threads threads in total, counting the caller of run().
+    explicit ThreadPool(unsigned threads);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    void run(size_t count, const Job &f);
+};
+
+/* The number of threads to use when a thread count of 0 asks for one per
+ * core.
+ */
+unsigned defaultThreadCount();
+
+#endif
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <cerrno>
+#include <memory>
+#include <fcntl.h>
+#include <unistd.h>
+#include "wordio.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+// Swaps four words per pshufb. Compiled for SSSE3 only; swapWords checks
+// that the CPU has it before calling this.
+__attribute__((target("ssse3")))
+static size_t swapWordsSsse3(const uint32_t *in, uint32_t *out, size_t count) {
+  const __m128i reverse =
+      _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                     _mm_shuffle_epi8(words, reverse));
+  }
+  return i;
+}
+#endif
+
+void swapWords(const uint32_t *in, uint32_t *out, size_t count) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  if (in != out) {
+    std::copy(in, in + count, out);
+  }
+#else
+  size_t i = 0;
+#if defined(__x86_64__) || defined(__i386__)
+  static const bool ssse3 = __builtin_cpu_supports("ssse3");
+  if (ssse3) {
+    i = swapWordsSsse3(in, out, count);
+  }
+#endif
+  for (; i < count; ++i) {
+    out[i] = __builtin_bswap32(in[i]);
+  }
+#endif
+}
+
+bool writeBytes(int fd, const void *data, size_t length) {
+  const char *buffer = static_cast<const char *>(data);
+  while (length > 0) {
+    ssize_t written = write(fd, buffer, length);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    buffer += written;
+    length -= written;
+  }
+  return true;
+}
+
+bool writeBigEndian(int fd, std::initializer_list<WordSpan> spans) {
+  // 1 MiB blocks: large enough that system call overhead disappears, small
+  // enough to stay in cache while being swapped.
+  const size_t blockWords = 1 << 18;
+  std::unique_ptr<uint32_t[]> block(new uint32_t[blockWords]);
+  size_t used = 0;
+
+  for (const WordSpan &span : spans) {
+    size_t done = 0;
+    while (done < span.size) {
+      size_t count = std::min(span.size - done, blockWords - used);
+      swapWords(span.data + done, block.get() + used, count);
+      used += count;
+      done += count;
+      if (used == blockWords) {
+        if (!writeBytes(fd, reinterpret_cast<const char *>(block.get()),
+                      used * 4)) {
+          return false;
+        }
+        used = 0;
+      }
+    }
+  }
+  return writeBytes(fd, reinterpret_cast<const char *>(block.get()), used * 4);
+}
+
+bool writeBigEndianFile(const char *path,
+                        std::initializer_list<WordSpan> spans) {
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = writeBigEndian(fd, spans);
+  int err = errno;
+  if (close(fd) < 0 && ok) {
+    return false;
+  }
+  errno = err;
+  return ok;
+}
@@ -0,0 +1,43 @@
+#ifndef CS241_WORDIO_H
+#define CS241_WORDIO_H
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+/* A run of 32-bit words held in host byte order.
+ */
+struct WordSpan {
+  const uint32_t *data;
+  size_t size;
+
+  WordSpan(const uint32_t *data, size_t size) : data(data), size(size) {}
+  WordSpan(const std::vector<uint32_t> &words)
+      : data(words.data()), size(words.size()) {}
+};
+
+/* Byte-swaps count words from in to out, so that host-order words become
+ * big-endian on a little-endian host (and the other way round). in and out
+ * may be the same buffer.
+ */
+void swapWords(const uint32_t *in, uint32_t *out, size_t count);
+
+/* Writes all length bytes at data to the file descriptor fd, retrying
+ * after short writes and interruptions. Returns false (with errno set) if a
+ * write fails.
+ */
+bool writeBytes(int fd, const void *data, size_t length);
+
+/* Writes the words of every span to the file descriptor fd, in order, as
+ * big-endian 32-bit values. Words are converted in large blocks and each
+ * block goes out in a single write, rather than one stream insertion per
+ * byte. Returns false (with errno set) if a write fails.
+ */
+bool writeBigEndian(int fd, std::initializer_list<WordSpan> spans);
+
+/* Creates or truncates the file at path and writes the spans to it as
+ * with writeBigEndian. Returns false (with errno set) on failure.
+ */
+bool writeBigEndianFile(const char *path, std::initializer_list<WordSpan> spans);
+
+#endif